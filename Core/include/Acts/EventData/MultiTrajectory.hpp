@@ -11,9 +11,11 @@
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/AlignedAllocator.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <cstdint>
 #include <type_traits>
@@ -46,43 +48,80 @@ namespace detail_lt {
 /// Either type T or const T depending on the boolean.
 template <typename T, bool select>
 using ConstIf = std::conditional_t<select, const T, T>;
-/// wrapper for a dynamic Eigen type that adds support for automatic growth
+/// Column-wise storage of fixed-size items that supports automatic growth.
 ///
-/// \warning Assumes the underlying storage has a fixed number of rows
-template <typename Storage, size_t kSizeIncrement>
+/// The items are stored in a single flat buffer whose start address is
+/// aligned to @p kAlignment bytes. The distance between two columns is padded
+/// to a multiple of the alignment, i.e. every column starts on an aligned
+/// address. The capacity grows geometrically and is kept by @c clear, such
+/// that the storage can be reused without further allocations.
+///
+/// @tparam Scalar Type of the stored coefficients
+/// @tparam kRows Number of coefficients per column
+/// @tparam kSizeIncrement Minimum number of columns added on growth
+/// @tparam kAlignment Alignment of each column in bytes
+template <typename Scalar, size_t kRows, size_t kSizeIncrement,
+          size_t kAlignment = alignof(Scalar)>
 struct GrowableColumns {
+  static_assert(kAlignment % sizeof(Scalar) == 0,
+                "Alignment must be a multiple of the scalar size");
+
+  /// Distance between two consecutive columns in number of scalars
+  static constexpr size_t kStride =
+      ((kRows * sizeof(Scalar) + kAlignment - 1) / kAlignment) * kAlignment /
+      sizeof(Scalar);
+
+  using Column = Eigen::Matrix<Scalar, kRows, 1>;
+  using ColumnMap = Eigen::Map<Column>;
+  using ConstColumnMap = Eigen::Map<const Column>;
+
   /// Make sure storage for @p n additional columns is allocated. Will update
   /// the size of the container accordingly. The indices added by this call
   /// can safely be written to.
   /// @param n Number of columns to add, defaults to 1.
   /// @return View into the last allocated column
-  auto addCol(size_t n = 1) {
+  ColumnMap addCol(size_t n = 1) {
     size_t index = m_size + (n - 1);
-    while (capacity() <= index) {
-      data.conservativeResize(Eigen::NoChange, data.cols() + kSizeIncrement);
+    if (capacity() <= index) {
+      reserve(std::max({index + 1, 2 * capacity(), kSizeIncrement}));
     }
     m_size = index + 1;
 
     // @TODO: do this or not? If we assume this happens only when something is
     // written, the expectation is that everything is zero
-    data.col(index).setZero();
-
-    return data.col(index);
+    ColumnMap column = col(index);
+    column.setZero();
+    return column;
   }
 
   /// Writable access to a column w/o checking its existence first.
-  auto col(size_t index) { return data.col(index); }
+  ColumnMap col(size_t index) {
+    return ColumnMap(m_data.data() + index * kStride);
+  }
 
   /// Read-only access to a column w/o checking its existence first.
-  auto col(size_t index) const { return data.col(index); }
+  ConstColumnMap col(size_t index) const {
+    return ConstColumnMap(m_data.data() + index * kStride);
+  }
+
+  /// Allocate storage for at least @p n columns.
+  /// @note Existing columns are preserved, views into them are invalidated
+  void reserve(size_t n) {
+    if (capacity() < n) {
+      m_data.resize(n * kStride);
+    }
+  }
+
+  /// Remove all columns but keep the allocated storage.
+  void clear() { m_size = 0; }
 
   /// Return the current allocated storage capacity
-  size_t capacity() const { return static_cast<size_t>(data.cols()); }
+  size_t capacity() const { return m_data.size() / kStride; }
 
   size_t size() const { return m_size; }
 
  private:
-  Storage data;
+  std::vector<Scalar, AlignedAllocator<Scalar, kAlignment>> m_data;
   size_t m_size{0};
 };
 
@@ -92,20 +131,21 @@ struct Types {
   enum {
     Flags = Eigen::ColMajor | Eigen::AutoAlign,
     SizeIncrement = 8,
+    // cache line alignment for the matrices that dominate the storage and
+    // the filtering and smoothing arithmetic
+    CovarianceAlignment = 64,
   };
   using Scalar = double;
   // single items
   using Coefficients = Eigen::Matrix<Scalar, Size, 1, Flags>;
   using Covariance = Eigen::Matrix<Scalar, Size, Size, Flags>;
   using CoefficientsMap = Eigen::Map<ConstIf<Coefficients, ReadOnlyMaps>>;
-  using CovarianceMap = Eigen::Map<ConstIf<Covariance, ReadOnlyMaps>>;
+  using CovarianceMap =
+      Eigen::Map<ConstIf<Covariance, ReadOnlyMaps>, Eigen::Aligned64>;
   // storage of multiple items in flat arrays
-  using StorageCoefficients =
-      GrowableColumns<Eigen::Array<Scalar, Size, Eigen::Dynamic, Flags>,
-                      SizeIncrement>;
-  using StorageCovariance =
-      GrowableColumns<Eigen::Array<Scalar, Size * Size, Eigen::Dynamic, Flags>,
-                      SizeIncrement>;
+  using StorageCoefficients = GrowableColumns<Scalar, Size, SizeIncrement>;
+  using StorageCovariance = GrowableColumns<Scalar, Size * Size, SizeIncrement,
+                                            CovarianceAlignment>;
 };
 
 struct IndexData {
@@ -580,6 +620,8 @@ class TrackStateProxy {
   size_t m_istate;
 
   friend class Acts::MultiTrajectory<SourceLink>;
+  // allows copying from a read-only proxy
+  friend class TrackStateProxy<SourceLink, M, false>;
 };
 
 // implement track state visitor concept
@@ -620,6 +662,24 @@ class MultiTrajectory {
   /// Create an empty trajectory.
   MultiTrajectory() = default;
 
+  /// Number of track states in the trajectory.
+  size_t size() const { return m_index.size(); }
+
+  /// Allocate storage for at least @p nStates fully allocated track states.
+  /// @param nStates Number of track states
+  void reserve(size_t nStates);
+
+  /// Number of fully allocated track states that fit into the allocated
+  /// storage without growing it.
+  size_t capacity() const;
+
+  /// Remove all track states but keep the allocated storage.
+  ///
+  /// This allows to reuse a trajectory, e.g. across seeds or events, without
+  /// allocating memory again once it has grown to its working size.
+  /// @note All track state indices and proxies are invalidated
+  void reset();
+
   /// Add a track state without providing explicit information. Which components
   /// of the track state are initialized/allocated can be controlled via @p mask
   /// @param mask The bitmask that instructs which components to allocate and
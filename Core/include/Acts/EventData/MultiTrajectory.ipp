@@ -60,7 +60,7 @@ inline auto TrackStateProxy<SL, M, ReadOnly>::parameters() const -> Parameters {
     idx = data().ipredicted;
   }
 
-  return Parameters(m_traj->m_params.data.col(idx).data());
+  return Parameters(m_traj->m_params.col(idx).data());
 }
 
 template <typename SL, size_t M, bool ReadOnly>
@@ -73,7 +73,7 @@ inline auto TrackStateProxy<SL, M, ReadOnly>::covariance() const -> Covariance {
   } else {
     idx = data().ipredicted;
   }
-  return Covariance(m_traj->m_cov.data.col(idx).data());
+  return Covariance(m_traj->m_cov.col(idx).data());
 }
 
 template <typename SL, size_t M, bool ReadOnly>
@@ -218,6 +218,43 @@ inline size_t MultiTrajectory<SL>::addTrackState(TrackStatePropMask mask,
   return index;
 }
 
+template <typename SL>
+void MultiTrajectory<SL>::reserve(size_t nStates) {
+  m_index.reserve(nStates);
+  m_referenceSurfaces.reserve(nStates);
+  // predicted, filtered and smoothed share the same storage
+  m_params.reserve(3 * nStates);
+  m_cov.reserve(3 * nStates);
+  m_jac.reserve(nStates);
+  m_meas.reserve(nStates);
+  m_measCov.reserve(nStates);
+  // uncalibrated and calibrated source links share the same storage
+  m_sourceLinks.reserve(2 * nStates);
+  m_projectors.reserve(nStates);
+}
+
+template <typename SL>
+size_t MultiTrajectory<SL>::capacity() const {
+  return std::min({m_index.capacity(), m_referenceSurfaces.capacity(),
+                   m_params.capacity() / 3, m_cov.capacity() / 3,
+                   m_jac.capacity(), m_meas.capacity(), m_measCov.capacity(),
+                   m_sourceLinks.capacity() / 2, m_projectors.capacity()});
+}
+
+template <typename SL>
+void MultiTrajectory<SL>::reset() {
+  m_index.clear();
+  m_params.clear();
+  m_cov.clear();
+  m_meas.clear();
+  m_measCov.clear();
+  m_jac.clear();
+  m_sourceLinks.clear();
+  m_projectors.clear();
+  // releases the surface references, but keeps the vector capacity
+  m_referenceSurfaces.clear();
+}
+
 template <typename SL>
 template <typename F>
 void MultiTrajectory<SL>::visitBackwards(size_t iendpoint, F&& callable) const {
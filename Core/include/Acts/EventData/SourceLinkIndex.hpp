@@ -0,0 +1,169 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLinkConcept.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace Acts {
+
+/// Read-only index of source links grouped by their reference surface.
+///
+/// @tparam source_link_t Type fulfilling the @c SourceLinkConcept
+///
+/// The source links are copied into a single flat container that is sorted
+/// by the geometry identifier of their reference surface. All source links
+/// on the same surface thus occupy a contiguous range. The index is meant to
+/// be built once per event and then shared (read-only) by all track finding
+/// calls, e.g. one call per seed, instead of re-grouping the full input
+/// container for each call. Source links on the same surface keep their
+/// relative input order.
+template <typename source_link_t>
+class SourceLinkIndex {
+  static_assert(SourceLinkConcept<source_link_t>,
+                "Source link does not fulfill SourceLinkConcept");
+
+ public:
+  using SourceLink = source_link_t;
+
+  /// Contiguous, non-owning range of source links on one surface.
+  class Range {
+   public:
+    using value_type = source_link_t;
+    using const_iterator = const source_link_t*;
+
+    Range() = default;
+    Range(const_iterator b, const_iterator e) : m_begin(b), m_end(e) {}
+
+    const_iterator begin() const { return m_begin; }
+    const_iterator end() const { return m_end; }
+    bool empty() const { return m_begin == m_end; }
+    size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+
+    const source_link_t& operator[](size_t i) const { return m_begin[i]; }
+    const source_link_t& at(size_t i) const {
+      if (size() <= i) {
+        throw std::out_of_range("Source link range index out of range");
+      }
+      return m_begin[i];
+    }
+
+   private:
+    const_iterator m_begin = nullptr;
+    const_iterator m_end = nullptr;
+  };
+
+  /// Construct an empty index.
+  SourceLinkIndex() = default;
+
+  /// Construct the index from a source link container.
+  ///
+  /// @tparam source_link_container_t Iterable container of source links
+  /// @param sourcelinks The input source links; they are copied
+  template <typename source_link_container_t>
+  explicit SourceLinkIndex(const source_link_container_t& sourcelinks) {
+    // sort a list of (geoID, surface, input position) keys first. sorting the
+    // light-weight keys avoids moving the (potentially large) source links
+    // around more than once.
+    std::vector<Key> keys;
+    keys.reserve(std::size(sourcelinks));
+    size_t position = 0;
+    for (const auto& sl : sourcelinks) {
+      const Surface* srf = &sl.referenceSurface();
+      keys.push_back({srf->geoID().value(), srf, position++});
+    }
+    std::sort(keys.begin(), keys.end(), [](const Key& lhs, const Key& rhs) {
+      return std::tie(lhs.geoId, lhs.surface, lhs.position) <
+             std::tie(rhs.geoId, rhs.surface, rhs.position);
+    });
+
+    // gather random access to the input in case it is not a random access
+    // container itself, e.g. a flat set.
+    std::vector<const source_link_t*> input;
+    input.reserve(keys.size());
+    for (const auto& sl : sourcelinks) {
+      input.push_back(&sl);
+    }
+
+    m_sourcelinks.reserve(keys.size());
+    for (const auto& key : keys) {
+      if (m_surfaces.empty() or m_surfaces.back().surface != key.surface) {
+        m_surfaces.push_back(
+            {key.geoId, key.surface, m_sourcelinks.size(), 0u});
+      }
+      m_sourcelinks.push_back(*input[key.position]);
+      m_surfaces.back().end = m_sourcelinks.size();
+    }
+  }
+
+  SourceLinkIndex(const SourceLinkIndex&) = default;
+  SourceLinkIndex(SourceLinkIndex&&) = default;
+  SourceLinkIndex& operator=(const SourceLinkIndex&) = default;
+  SourceLinkIndex& operator=(SourceLinkIndex&&) = default;
+  ~SourceLinkIndex() = default;
+
+  /// Find all source links on the given surface.
+  ///
+  /// @param surface The surface to look up
+  /// @return Range of source links, empty if there are none on the surface
+  Range find(const Surface& surface) const {
+    const GeometryID::Value geoId = surface.geoID().value();
+    auto it = std::lower_bound(
+        m_surfaces.begin(), m_surfaces.end(), geoId,
+        [](const SurfaceEntry& entry, GeometryID::Value id) {
+          return entry.geoId < id;
+        });
+    // multiple surfaces could share the same (e.g. unset) geometry id
+    for (; it != m_surfaces.end() and it->geoId == geoId; ++it) {
+      if (it->surface == &surface) {
+        return Range(m_sourcelinks.data() + it->begin,
+                     m_sourcelinks.data() + it->end);
+      }
+    }
+    return Range();
+  }
+
+  /// Number of source links in the index.
+  size_t size() const { return m_sourcelinks.size(); }
+  /// Whether the index contains any source links.
+  bool empty() const { return m_sourcelinks.empty(); }
+  /// Number of surfaces with at least one source link.
+  size_t numSurfaces() const { return m_surfaces.size(); }
+
+  /// Access all stored source links in index order.
+  const std::vector<source_link_t>& sourceLinks() const {
+    return m_sourcelinks;
+  }
+
+ private:
+  struct Key {
+    GeometryID::Value geoId;
+    const Surface* surface;
+    size_t position;
+  };
+  struct SurfaceEntry {
+    GeometryID::Value geoId;
+    const Surface* surface;
+    size_t begin;
+    size_t end;
+  };
+
+  std::vector<source_link_t> m_sourcelinks;
+  std::vector<SurfaceEntry> m_surfaces;
+};
+
+}  // namespace Acts
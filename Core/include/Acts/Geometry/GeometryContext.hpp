@@ -13,7 +13,7 @@
 #include ACTS_CORE_GEOMETRYCONTEXT_PLUGIN
 #else
 
-#include <any>
+#include "Acts/Utilities/ContextType.hpp"
 
 namespace Acts {
 
@@ -21,9 +21,9 @@ namespace Acts {
 /// payload object regarding detector geometry status (e.g. alignment)
 ///
 /// It is propagated through the code to allow for event/thread
-/// dependent geometry changes
-
-using GeometryContext = std::any;
+/// dependent geometry changes. The payload can be accessed with
+/// std::any_cast or, without the type information lookup, with get<T>().
+using GeometryContext = ContextType;
 
 }  // namespace Acts
 
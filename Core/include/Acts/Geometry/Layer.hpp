@@ -168,6 +168,22 @@ class Layer : public virtual GeometryObject {
       const GeometryContext& gctx, const Vector3D& position,
       const Vector3D& direction, const options_t& options) const;
 
+  /// @brief Decompose Layer into (compatible) surfaces in place
+  ///
+  /// @tparam options_t The navigation options type
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position parameter for searching
+  /// @param direction Direction parameter for searching
+  /// @param options The templated naivation options
+  /// @param [in,out] sIntersections is cleared and filled with the
+  ///        intersections of the surfaces on the layer; its capacity
+  ///        is reused between calls
+  template <typename options_t>
+  void compatibleSurfaces(const GeometryContext& gctx, const Vector3D& position,
+                          const Vector3D& direction, const options_t& options,
+                          std::vector<SurfaceIntersection>& sIntersections) const;
+
   /// Surface seen on approach
   ///
   /// @tparam options_t The navigation options type
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Layer;
+class Surface;
+class TrackingGeometry;
+class TrackingVolume;
+
+/// @class NavigationLookup
+///
+/// Precomputed surface candidates for the navigation on layers.
+///
+/// For every layer with a surface array and every (phi, eta) bin of the
+/// direction, the lookup holds the short list of surfaces of the array that
+/// can be crossed by straight lines from the origin with a direction in the
+/// bin, ordered by their distance from the origin. It is built once for a
+/// closed tracking geometry.
+///
+/// The bin is given by the line from the origin through the position on the
+/// layer. The candidates replace the neighbour search of the surface array if
+/// the track stays within the tolerance of that line while crossing the
+/// layer. Other tracks, e.g. strongly curved ones or tracks towards the
+/// origin at a large angle, get no candidates and use the full search. The
+/// Navigator can validate the candidates against the full search.
+class NavigationLookup {
+ public:
+  /// The candidate surfaces
+  using Surfaces = std::vector<const Surface*>;
+
+  /// @struct Config
+  /// Configuration of the lookup
+  struct Config {
+    /// The origin of the straight lines, e.g. the beam spot
+    Vector3D origin = Vector3D::Zero();
+    /// The number of direction bins in phi
+    size_t nPhiBins = 128;
+    /// The number of direction bins in eta
+    size_t nEtaBins = 100;
+    /// The eta range of the direction bins
+    double etaMin = -4.;
+    double etaMax = 4.;
+    /// The tolerance on the surface bounds and on the distance of the track
+    /// from the line through the origin within the layer
+    double tolerance = 1 * UnitConstants::mm;
+  };
+
+  /// Constructor
+  ///
+  /// @param gctx The geometry context the candidates are built for
+  /// @param tGeometry The closed tracking geometry
+  /// @param cfg The configuration of the lookup
+  NavigationLookup(const GeometryContext& gctx,
+                   const TrackingGeometry& tGeometry, const Config& cfg);
+
+  /// Candidate surfaces on a layer
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param layer The layer the track is on
+  /// @param position The global position of the track
+  /// @param direction The (signed) direction of the track
+  ///
+  /// @return pointer to the candidates or nullptr if the lookup does not
+  ///         apply, i.e. the full surface array search is needed
+  const Surfaces* candidates(const GeometryContext& gctx, const Layer& layer,
+                             const Vector3D& position,
+                             const Vector3D& direction) const;
+
+  /// The number of layers with candidates
+  size_t size() const { return m_layers.size(); }
+
+  /// Access to the configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The direction bin, the number of bins if outside the eta range
+  size_t directionBin(const Vector3D& direction) const;
+
+  /// Fill the candidates of all layers within a volume
+  void buildVolume(const GeometryContext& gctx, const TrackingVolume& volume);
+
+  /// Fill the candidates of one layer
+  void buildLayer(const GeometryContext& gctx, const Layer& layer);
+
+  Config m_cfg;
+  /// The candidates per layer and direction bin
+  std::unordered_map<const Layer*, std::vector<Surfaces>> m_layers;
+};
+
+}  // namespace Acts
@@ -0,0 +1,154 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Frustum.hpp"
+#include "Acts/Utilities/Ray.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Layer;
+class Surface;
+class TrackingGeometry;
+class TrackingVolume;
+
+/// @class SurfaceHierarchy
+///
+/// Bounding volume hierarchy over a set of surfaces.
+///
+/// Nodes with more than the maximum leaf size are split with the surface area
+/// heuristic (SAH), evaluated in bins of the box centers along each axis. The
+/// nodes are stored in one array in depth-first order: the first child of an
+/// inner node directly follows it and each node knows the index of the node
+/// after its subtree. The traversal therefore needs no stack and only walks
+/// forward through the array. The surfaces of a leaf are stored contiguously.
+class SurfaceHierarchy {
+ public:
+  using BoundingBox = AxisAlignedBoundingBox<Surface, double, 3>;
+
+  /// @struct Config
+  /// Configuration of the hierarchy
+  struct Config {
+    /// The maximum number of surfaces in a leaf
+    size_t maxLeafSize = 4;
+    /// The number of bins per axis for the SAH evaluation
+    size_t nSahBins = 16;
+    /// The envelope added to the surface boxes
+    double envelope = 1 * UnitConstants::mm;
+    /// The number of segments to approximate curved surface bounds
+    size_t nSegments = 8;
+  };
+
+  /// @struct Node
+  /// A node of the flattened hierarchy
+  struct Node {
+    /// The box around all surfaces of the subtree, without entity
+    BoundingBox box;
+    /// The index of the node following the subtree
+    size_t skip = 0;
+    /// The range of the surfaces of a leaf, empty for inner nodes
+    size_t first = 0;
+    size_t count = 0;
+  };
+
+  /// Constructor
+  ///
+  /// @param gctx The geometry context the hierarchy is built for
+  /// @param surfaces The surfaces to sort into the hierarchy
+  /// @param cfg The configuration of the hierarchy
+  SurfaceHierarchy(const GeometryContext& gctx,
+                   const std::vector<const Surface*>& surfaces,
+                   const Config& cfg);
+
+  /// Collect the surfaces whose boxes are intersected
+  ///
+  /// @tparam object_t The intersected object, i.e. a Ray3D or a Frustum
+  ///
+  /// @param object The object to intersect the boxes with
+  /// @param [in,out] surfaces The surface candidates are appended to these
+  template <typename object_t>
+  void candidates(const object_t& object,
+                  std::vector<const Surface*>& surfaces) const {
+    size_t iNode = 0;
+    while (iNode < m_nodes.size()) {
+      const Node& node = m_nodes[iNode];
+      if (not node.box.intersect(object)) {
+        iNode = node.skip;
+      } else if (node.count > 0) {
+        surfaces.insert(surfaces.end(), m_surfaces.begin() + node.first,
+                        m_surfaces.begin() + node.first + node.count);
+        iNode = node.skip;
+      } else {
+        ++iNode;
+      }
+    }
+  }
+
+  /// The nodes in depth-first order
+  const std::vector<Node>& nodes() const { return m_nodes; }
+
+  /// The surfaces in the order of the leaves
+  const std::vector<const Surface*>& surfaces() const { return m_surfaces; }
+
+ private:
+  /// Create the subtree for a range of surface boxes
+  void build(std::vector<BoundingBox>& boxes, size_t first, size_t last);
+
+  /// Find the SAH split of a range of surface boxes and partition them
+  ///
+  /// @return the partition point, first or last if there is no split
+  size_t split(std::vector<BoundingBox>& boxes, size_t first, size_t last,
+               const Vector3D& vmin, const Vector3D& vmax) const;
+
+  Config m_cfg;
+  std::vector<Node> m_nodes;
+  std::vector<const Surface*> m_surfaces;
+};
+
+/// @class SurfaceHierarchies
+///
+/// Surface hierarchies over the sensitive surfaces of each layer of a
+/// tracking geometry, e.g. for the candidate search of the Navigator.
+class SurfaceHierarchies {
+ public:
+  /// Constructor
+  ///
+  /// @param gctx The geometry context the hierarchies are built for
+  /// @param tGeometry The closed tracking geometry
+  /// @param cfg The configuration of the hierarchies
+  SurfaceHierarchies(const GeometryContext& gctx,
+                     const TrackingGeometry& tGeometry,
+                     const SurfaceHierarchy::Config& cfg);
+
+  /// The hierarchy of a layer
+  ///
+  /// @param layer The layer
+  ///
+  /// @return the hierarchy or nullptr if the layer has no surface array
+  const SurfaceHierarchy* find(const Layer& layer) const;
+
+  /// The number of layers with a hierarchy
+  size_t size() const { return m_hierarchies.size(); }
+
+ private:
+  /// Create the hierarchies of the layers of a volume and its sub volumes
+  void buildVolume(const GeometryContext& gctx, const TrackingVolume& volume,
+                   const SurfaceHierarchy::Config& cfg);
+
+  std::unordered_map<const Layer*, SurfaceHierarchy> m_hierarchies;
+};
+
+}  // namespace Acts
@@ -177,6 +177,19 @@ class TrackingVolume : public Volume {
       const GeometryContext& gctx, const Vector3D& position,
       const Vector3D& direction, const NavigationOptions<Layer>& options) const;
 
+  /// @brief Resolves the volume into (compatible) Layers in place
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position for the search
+  /// @param direction Direction for the search
+  /// @param options The templated navigation options
+  /// @param [in,out] lIntersections is cleared and filled with the compatible
+  ///        intersections with layers; its capacity is reused between calls
+  void compatibleLayers(const GeometryContext& gctx, const Vector3D& position,
+                        const Vector3D& direction,
+                        const NavigationOptions<Layer>& options,
+                        std::vector<LayerIntersection>& lIntersections) const;
+
   /// @brief Returns all boundary surfaces sorted by the user.
   ///
   /// @tparam options_t Type of navigation options object for decomposition
@@ -194,6 +207,19 @@ class TrackingVolume : public Volume {
       const Vector3D& direction,
       const NavigationOptions<Surface>& options) const;
 
+  /// @brief Returns all boundary surfaces sorted by the user in place
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position The position for searching
+  /// @param direction The direction for searching
+  /// @param options The templated navigation options
+  /// @param [in,out] bIntersections is cleared and filled with the boundary
+  ///        intersections; its capacity is reused between calls
+  void compatibleBoundaries(
+      const GeometryContext& gctx, const Vector3D& position,
+      const Vector3D& direction, const NavigationOptions<Surface>& options,
+      std::vector<BoundaryIntersection>& bIntersections) const;
+
   /// @brief Return surfaces in given direction from bounding volume hierarchy
   /// @tparam options_t Type of navigation options object for decomposition
   ///
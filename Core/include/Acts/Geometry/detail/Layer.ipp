@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <limits>
 
 namespace Acts {
@@ -72,17 +73,24 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     const Vector3D& direction, const options_t& options) const {
   // the list of valid intersection
   std::vector<SurfaceIntersection> sIntersections;
-  // remember the surfaces for duplicate removal
-  std::map<const Surface*, bool> accepted;
+  // reserve a few bins
+  sIntersections.reserve(20);
+  compatibleSurfaces(gctx, position, direction, options, sIntersections);
+  return sIntersections;
+}
+
+template <typename options_t>
+void Layer::compatibleSurfaces(
+    const GeometryContext& gctx, const Vector3D& position,
+    const Vector3D& direction, const options_t& options,
+    std::vector<SurfaceIntersection>& sIntersections) const {
+  sIntersections.clear();
 
   // fast exit - there is nothing to
   if (!m_surfaceArray || !m_approachDescriptor || !options.navDir) {
-    return sIntersections;
+    return;
   }
 
-  // reserve a few bins
-  sIntersections.reserve(20);
-
   // (0) End surface check
   // @todo: - we might be able to skip this by use of options.pathLimit
   // check if you have to stop at the endSurface
@@ -100,7 +108,7 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     if (endInter) {
       pathLimit = endInter.intersection.pathLength;
     } else {
-      return sIntersections;
+      return;
     }
   } else {
     // compatibleSurfaces() should only be called when on the layer,
@@ -113,10 +121,11 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   }
 
   // lemma 0 : accept the surface
-  auto acceptSurface = [&options, &accepted](const Surface& sf,
-                                             bool sensitive = false) -> bool {
-    // check for duplicates
-    if (accepted.find(&sf) != accepted.end()) {
+  auto acceptSurface = [&options, &sIntersections](
+                           const Surface& sf, bool sensitive = false) -> bool {
+    // check for duplicates, the few candidates are searched linearly
+    if (std::any_of(sIntersections.begin(), sIntersections.end(),
+                    [&sf](const auto& sfi) { return sfi.object == &sf; })) {
       return false;
     }
     // surface is sensitive and you're asked to resolve
@@ -153,7 +162,6 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
       // Now put the right sign on it
       sfi.intersection.pathLength *= std::copysign(1., options.navDir);
       sIntersections.push_back(sfi);
-      accepted[&sf] = true;
     }
     return;
   };
@@ -181,13 +189,18 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   // check the sensitive surfaces if you have some
   if (m_surfaceArray && (options.resolveMaterial || options.resolvePassive ||
                          options.resolveSensitive)) {
-    // get the canditates
-    const std::vector<const Surface*>& sensitiveSurfaces =
-        m_surfaceArray->neighbors(position);
+    // get the canditates, unless they are given
+    const std::vector<const Surface*>* sensitiveSurfaces =
+        options.surfaceCandidates;
+    std::vector<const Surface*> neighbors;
+    if (sensitiveSurfaces == nullptr) {
+      neighbors = m_surfaceArray->neighbors(position);
+      sensitiveSurfaces = &neighbors;
+    }
     // loop through and veto
     // - if the approach surface is the parameter surface
     // - if the surface is not compatible with the type(s) that are collected
-    for (auto& sSurface : sensitiveSurfaces) {
+    for (auto& sSurface : *sensitiveSurfaces) {
       processSurface(*sSurface, true);
     }
   }
@@ -199,13 +212,8 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   processSurface(*layerSurface);
 
   // sort according to the path length
-  if (options.navDir == forward) {
-    std::sort(sIntersections.begin(), sIntersections.end());
-  } else {
-    std::sort(sIntersections.begin(), sIntersections.end(), std::greater<>());
-  }
-
-  return sIntersections;
+  sortIntersections(sIntersections.begin(), sIntersections.end(),
+                    options.navDir);
 }
 
 template <typename options_t>
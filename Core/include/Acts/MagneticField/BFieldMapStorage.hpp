@@ -0,0 +1,83 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Definitions.hpp"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Acts {
+
+/// @brief Storage policy for the field values of an interpolated field map
+///
+/// @tparam scalar_t Scalar type used to store the field components, either
+///         a floating point or a signed integral type
+///
+/// The field values are stored as Eigen column vectors of @c scalar_t in the
+/// grid and are decoded to double precision before they are interpolated.
+/// Floating point values are converted directly. Integral values represent
+/// the field as fixed-point numbers in units of @c scale.
+template <typename scalar_t>
+struct BFieldMapStorage {
+  static_assert(std::is_floating_point_v<scalar_t> or
+                    (std::is_integral_v<scalar_t> and
+                     std::is_signed_v<scalar_t>),
+                "Field values must be stored as floating point or signed "
+                "integral numbers");
+
+  using Scalar = scalar_t;
+
+  /// Type of a stored field value with @c N components
+  template <int N>
+  using Value = Eigen::Matrix<scalar_t, N, 1>;
+
+  /// Field value represented by one unit of the stored integers, ignored for
+  /// floating point storage
+  double scale = 1.;
+
+  /// @brief decode a stored field value
+  ///
+  /// @param [in] value stored field value
+  /// @return field value in double precision
+  template <typename value_t>
+  ActsVectorD<value_t::RowsAtCompileTime> decode(const value_t& value) const {
+    if constexpr (std::is_same_v<scalar_t, double>) {
+      return value;
+    } else if constexpr (std::is_floating_point_v<scalar_t>) {
+      return value.template cast<double>();
+    } else {
+      return scale * value.template cast<double>();
+    }
+  }
+
+  /// @brief encode a field value for storage
+  ///
+  /// @param [in] value field value in double precision
+  /// @return stored field value; integral values are rounded to the closest
+  ///         representable value and clamped to the range of @c scalar_t
+  template <typename vector_t>
+  Value<vector_t::RowsAtCompileTime> encode(const vector_t& value) const {
+    if constexpr (std::is_floating_point_v<scalar_t>) {
+      return value.template cast<scalar_t>();
+    } else {
+      constexpr double limit = std::numeric_limits<scalar_t>::max();
+      Value<vector_t::RowsAtCompileTime> encoded;
+      for (int i = 0; i < vector_t::RowsAtCompileTime; ++i) {
+        const double units = std::round(value[i] / scale);
+        encoded[i] = static_cast<scalar_t>(
+            units < -limit ? -limit : (units > limit ? limit : units));
+      }
+      return encoded;
+    }
+  }
+};
+
+}  // namespace Acts
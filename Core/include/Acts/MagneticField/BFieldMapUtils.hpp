@@ -12,6 +12,10 @@
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 /// Convenience functions to ease creation of and Acts::InterpolatedBFieldMap
@@ -22,6 +26,112 @@ namespace Acts {
 
 class SolenoidBField;
 
+/// @brief Map global 3D positions (x,y,z) onto the (r,z) grid space
+struct RZPositionTransform {
+  Vector2D operator()(const Vector3D& pos) const {
+    return Vector2D(std::sqrt(pos.x() * pos.x() + pos.y() * pos.y()), pos.z());
+  }
+
+  /// Derivatives of (r,z) w.r.t. (x,y,z); on the z-axis phi = 0 is assumed
+  /// consistently with @c RZFieldTransform
+  ActsMatrixD<2, 3> jacobian(const Vector3D& pos) const {
+    double r = std::sqrt(pos.x() * pos.x() + pos.y() * pos.y());
+    double cos_phi = 1.;
+    double sin_phi = 0.;
+    if (r > std::numeric_limits<double>::min()) {
+      cos_phi = pos.x() / r;
+      sin_phi = pos.y() / r;
+    }
+    ActsMatrixD<2, 3> jac;
+    jac << cos_phi, sin_phi, 0., 0., 0., 1.;
+    return jac;
+  }
+};
+
+/// @brief Map (Br,Bz) field values onto the global (Bx,By,Bz) field
+struct RZFieldTransform {
+  Vector3D operator()(const Vector2D& field, const Vector3D& pos) const {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi = 1.;
+    double sin_phi = 0.;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    }
+    return Vector3D(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  }
+
+  /// Derivatives of (Bx,By,Bz) w.r.t. (x,y,z) at fixed (Br,Bz), i.e. the
+  /// derivatives of the rotation with phi; they vanish on the z-axis where
+  /// phi = 0 is assumed
+  ActsMatrixD<3, 3> jacobian(const Vector2D& field, const Vector3D& pos) const {
+    ActsMatrixD<3, 3> jac = ActsMatrixD<3, 3>::Zero();
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      double cos_phi = pos.x() * inv_r_sin_theta;
+      double sin_phi = pos.y() * inv_r_sin_theta;
+      // d(cos_phi, sin_phi)/d(x,y) = (sin_phi, -cos_phi)^T (sin_phi, -cos_phi)
+      // divided by r
+      double br_r = field.x() * inv_r_sin_theta;
+      jac(0, 0) = br_r * sin_phi * sin_phi;
+      jac(0, 1) = -br_r * sin_phi * cos_phi;
+      jac(1, 0) = -br_r * sin_phi * cos_phi;
+      jac(1, 1) = br_r * cos_phi * cos_phi;
+    }
+    return jac;
+  }
+};
+
+/// @brief Identity mapping of global 3D positions onto the (x,y,z) grid space
+struct XYZPositionTransform {
+  Vector3D operator()(const Vector3D& pos) const { return pos; }
+
+  /// Derivatives of (x,y,z) w.r.t. (x,y,z)
+  ActsMatrixD<3, 3> jacobian(const Vector3D& /*pos*/) const {
+    return ActsMatrixD<3, 3>::Identity();
+  }
+};
+
+/// @brief Identity mapping of (Bx,By,Bz) field values onto the global field
+struct XYZFieldTransform {
+  Vector3D operator()(const Vector3D& field, const Vector3D& /*pos*/) const {
+    return field;
+  }
+
+  /// Derivatives of (Bx,By,Bz) w.r.t. (x,y,z) at fixed field values
+  ActsMatrixD<3, 3> jacobian(const Vector3D& /*field*/,
+                             const Vector3D& /*pos*/) const {
+    return ActsMatrixD<3, 3>::Zero();
+  }
+};
+
+/// Field mapper for cylindrically symmetric (r,z) maps with inlined transforms
+using InterpolatedBFieldMapperRZ = InterpolatedBFieldMapper<
+    detail::Grid<Vector2D, detail::EquidistantAxis, detail::EquidistantAxis>,
+    RZPositionTransform, RZFieldTransform>;
+
+/// Field mapper for cartesian (x,y,z) maps with inlined transforms
+using InterpolatedBFieldMapperXYZ = InterpolatedBFieldMapper<
+    detail::Grid<Vector3D, detail::EquidistantAxis, detail::EquidistantAxis,
+                 detail::EquidistantAxis>,
+    XYZPositionTransform, XYZFieldTransform>;
+
+/// Field mapper for (r,z) maps storing the field components as @c scalar_t
+template <typename scalar_t>
+using CompactBFieldMapperRZ = InterpolatedBFieldMapper<
+    detail::Grid<Eigen::Matrix<scalar_t, 2, 1>, detail::EquidistantAxis,
+                 detail::EquidistantAxis>,
+    RZPositionTransform, RZFieldTransform, BFieldMapStorage<scalar_t>>;
+
+/// Field mapper for (x,y,z) maps storing the field components as @c scalar_t
+template <typename scalar_t>
+using CompactBFieldMapperXYZ = InterpolatedBFieldMapper<
+    detail::Grid<Eigen::Matrix<scalar_t, 3, 1>, detail::EquidistantAxis,
+                 detail::EquidistantAxis, detail::EquidistantAxis>,
+    XYZPositionTransform, XYZFieldTransform, BFieldMapStorage<scalar_t>>;
+
 /// Method to setup the FieldMapper
 /// @param localToGlobalBin Function mapping the local bins of r,z to the global
 /// bin of the map magnetic field value
@@ -62,16 +172,23 @@ class SolenoidBField;
 /// e.g. we have the grid values r={0,1} with BFieldValues={2,3} on the r axis.
 /// If the flag is set to true the r-axis grid values will be set to {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
-                                         std::array<size_t, 2> nBinsRZ)>&
-                  localToGlobalBin,
-              std::vector<double> rPos, std::vector<double> zPos,
-              std::vector<Acts::Vector2D> bField,
-              double lengthUnit = UnitConstants::mm,
-              double BFieldUnit = UnitConstants::T, bool firstQuadrant = false);
+/// @tparam scalar_t Scalar type used to store the field components in the
+/// grid, available for @c double, @c float and @c int16_t. The field values
+/// are encoded while the grid is filled, i.e. no double precision grid is
+/// created for compact storage. For @c int16_t the fixed-point scale is
+/// chosen such that the largest given field component is represented by the
+/// largest integer.
+/// @return A field mapper with inlined transformations. It converts to the
+/// type-erased @c InterpolatedBFieldMapper of the same grid type returned by
+/// earlier versions of this function.
+template <typename scalar_t = double>
+CompactBFieldMapperRZ<scalar_t> fieldMapperRZ(
+    const std::function<size_t(std::array<size_t, 2> binsRZ,
+                               std::array<size_t, 2> nBinsRZ)>&
+        localToGlobalBin,
+    std::vector<double> rPos, std::vector<double> zPos,
+    std::vector<Acts::Vector2D> bField, double lengthUnit = UnitConstants::mm,
+    double BFieldUnit = UnitConstants::T, bool firstQuadrant = false);
 
 /// Method to setup the FieldMapper
 /// @param localToGlobalBin Function mapping the local bins of x,y,z to the
@@ -123,16 +240,18 @@ fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
 /// e.g. we have the grid values z={0,1} with BFieldValues={2,3} on the r axis.
 /// If the flag is set to true the z-axis grid values will be set to {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-fieldMapperXYZ(const std::function<size_t(std::array<size_t, 3> binsXYZ,
-                                          std::array<size_t, 3> nBinsXYZ)>&
-                   localToGlobalBin,
-               std::vector<double> xPos, std::vector<double> yPos,
-               std::vector<double> zPos, std::vector<Acts::Vector3D> bField,
-               double lengthUnit = UnitConstants::mm,
-               double BFieldUnit = UnitConstants::T, bool firstOctant = false);
+/// @tparam scalar_t Scalar type used to store the field components in the
+/// grid, see fieldMapperRZ
+/// @return A field mapper with inlined transformations, see fieldMapperRZ
+template <typename scalar_t = double>
+CompactBFieldMapperXYZ<scalar_t> fieldMapperXYZ(
+    const std::function<size_t(std::array<size_t, 3> binsXYZ,
+                               std::array<size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, std::vector<Acts::Vector3D> bField,
+    double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
+    bool firstOctant = false);
 
 /// Function which takes an existing SolenoidBField instance and
 /// creates a field mapper by sampling grid points from the analytical
@@ -143,13 +262,62 @@ fieldMapperXYZ(const std::function<size_t(std::array<size_t, 3> binsXYZ,
 /// @param nbins pair of bin counts
 /// @param field the solenoid field instance
 ///
-/// @return A field mapper instance for use in interpolation.
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-solenoidFieldMapper(std::pair<double, double> rlim,
-                    std::pair<double, double> zlim,
-                    std::pair<size_t, size_t> nbins,
-                    const SolenoidBField& field);
+/// @return A field mapper instance for use in interpolation. It converts to
+/// the type-erased @c InterpolatedBFieldMapper of the same grid type.
+Acts::InterpolatedBFieldMapperRZ solenoidFieldMapper(
+    std::pair<double, double> rlim, std::pair<double, double> zlim,
+    std::pair<size_t, size_t> nbins, const SolenoidBField& field);
+
+/// Function which converts an existing field mapper into one storing the
+/// field values in a more compact form on the same grid, e.g. as single
+/// precision or 16 bit fixed-point numbers.
+///
+/// @tparam scalar_t Scalar type used to store the field components
+/// @param mapper the field mapper to convert
+///
+/// @return A field mapper with the same binning and transformations
+///
+/// For integral @c scalar_t the fixed-point scale is chosen such that the
+/// largest field component of the map is represented by the largest integer.
+/// The interpolation itself is always done in double precision.
+template <typename scalar_t, typename value_t, typename... axes_t,
+          typename transform_pos_t, typename transform_bfield_t,
+          typename storage_t>
+InterpolatedBFieldMapper<
+    detail::Grid<Eigen::Matrix<scalar_t, value_t::RowsAtCompileTime, 1>,
+                 axes_t...>,
+    transform_pos_t, transform_bfield_t, BFieldMapStorage<scalar_t>>
+compactFieldMapper(
+    const InterpolatedBFieldMapper<detail::Grid<value_t, axes_t...>,
+                                   transform_pos_t, transform_bfield_t,
+                                   storage_t>& mapper) {
+  using Storage = BFieldMapStorage<scalar_t>;
+  using Grid_t = detail::Grid<
+      Eigen::Matrix<scalar_t, value_t::RowsAtCompileTime, 1>, axes_t...>;
+
+  const auto& grid = mapper.getGrid();
+  const auto& storage = mapper.getStorage();
+
+  Storage compactStorage;
+  if constexpr (std::is_integral_v<scalar_t>) {
+    double maxAbs = 0.;
+    for (size_t bin = 0; bin < grid.size(); ++bin) {
+      maxAbs = std::max(maxAbs,
+                        storage.decode(grid.at(bin)).cwiseAbs().maxCoeff());
+    }
+    if (maxAbs > 0.) {
+      compactStorage.scale = maxAbs / std::numeric_limits<scalar_t>::max();
+    }
+  }
+
+  Grid_t compactGrid(grid.axesTuple());
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    compactGrid.at(bin) = compactStorage.encode(storage.decode(grid.at(bin)));
+  }
+  return InterpolatedBFieldMapper<Grid_t, transform_pos_t, transform_bfield_t,
+                                  Storage>(
+      mapper.getTransformPos(), mapper.getTransformBField(),
+      std::move(compactGrid), compactStorage);
+}
 
 }  // namespace Acts
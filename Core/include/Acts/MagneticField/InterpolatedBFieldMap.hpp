@@ -8,30 +8,75 @@
 
 #pragma once
 
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
+#include "Acts/Utilities/Units.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <array>
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
 
+namespace concept {
+  namespace BFieldMapper {
+  METHOD_TRAIT(jacobian_t, jacobian);
+  }  // namespace BFieldMapper
+}  // namespace concept
+
 /// @brief struct for mapping global 3D positions to field values
 ///
-/// @tparam DIM_POS Dimensionality of position in magnetic field map
-/// @tparam DIM_BFIELD Dimensionality of BField in magnetic field map
+/// @tparam G Type of the grid storing the field values
+/// @tparam transform_pos_t Type of the callable mapping global 3D positions
+///         onto grid space
+/// @tparam transform_bfield_t Type of the callable calculating the global 3D
+///         field from the (decoded) field value and the global 3D position
+/// @tparam storage_t Storage policy decoding the field values stored in the
+///         grid, see @c BFieldMapStorage
 ///
 /// Global 3D positions are transformed into a @c DIM_POS Dimensional
 /// vector which
 /// is used to look up the magnetic field value in the underlying field map.
-template <typename G>
+///
+/// The transformations default to type-erased @c std::function objects.
+/// Using plain function objects instead, e.g. as done by the helpers in
+/// @c BFieldMapUtils.hpp, allows inlining of the transformations and makes
+/// field cells cheap to create and copy.
+///
+/// A position transformation can optionally provide the method
+/// <tt>ActsMatrixD<DIM_POS, 3> jacobian(const Vector3D&) const</tt> returning
+/// the derivatives of the grid coordinates w.r.t. the global position. It is
+/// used to compute the field gradient; without it the jacobian is obtained by
+/// finite differences of the position transformation.
+///
+/// The grid may store the field values with reduced precision, e.g. as
+/// single precision or fixed-point numbers, to reduce the memory footprint of
+/// large maps. They are decoded to double precision by the storage policy
+/// before the interpolation.
+template <typename G,
+          typename transform_pos_t =
+              std::function<ActsVectorD<G::DIM>(const Vector3D&)>,
+          typename transform_bfield_t = std::function<Vector3D(
+              const ActsVectorD<G::value_type::RowsAtCompileTime>&,
+              const Vector3D&)>,
+          typename storage_t =
+              BFieldMapStorage<typename G::value_type::Scalar>>
 struct InterpolatedBFieldMapper {
  public:
   using Grid_t = G;
-  using FieldType = typename Grid_t::value_type;
+  /// Type of the field values stored in the grid
+  using StoredType = typename Grid_t::value_type;
+  /// Type of the decoded field values passed to the field transformation
+  using FieldType = ActsVectorD<StoredType::RowsAtCompileTime>;
+  using TransformPos = transform_pos_t;
+  using TransformBField = transform_bfield_t;
+  using Storage = storage_t;
   static constexpr size_t DIM_POS = Grid_t::DIM;
 
   /// @brief struct representing smallest grid unit in magnetic field grid
@@ -45,20 +90,25 @@ struct InterpolatedBFieldMapper {
    public:
     /// @brief default constructor
     ///
-    /// @param [in] transform   mapping of global 3D coordinates onto grid space
+    /// @param [in] transformPos    mapping of global 3D coordinates onto grid
+    ///                             space
+    /// @param [in] transformBField calculating the global 3D field from the
+    ///                             field values and the global 3D position
     /// @param [in] lowerLeft   generalized lower-left corner of hyper box
     ///                         (containing the minima of the hyper box along
     ///                         each Dimension)
     /// @param [in] upperRight  generalized upper-right corner of hyper box
     ///                         (containing the maxima of the hyper box along
     ///                         each Dimension)
-    /// @param [in] fieldValues field values at the hyper box corners sorted in
-    ///                         the canonical order defined in Acts::interpolate
-    FieldCell(std::function<ActsVectorD<DIM_POS>(const Vector3D&)> transformPos,
+    /// @param [in] fieldValues decoded field values at the hyper box corners
+    ///                         sorted in the canonical order defined in
+    ///                         Acts::interpolate
+    FieldCell(TransformPos transformPos, TransformBField transformBField,
               std::array<double, DIM_POS> lowerLeft,
               std::array<double, DIM_POS> upperRight,
-              std::array<Vector3D, N> fieldValues)
+              std::array<FieldType, N> fieldValues)
         : m_transformPos(std::move(transformPos)),
+          m_transformBField(std::move(transformBField)),
           m_lowerLeft(std::move(lowerLeft)),
           m_upperRight(std::move(upperRight)),
           m_fieldValues(std::move(fieldValues)) {}
@@ -69,10 +119,90 @@ struct InterpolatedBFieldMapper {
     /// @return magnetic field value at the given position
     ///
     /// @pre The given @c position must lie within the current field cell.
+    ///
+    /// @note The field transformation is applied at the given position, i.e.
+    ///       the result is identical to InterpolatedBFieldMapper::getField.
+    ///       Previously the corner values were transformed once at the
+    ///       position the cell was created for, such that e.g. the direction
+    ///       of Br in (r,z) maps was fixed to the phi of that position.
     Vector3D getField(const Vector3D& position) const {
       // defined in Interpolation.hpp
-      return interpolate(m_transformPos(position), m_lowerLeft, m_upperRight,
-                         m_fieldValues);
+      return m_transformBField(interpolate(m_transformPos(position),
+                                           m_lowerLeft, m_upperRight,
+                                           m_fieldValues),
+                               position);
+    }
+
+    /// @brief retrieve field and its gradient at given position
+    ///
+    /// @param [in]  position   global 3D position
+    /// @param [out] derivative gradient of the magnetic field as (3x3) matrix
+    ///                         with @c derivative(i,j) = dB_i/dx_j
+    /// @return magnetic field value at the given position
+    ///
+    /// @pre The given @c position must lie within the current field cell.
+    ///
+    /// @note The gradient is the analytic derivative of the linear
+    ///       interpolation within this cell, i.e. it is computed from the
+    ///       corner values without any further field look-up. It includes
+    ///       the position dependence of the field transformation, e.g. the
+    ///       rotation of (Br,Bz) with phi for (r,z) maps, which requires the
+    ///       field transformation to be linear in the field values.
+    Vector3D getFieldGradient(const Vector3D& position,
+                              ActsMatrixD<3, 3>& derivative) const {
+      const ActsVectorD<DIM_POS> gridPosition = m_transformPos(position);
+
+      // relative position inside the cell and inverse cell width per axis
+      std::array<double, DIM_POS> f;
+      std::array<double, DIM_POS> invWidth;
+      for (unsigned int i = 0; i < DIM_POS; ++i) {
+        invWidth[i] = 1. / (m_upperRight[i] - m_lowerLeft[i]);
+        f[i] = (gridPosition[i] - m_lowerLeft[i]) * invWidth[i];
+      }
+
+      constexpr int DIM_FIELD = FieldType::RowsAtCompileTime;
+      FieldType field = FieldType::Zero();
+      ActsMatrixD<DIM_FIELD, DIM_POS> gridDerivative =
+          ActsMatrixD<DIM_FIELD, DIM_POS>::Zero();
+      for (unsigned int corner = 0; corner < N; ++corner) {
+        // interpolation weight of this corner along each axis and its
+        // derivative; the bit of the first axis is the left most one, see
+        // Acts::interpolate for the canonical corner order
+        std::array<double, DIM_POS> w;
+        std::array<double, DIM_POS> dw;
+        for (unsigned int i = 0; i < DIM_POS; ++i) {
+          const bool upper = ((corner >> (DIM_POS - 1 - i)) & 1u) != 0u;
+          w[i] = upper ? f[i] : 1. - f[i];
+          dw[i] = upper ? invWidth[i] : -invWidth[i];
+        }
+        double weight = 1.;
+        for (unsigned int i = 0; i < DIM_POS; ++i) {
+          weight *= w[i];
+        }
+        field += weight * m_fieldValues[corner];
+        for (unsigned int k = 0; k < DIM_POS; ++k) {
+          double dweight = dw[k];
+          for (unsigned int i = 0; i < DIM_POS; ++i) {
+            if (i != k) {
+              dweight *= w[i];
+            }
+          }
+          gridDerivative.col(k) += dweight * m_fieldValues[corner];
+        }
+      }
+
+      // chain rule through the position transformation; the field
+      // transformation is linear in the field values and is applied to each
+      // column of the derivative
+      const ActsMatrixD<DIM_FIELD, 3> localDerivative =
+          gridDerivative * positionJacobian(position);
+      for (unsigned int j = 0; j < 3; ++j) {
+        derivative.col(j) =
+            m_transformBField(FieldType(localDerivative.col(j)), position);
+      }
+      // explicit position dependence of the field transformation
+      derivative += fieldTransformJacobian(field, position);
+      return m_transformBField(field, position);
     }
 
     /// @brief check whether given 3D position is inside this field cell
@@ -92,8 +222,62 @@ struct InterpolatedBFieldMapper {
     }
 
    private:
+    /// @brief derivatives of the grid coordinates w.r.t. the global position
+    ///
+    /// @param [in] position global 3D position
+    /// @return (DIM_POS x 3) jacobian of the position transformation
+    ActsMatrixD<DIM_POS, 3> positionJacobian(const Vector3D& position) const {
+      if constexpr (concept ::has_method<const TransformPos,
+                                         ActsMatrixD<DIM_POS, 3>,
+                                         concept ::BFieldMapper::jacobian_t,
+                                         const Vector3D&>) {
+        return m_transformPos.jacobian(position);
+      } else {
+        // central differences of the (cheap) position transformation
+        constexpr double h = 1e-3 * UnitConstants::mm;
+        ActsMatrixD<DIM_POS, 3> jacobian;
+        for (unsigned int j = 0; j < 3; ++j) {
+          const Vector3D step = h * Vector3D::Unit(j);
+          const ActsVectorD<DIM_POS> up = m_transformPos(position + step);
+          const ActsVectorD<DIM_POS> down = m_transformPos(position - step);
+          jacobian.col(j) = (up - down) / (2 * h);
+        }
+        return jacobian;
+      }
+    }
+
+    /// @brief derivatives of the global field w.r.t. the global position at
+    ///        fixed field values
+    ///
+    /// @param [in] field    decoded field value
+    /// @param [in] position global 3D position
+    /// @return (3 x 3) jacobian of the field transformation
+    ActsMatrixD<3, 3> fieldTransformJacobian(const FieldType& field,
+                                             const Vector3D& position) const {
+      if constexpr (concept ::has_method<const TransformBField,
+                                         ActsMatrixD<3, 3>,
+                                         concept ::BFieldMapper::jacobian_t,
+                                         const FieldType&, const Vector3D&>) {
+        return m_transformBField.jacobian(field, position);
+      } else {
+        // central differences of the (cheap) field transformation
+        constexpr double h = 1e-3 * UnitConstants::mm;
+        ActsMatrixD<3, 3> jacobian;
+        for (unsigned int j = 0; j < 3; ++j) {
+          const Vector3D step = h * Vector3D::Unit(j);
+          const Vector3D up = m_transformBField(field, position + step);
+          const Vector3D down = m_transformBField(field, position - step);
+          jacobian.col(j) = (up - down) / (2 * h);
+        }
+        return jacobian;
+      }
+    }
+
     /// geometric transformation applied to global 3D positions
-    std::function<ActsVectorD<DIM_POS>(const Vector3D&)> m_transformPos;
+    TransformPos m_transformPos;
+
+    /// calculating the global 3D field from the field values
+    TransformBField m_transformBField;
 
     /// generalized lower-left corner of the confining hyper-box
     std::array<double, DIM_POS> m_lowerLeft;
@@ -101,11 +285,11 @@ struct InterpolatedBFieldMapper {
     /// generalized upper-right corner of the confining hyper-box
     std::array<double, DIM_POS> m_upperRight;
 
-    /// @brief magnetic field vectors at the hyper-box corners
+    /// @brief decoded magnetic field values at the hyper-box corners
     ///
     /// @note These values must be order according to the prescription detailed
     ///       in Acts::interpolate.
-    std::array<Vector3D, N> m_fieldValues;
+    std::array<FieldType, N> m_fieldValues;
   };
 
   /// @brief default constructor
@@ -116,14 +300,35 @@ struct InterpolatedBFieldMapper {
   /// (cartesian) of the magnetic field with the local n dimensional field and
   /// the global 3D position as input
   /// @param [in] grid      grid storing magnetic field values
-  InterpolatedBFieldMapper(
-      std::function<ActsVectorD<DIM_POS>(const Vector3D&)> transformPos,
-      std::function<Vector3D(const FieldType&, const Vector3D&)>
-          transformBField,
-      Grid_t grid)
+  /// @param [in] storage   policy decoding the stored field values
+  InterpolatedBFieldMapper(TransformPos transformPos,
+                           TransformBField transformBField, Grid_t grid,
+                           Storage storage = Storage())
       : m_transformPos(std::move(transformPos)),
         m_transformBField(std::move(transformBField)),
-        m_grid(std::move(grid)) {}
+        m_grid(std::move(grid)),
+        m_storage(std::move(storage)) {}
+
+  /// @brief construct from a mapper with different transformation types
+  ///
+  /// @param [in] other mapper using the same grid and storage policy
+  ///
+  /// This allows to store mappers with inlined transformations, e.g. the ones
+  /// returned by the helpers in @c BFieldMapUtils.hpp, as the type-erased
+  /// @c InterpolatedBFieldMapper<G> that these helpers used to return.
+  template <typename other_transform_pos_t, typename other_transform_bfield_t,
+            typename = std::enable_if_t<
+                std::is_constructible_v<TransformPos,
+                                        const other_transform_pos_t&> and
+                std::is_constructible_v<TransformBField,
+                                        const other_transform_bfield_t&>>>
+  InterpolatedBFieldMapper(
+      const InterpolatedBFieldMapper<G, other_transform_pos_t,
+                                     other_transform_bfield_t, storage_t>&
+          other)
+      : InterpolatedBFieldMapper(TransformPos(other.getTransformPos()),
+                                 TransformBField(other.getTransformBField()),
+                                 other.getGrid(), other.getStorage()) {}
 
   /// @brief retrieve field at given position
   ///
@@ -133,8 +338,24 @@ struct InterpolatedBFieldMapper {
   /// @pre The given @c position must lie within the range of the underlying
   ///      magnetic field map.
   Vector3D getField(const Vector3D& position) const {
-    return m_transformBField(m_grid.interpolate(m_transformPos(position)),
-                             position);
+    if constexpr (std::is_same_v<StoredType, FieldType>) {
+      return m_transformBField(m_grid.interpolate(m_transformPos(position)),
+                               position);
+    } else {
+      // compact values are decoded at the corner points and interpolated in
+      // double precision, as done by the grid for double values
+      const auto& gridPosition = m_transformPos(position);
+      const auto& indices = m_grid.localBinsFromPosition(gridPosition);
+      std::array<FieldType, 1 << DIM_POS> neighbors;
+      size_t i = 0;
+      for (size_t index : m_grid.closestPointsIndices(gridPosition)) {
+        neighbors.at(i++) = m_storage.decode(m_grid.at(index));
+      }
+      return m_transformBField(
+          interpolate(gridPosition, m_grid.lowerLeftBinEdge(indices),
+                      m_grid.upperRightBinEdge(indices), neighbors),
+          position);
+    }
   }
 
   /// @brief retrieve field cell for given position
@@ -152,15 +373,15 @@ struct InterpolatedBFieldMapper {
 
     // loop through all corner points
     constexpr size_t nCorners = 1 << DIM_POS;
-    std::array<Vector3D, nCorners> neighbors;
+    std::array<FieldType, nCorners> neighbors;
     const auto& cornerIndices = m_grid.closestPointsIndices(gridPosition);
 
     size_t i = 0;
     for (size_t index : cornerIndices) {
-      neighbors.at(i++) = m_transformBField(m_grid.at(index), position);
+      neighbors.at(i++) = m_storage.decode(m_grid.at(index));
     }
 
-    return FieldCell(m_transformPos, lowerLeft, upperRight,
+    return FieldCell(m_transformPos, m_transformBField, lowerLeft, upperRight,
                      std::move(neighbors));
   }
 
@@ -202,15 +423,28 @@ struct InterpolatedBFieldMapper {
   /// @return grid reference
   const Grid_t& getGrid() const { return m_grid; }
 
+  /// @brief Get the transformation of global positions onto the grid
+  const TransformPos& getTransformPos() const { return m_transformPos; }
+
+  /// @brief Get the transformation of field values to the global frame
+  const TransformBField& getTransformBField() const {
+    return m_transformBField;
+  }
+
+  /// @brief Get the storage policy of the field values
+  const Storage& getStorage() const { return m_storage; }
+
  private:
   /// geometric transformation applied to global 3D positions
-  std::function<ActsVectorD<DIM_POS>(const Vector3D&)> m_transformPos;
+  TransformPos m_transformPos;
   /// Transformation calculating the global 3D coordinates (cartesian) of the
   /// magnetic field with the local n dimensional field and the global 3D
   /// position as input
-  std::function<Vector3D(const FieldType&, const Vector3D&)> m_transformBField;
+  TransformBField m_transformBField;
   /// grid storing magnetic field values
   Grid_t m_grid;
+  /// policy decoding the stored field values
+  Storage m_storage;
 };
 
 /// @ingroup MagneticField
@@ -255,6 +489,9 @@ class InterpolatedBFieldMap final {
     /// @param mcfg the magnetic field context
     Cache(std::reference_wrapper<const MagneticFieldContext> /*mcfg*/) {}
 
+    /// The field cell of the last lookup. Its size is fixed at compile time,
+    /// i.e. updating it does not allocate unless the mapper uses type-erased
+    /// transformations.
     std::optional<typename Mapper_t::FieldCell> fieldCell;
     bool initialized = false;
   };
@@ -296,29 +533,31 @@ class InterpolatedBFieldMap final {
   ///
   /// @param [in]  position   global 3D position
   /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  ///                         with @c derivative(i,j) = dB_i/dx_j
   /// @return magnetic field vector
-  ///
-  /// @note currently the derivative is not calculated
-  /// @todo return derivative
   Vector3D getFieldGradient(const Vector3D& position,
-                            ActsMatrixD<3, 3>& /*derivative*/) const {
-    return m_config.mapper.getField(position);
+                            ActsMatrixD<3, 3>& derivative) const {
+    return getFieldCell(position).getFieldGradient(position, derivative);
   }
 
   /// @brief retrieve magnetic field value & its gradient
   ///
   /// @param [in]  position   global 3D position
   /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  ///                         with @c derivative(i,j) = dB_i/dx_j
   /// @param [in,out] cache Cache object. Contains field cell used for
+  /// interpolation
   /// @return magnetic field vector
   ///
-  /// @note currently the derivative is not calculated
-  /// @note Cache is not used currently
-  /// @todo return derivative
+  /// @note Field and gradient are both obtained from the cached field cell,
+  ///       i.e. no additional map look-ups are needed for the gradient.
   Vector3D getFieldGradient(const Vector3D& position,
-                            ActsMatrixD<3, 3>& /*derivative*/,
-                            Cache& /*cache*/) const {
-    return m_config.mapper.getField(position);
+                            ActsMatrixD<3, 3>& derivative,
+                            Cache& cache) const {
+    if (!cache.fieldCell || !(*cache.fieldCell).isInside(position)) {
+      cache.fieldCell = getFieldCell(position);
+    }
+    return (*cache.fieldCell).getFieldGradient(position, derivative);
   }
 
   /// @brief get global scaling factor for magnetic field
@@ -329,7 +568,7 @@ class InterpolatedBFieldMap final {
   /// @brief convenience method to access underlying field mapper
   ///
   /// @return the field mapper
-  Mapper_t getMapper() const { return m_config.mapper; }
+  const Mapper_t& getMapper() const { return m_config.mapper; }
 
   /// @brief check whether given 3D position is inside look-up domain
   ///
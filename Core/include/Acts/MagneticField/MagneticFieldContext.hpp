@@ -13,7 +13,7 @@
 #include ACTS_CORE_MAGFIELDCONTEXT_PLUGIN
 #else
 
-#include <any>
+#include "Acts/Utilities/ContextType.hpp"
 
 namespace Acts {
 
@@ -21,9 +21,9 @@ namespace Acts {
 /// payload object regarding magnetic field status
 ///
 /// It is propagated through the code to allow for event/thread
-/// dependent magnetic field changes
-
-using MagneticFieldContext = std::any;
+/// dependent magnetic field changes. The payload can be accessed with
+/// std::any_cast or, without the type information lookup, with get<T>().
+using MagneticFieldContext = ContextType;
 
 }  // namespace Acts
 
@@ -10,13 +10,18 @@
 
 #include "Acts/Geometry/BoundarySurfaceT.hpp"
 #include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/NavigationLookup.hpp"
+#include "Acts/Geometry/SurfaceHierarchy.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Frustum.hpp"
+#include "Acts/Utilities/Ray.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <sstream>
@@ -57,6 +62,10 @@ struct NavigationOptions {
   /// Target surface to exclude
   const Surface* targetSurface = nullptr;
 
+  /// Candidate surfaces that replace the surface array search on layers,
+  /// e.g. from a NavigationLookup
+  const std::vector<const Surface*>* surfaceCandidates = nullptr;
+
   /// The maximum path limit for this navigation step
   double pathLimit = std::numeric_limits<double>::max();
 
@@ -154,11 +163,28 @@ class Navigator {
   /// stop at every surface regardless what it is
   bool resolvePassive = false;
 
+  /// Optional precomputed surface candidates on the layers
+  std::shared_ptr<const NavigationLookup> navigationLookup = nullptr;
+  /// Optional surface hierarchies for the candidate search on the layers,
+  /// used where the navigation lookup does not apply
+  std::shared_ptr<const SurfaceHierarchies> surfaceHierarchies = nullptr;
+  /// The opening angle of the frustum for the hierarchy search,
+  /// a ray is used for 0
+  double hierarchyOpeningAngle = 0.;
+  /// Check the candidates of the lookup or the hierarchy against the full
+  /// surface search, the full search result is used in case of a mismatch
+  /// and the mismatches are counted in the navigation state
+  bool validateSurfaceCandidates = false;
+
   /// Nested State struct
   ///
   /// It acts as an internal state which is
   /// created for every propagation/extrapolation step
   /// and keep thread-local navigation information
+  ///
+  /// The candidate containers are owned by the state and filled in place by
+  /// the surface, layer and boundary resolution, i.e. their memory is reused
+  /// throughout the propagation.
   struct State {
     // Navigation on surface level
     /// the vector of navigation surfaces to work through
@@ -181,6 +207,13 @@ class Navigator {
     /// Externally provided surfaces - these are tried to be hit
     ExternalSurfaces externalSurfaces = {};
 
+    /// Surface candidates from the hierarchy search
+    Surfaces hierarchySurfaces = {};
+
+    /// Number of surface candidate searches that differed from the full
+    /// search, only counted if the candidates are validated
+    size_t surfaceCandidateMismatches = 0;
+
     /// Navigation sate: the world volume
     const TrackingVolume* worldVolume = nullptr;
 
@@ -750,7 +783,7 @@ class Navigator {
 
             state.navigation.navSurfaceIter =
                 state.navigation.navSurfaces.begin();
-            state.navigation.navLayers = {};
+            state.navigation.navLayers.clear();
             state.navigation.navLayerIter = state.navigation.navLayers.end();
             // The stepper updates the step size ( single / multi component)
             stepper.updateStepSize(state.stepping,
@@ -903,10 +936,10 @@ class Navigator {
         return ss.str();
       });
       // Evaluate the boundary surfaces
-      state.navigation.navBoundaries =
-          state.navigation.currentVolume->compatibleBoundaries(
-              state.geoContext, stepper.position(state.stepping),
-              stepper.direction(state.stepping), navOpts);
+      state.navigation.currentVolume->compatibleBoundaries(
+          state.geoContext, stepper.position(state.stepping),
+          stepper.direction(state.stepping), navOpts,
+          state.navigation.navBoundaries);
       // The number of boundary candidates
       debugLog(state, [&] {
         std::stringstream dstream;
@@ -1104,9 +1137,28 @@ class Navigator {
                                 : stepper.overstepLimit(state.stepping);
 
     // get the surfaces
-    state.navigation.navSurfaces = navLayer->compatibleSurfaces(
-        state.geoContext, stepper.position(state.stepping),
-        stepper.direction(state.stepping), navOpts);
+    // restrict the candidates if a lookup is present
+    if (navigationLookup != nullptr) {
+      navOpts.surfaceCandidates = navigationLookup->candidates(
+          state.geoContext, *navLayer, stepper.position(state.stepping),
+          state.stepping.navDir * stepper.direction(state.stepping));
+    }
+    // otherwise search them in the surface hierarchy of the layer
+    if (navOpts.surfaceCandidates == nullptr and
+        surfaceHierarchies != nullptr) {
+      const auto* hierarchy = surfaceHierarchies->find(*navLayer);
+      if (hierarchy != nullptr) {
+        searchHierarchy(state, stepper, *hierarchy);
+        navOpts.surfaceCandidates = &state.navigation.hierarchySurfaces;
+      }
+    }
+    navLayer->compatibleSurfaces(state.geoContext,
+                                 stepper.position(state.stepping),
+                                 stepper.direction(state.stepping), navOpts,
+                                 state.navigation.navSurfaces);
+    if (validateSurfaceCandidates and navOpts.surfaceCandidates != nullptr) {
+      validateSurfaces(state, stepper, *navLayer, navOpts);
+    }
     // the number of layer candidates
     if (!state.navigation.navSurfaces.empty()) {
       debugLog(state, [&] {
@@ -1137,6 +1189,81 @@ class Navigator {
     return false;
   }
 
+  /// @brief Search the surface candidates of a layer in a hierarchy
+  ///
+  /// The hierarchy is traversed with a ray, or a frustum if an opening angle
+  /// is configured, along the navigation direction. The candidates are kept
+  /// in the navigation state.
+  ///
+  /// @tparam propagator_state_t The state type of the propagagor
+  /// @tparam stepper_t The type of stepper used for the propagation
+  ///
+  /// @param [in,out] state is the propagation state object
+  /// @param [in] stepper Stepper in use
+  /// @param [in] hierarchy is the surface hierarchy of the layer the
+  /// surfaces are resolved on
+  template <typename propagator_state_t, typename stepper_t>
+  void searchHierarchy(propagator_state_t& state, const stepper_t& stepper,
+                       const SurfaceHierarchy& hierarchy) const {
+    const Vector3D position = stepper.position(state.stepping);
+    const Vector3D direction =
+        state.stepping.navDir * stepper.direction(state.stepping);
+    auto& candidates = state.navigation.hierarchySurfaces;
+    candidates.clear();
+    if (hierarchyOpeningAngle > 0.) {
+      hierarchy.candidates(
+          Frustum<double, 3, 4>(position, direction, hierarchyOpeningAngle),
+          candidates);
+    } else {
+      hierarchy.candidates(Ray3D(position, direction), candidates);
+    }
+    debugLog(state, [&] {
+      std::stringstream dstream;
+      dstream << candidates.size() << " surface candidates from hierarchy.";
+      return dstream.str();
+    });
+  }
+
+  /// @brief Validate the surface candidates of the lookup or the hierarchy
+  ///
+  /// The surfaces are compared to the full surface search on the layer,
+  /// its result replaces them in case of a mismatch. The mismatches are
+  /// counted in the navigation state.
+  ///
+  /// @tparam propagator_state_t The state type of the propagagor
+  /// @tparam stepper_t The type of stepper used for the propagation
+  ///
+  /// @param [in,out] state is the propagation state object
+  /// @param [in] stepper Stepper in use
+  /// @param [in] navLayer is the layer the surfaces were resolved on
+  /// @param [in] navOpts are the navigation options with the candidates
+  template <typename propagator_state_t, typename stepper_t>
+  void validateSurfaces(propagator_state_t& state, const stepper_t& stepper,
+                        const Layer& navLayer,
+                        NavigationOptions<Surface> navOpts) const {
+    navOpts.surfaceCandidates = nullptr;
+    NavigationSurfaces reference;
+    navLayer.compatibleSurfaces(
+        state.geoContext, stepper.position(state.stepping),
+        stepper.direction(state.stepping), navOpts, reference);
+    auto& navSurfaces = state.navigation.navSurfaces;
+    if (not std::equal(navSurfaces.begin(), navSurfaces.end(),
+                       reference.begin(), reference.end(),
+                       [](const auto& a, const auto& b) {
+                         return (a.object == b.object);
+                       })) {
+      ++state.navigation.surfaceCandidateMismatches;
+      debugLog(state, [&] {
+        std::stringstream dstream;
+        dstream << "Surface candidates mismatch on layer " << navLayer.geoID();
+        dstream << ": " << navSurfaces.size() << " instead of ";
+        dstream << reference.size() << " surface candidates found.";
+        return dstream.str();
+      });
+      std::swap(navSurfaces, reference);
+    }
+  }
+
   /// Navigation through layers
   /// -------------------------------------------------
   ///
@@ -1173,10 +1300,10 @@ class Navigator {
     navOpts.pathLimit = state.stepping.stepSize.value(ConstrainedStep::aborter);
     navOpts.overstepLimit = stepper.overstepLimit(state.stepping);
     // Request the compatible layers
-    state.navigation.navLayers =
-        state.navigation.currentVolume->compatibleLayers(
-            state.geoContext, stepper.position(state.stepping),
-            stepper.direction(state.stepping), navOpts);
+    state.navigation.currentVolume->compatibleLayers(
+        state.geoContext, stepper.position(state.stepping),
+        stepper.direction(state.stepping), navOpts,
+        state.navigation.navLayers);
 
     // Layer candidates have been found
     if (!state.navigation.navLayers.empty()) {
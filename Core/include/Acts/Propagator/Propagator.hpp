@@ -24,6 +24,7 @@
 #include "Acts/Propagator/detail/VoidPropagatorComponents.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/Tracing.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 #include <cmath>
@@ -242,7 +242,7 @@ class BinnedSPGroup {
       std::shared_ptr<Acts::BinFinder<external_spacepoint_t>> botBinFinder,
       std::shared_ptr<Acts::BinFinder<external_spacepoint_t>> tBinFinder,
       std::unique_ptr<SpacePointGrid<external_spacepoint_t>> grid,
-      SeedfinderConfig<external_spacepoint_t>& config);
+      const SeedfinderConfig<external_spacepoint_t>& config);
 
   size_t size() { return m_binnedSP.size(); }
 
@@ -258,6 +258,22 @@ class BinnedSPGroup {
         phiZbins[0], phiZbins[1] + 1);
   }
 
+  /// Number of groups, i.e. of middle space point bins, in iteration order
+  size_t numGroups() const {
+    auto phiZbins = m_binnedSP->numLocalBins();
+    return phiZbins[0] * phiZbins[1];
+  }
+
+  /// Random access to a single group, e.g. to process groups in parallel.
+  /// @param index of the group in iteration order, smaller than numGroups()
+  /// @return iterator pointing to the requested group
+  BinnedSPGroupIterator<external_spacepoint_t> group(size_t index) {
+    auto phiZbins = m_binnedSP->numLocalBins();
+    return BinnedSPGroupIterator<external_spacepoint_t>(
+        m_binnedSP.get(), m_bottomBinFinder.get(), m_topBinFinder.get(),
+        index / phiZbins[1] + 1, index % phiZbins[1] + 1);
+  }
+
  private:
   // grid with ownership of all InternalSpacePoint
   std::unique_ptr<Acts::SpacePointGrid<external_spacepoint_t>> m_binnedSP;
@@ -0,0 +1,83 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace Acts {
+
+/// Estimate the track parameters at the bottom space point of a seed.
+///
+/// @tparam external_spacepoint_t The space point type; it must provide the
+///         global coordinates via x(), y() and z()
+///
+/// @param seed The seed with the bottom, middle and top space point
+/// @param bFieldZ The magnetic field along the z axis in native units
+/// @param cov The track parameters covariance; the q/p entry is the squared
+///        relative momentum resolution
+/// @return The curvilinear parameters at the bottom space point
+///
+/// The transverse momentum and the direction are computed from the circle
+/// through the three space points in the transverse plane, the polar angle
+/// from the arc length between the bottom and the top space point. The
+/// estimate is exact for three points on a helix along the z axis.
+template <typename external_spacepoint_t>
+CurvilinearParameters estimateTrackParamsFromSeed(
+    const Seed<external_spacepoint_t>& seed, double bFieldZ,
+    const BoundSymMatrix& cov) {
+  const auto& sps = seed.sp();
+  const Vector3D p0(sps[0]->x(), sps[0]->y(), sps[0]->z());
+  const Vector3D p1(sps[1]->x(), sps[1]->y(), sps[1]->z());
+  const Vector3D p2(sps[2]->x(), sps[2]->y(), sps[2]->z());
+  const Vector2D d01 = (p1 - p0).template head<2>();
+  const Vector2D d12 = (p2 - p1).template head<2>();
+  const Vector2D d02 = (p2 - p0).template head<2>();
+
+  // signed curvature; positive for a counter-clockwise bend
+  const double cross = d01.x() * d12.y() - d01.y() * d12.x();
+  double curvature = 2 * cross / (d01.norm() * d12.norm() * d02.norm());
+  // avoid a division by zero for three collinear space points
+  const double minCurvature = 1e-9 / UnitConstants::mm;
+  if (std::abs(curvature) < minCurvature) {
+    curvature = std::copysign(minCurvature, curvature);
+  }
+
+  // the tangent at the first point differs from the chord by half the arc
+  const double halfArc01 =
+      std::asin(std::clamp(0.5 * d01.norm() * curvature, -1., 1.));
+  const double phi = std::atan2(d01.y(), d01.x()) - halfArc01;
+  const double halfArc02 =
+      std::asin(std::clamp(0.5 * d02.norm() * std::abs(curvature), 0., 1.));
+  const double arcLength = 2 * halfArc02 / std::abs(curvature);
+  const double theta = std::atan2(arcLength, p2.z() - p0.z());
+
+  // a positive particle bends clockwise in a field along the positive z axis
+  const double charge = (0 < curvature * bFieldZ) ? -1 : 1;
+  const double pt = std::abs(bFieldZ / curvature);
+  const double p = pt / std::sin(theta);
+  const Vector3D momentum(p * std::sin(theta) * std::cos(phi),
+                          p * std::sin(theta) * std::sin(phi),
+                          p * std::cos(theta));
+
+  BoundSymMatrix trackCov = cov;
+  trackCov(eQOP, eQOP) /= p * p;
+
+  return CurvilinearParameters(std::make_optional(std::move(trackCov)), p0,
+                               momentum, charge, 0.);
+}
+
+}  // namespace Acts
@@ -30,6 +30,15 @@ struct LinCircle {
   float U;
   float V;
 };
+
+/// Platform tag to select the vectorized CPU triplet search, which evaluates
+/// several top space points at once. It uses AVX-512 if enabled at compile
+/// time, e.g. with -march=native, and otherwise AVX2 on x86 CPUs that support
+/// it, without requiring AVX2 at compile time. It falls back to the default
+/// scalar search if neither is available. The found seeds are identical to
+/// the default platform.
+class CpuSimd;
+
 template <typename external_spacepoint_t, typename platform_t = void*>
 class Seedfinder {
   ///////////////////////////////////////////////////////////////////
@@ -7,6 +7,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/detail/TripletCompatibility.hpp"
 
 #include <cmath>
 #include <numeric>
@@ -39,6 +40,18 @@ template <typename sp_range_t>
 std::vector<Seed<external_spacepoint_t>>
 Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+#if defined(ACTS_SEEDING_DETAIL_SIMD)
+  constexpr bool useSimd = std::is_same_v<platform_t, CpuSimd>;
+  // the instruction set must also be supported by the executing CPU
+  const bool runSimd = useSimd and detail::simdSupported();
+  // structure-of-arrays copy of the top LinCircles for the vectorized search
+  detail::LinCircleSoA linCircleTopSoA;
+#else
+  // without a SIMD instruction set the branching scalar loop is faster than
+  // evaluating all cuts for every top space point
+  const bool runSimd = false;
+#endif
+
   std::vector<Seed<external_spacepoint_t>> outputVec;
   for (auto spM : middleSPs) {
     float rM = spM->radius();
@@ -113,6 +126,11 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     std::vector<LinCircle> linCircleTop;
     transformCoordinates(compatBottomSP, *spM, true, linCircleBottom);
     transformCoordinates(compatTopSP, *spM, false, linCircleTop);
+#if defined(ACTS_SEEDING_DETAIL_SIMD)
+    if (runSimd) {
+      linCircleTopSoA.assign(linCircleTop);
+    }
+#endif
 
     // create vectors here to avoid reallocation in each loop
     std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
@@ -124,6 +142,8 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
         seedsPerSpM;
     size_t numBotSP = compatBottomSP.size();
     size_t numTopSP = compatTopSP.size();
+    // the scalar search is skipped if the vectorized one already ran
+    size_t numScalarTopSP = runSimd ? 0 : numTopSP;
 
     for (size_t b = 0; b < numBotSP; b++) {
       auto lb = linCircleBottom[b];
@@ -154,7 +174,30 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
       topSpVec.clear();
       curvatures.clear();
       impactParameters.clear();
-      for (size_t t = 0; t < numTopSP; t++) {
+#if defined(ACTS_SEEDING_DETAIL_SIMD)
+      if constexpr (useSimd) {
+        if (runSimd) {
+          detail::TripletCuts cuts{Ub,
+                                   Vb,
+                                   cotThetaB,
+                                   ErB,
+                                   iDeltaRB,
+                                   iSinTheta2,
+                                   scatteringInRegion2,
+                                   rM,
+                                   varianceRM,
+                                   varianceZM,
+                                   m_config.minHelixDiameter2,
+                                   m_config.pT2perRadius,
+                                   m_config.sigmaScattering,
+                                   m_config.impactMax};
+          detail::compatibleTopSpacePoints<detail::SimdOps>(
+              linCircleTopSoA, compatTopSP, cuts, topSpVec, curvatures,
+              impactParameters);
+        }
+      }
+#endif
+      for (size_t t = 0; t < numScalarTopSP; t++) {
         auto lt = linCircleTop[t];
 
         // add errors of spB-spM and spM-spT pairs and add the correlation term
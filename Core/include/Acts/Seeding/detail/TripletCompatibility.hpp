@@ -0,0 +1,397 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/AlignedAllocator.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// The AVX2 implementation is compiled function-wise for AVX2, such that the
+// rest of the code does not require it and can run on any x86 CPU. It must
+// only be called after checking the CPU support with simdSupported().
+// Both helper macros are undefined again at the end of this header.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ACTS_SEEDING_AVX2
+#define ACTS_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__AVX2__)
+#define ACTS_SEEDING_AVX2
+#define ACTS_TARGET_AVX2
+#else
+#define ACTS_TARGET_AVX2
+#endif
+
+// The structure-of-arrays container and the vectorized kernel only exist if
+// a SIMD implementation is available. The Seedfinder uses this macro to skip
+// the structure-of-arrays copy otherwise.
+#if defined(ACTS_SEEDING_AVX2) || defined(__AVX512F__)
+#define ACTS_SEEDING_DETAIL_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Acts {
+
+struct LinCircle;
+
+namespace detail {
+
+#if defined(ACTS_SEEDING_DETAIL_SIMD)
+/// Structure-of-arrays version of a LinCircle container.
+///
+/// Each member array is 64 byte aligned and padded with zeros to a multiple
+/// of the widest supported SIMD register, such that the triplet kernel can
+/// always load full registers.
+struct LinCircleSoA {
+  static constexpr size_t kPadding = 16;
+
+  using Array = std::vector<float, AlignedAllocator<float, 64>>;
+
+  Array Zo;
+  Array cotTheta;
+  Array iDeltaR;
+  Array Er;
+  Array U;
+  Array V;
+
+  /// Number of stored entries, without the padding
+  size_t size() const { return m_size; }
+
+  /// Replace the content with the given LinCircle entries.
+  ///
+  /// @tparam lin_circle_container_t Container of LinCircle objects
+  /// @note The allocated memory is kept and reused
+  template <typename lin_circle_container_t>
+  void assign(const lin_circle_container_t& linCircles) {
+    m_size = linCircles.size();
+    const size_t padded = ((m_size + kPadding - 1) / kPadding) * kPadding;
+    for (Array* array : {&Zo, &cotTheta, &iDeltaR, &Er, &U, &V}) {
+      array->assign(padded, 0.f);
+    }
+    for (size_t i = 0; i < m_size; ++i) {
+      Zo[i] = linCircles[i].Zo;
+      cotTheta[i] = linCircles[i].cotTheta;
+      iDeltaR[i] = linCircles[i].iDeltaR;
+      Er[i] = linCircles[i].Er;
+      U[i] = linCircles[i].U;
+      V[i] = linCircles[i].V;
+    }
+  }
+
+ private:
+  size_t m_size = 0;
+};
+
+/// Quantities of the fixed bottom and middle space point and the derived
+/// configuration values that enter the triplet cuts.
+struct TripletCuts {
+  // bottom-middle duplet
+  float Ub;
+  float Vb;
+  float cotThetaB;
+  float ErB;
+  float iDeltaRB;
+  float iSinTheta2;
+  float scatteringInRegion2;
+  // middle space point
+  float rM;
+  float varianceRM;
+  float varianceZM;
+  // configuration
+  float minHelixDiameter2;
+  float pT2perRadius;
+  float sigmaScattering;
+  float impactMax;
+};
+#endif
+
+/// Single lane implementation of the triplet kernel operations
+struct ScalarOps {
+  static constexpr size_t kWidth = 1;
+  using Vector = float;
+  using Mask = bool;
+
+  static Vector load(const float* p) { return *p; }
+  static void store(float* p, Vector v) { *p = v; }
+  static Vector broadcast(float x) { return x; }
+  static Vector add(Vector a, Vector b) { return a + b; }
+  static Vector sub(Vector a, Vector b) { return a - b; }
+  static Vector mul(Vector a, Vector b) { return a * b; }
+  static Vector div(Vector a, Vector b) { return a / b; }
+  static Vector sqrt(Vector a) { return std::sqrt(a); }
+  static Vector abs(Vector a) { return std::abs(a); }
+  static Mask greater(Vector a, Vector b) { return a > b; }
+  static Mask less(Vector a, Vector b) { return a < b; }
+  static Mask lessEqual(Vector a, Vector b) { return a <= b; }
+  static Mask equal(Vector a, Vector b) { return a == b; }
+  static Mask both(Mask a, Mask b) { return a and b; }
+  static Mask either(Mask a, Mask b) { return a or b; }
+  static unsigned bits(Mask m) { return m ? 1u : 0u; }
+};
+
+#if defined(ACTS_SEEDING_AVX2)
+/// Eight lane implementation using AVX2
+struct Avx2Ops {
+  static constexpr size_t kWidth = 8;
+  using Vector = __m256;
+  using Mask = __m256;
+
+  ACTS_TARGET_AVX2 static Vector load(const float* p) {
+    return _mm256_load_ps(p);
+  }
+  ACTS_TARGET_AVX2 static void store(float* p, Vector v) {
+    _mm256_store_ps(p, v);
+  }
+  ACTS_TARGET_AVX2 static Vector broadcast(float x) {
+    return _mm256_set1_ps(x);
+  }
+  ACTS_TARGET_AVX2 static Vector add(Vector a, Vector b) {
+    return _mm256_add_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static Vector sub(Vector a, Vector b) {
+    return _mm256_sub_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static Vector mul(Vector a, Vector b) {
+    return _mm256_mul_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static Vector div(Vector a, Vector b) {
+    return _mm256_div_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static Vector sqrt(Vector a) { return _mm256_sqrt_ps(a); }
+  ACTS_TARGET_AVX2 static Vector abs(Vector a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a);
+  }
+  // ordered comparisons, i.e. false for NaN as in the scalar code
+  ACTS_TARGET_AVX2 static Mask greater(Vector a, Vector b) {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  }
+  ACTS_TARGET_AVX2 static Mask less(Vector a, Vector b) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+  }
+  ACTS_TARGET_AVX2 static Mask lessEqual(Vector a, Vector b) {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+  }
+  ACTS_TARGET_AVX2 static Mask equal(Vector a, Vector b) {
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  }
+  ACTS_TARGET_AVX2 static Mask both(Mask a, Mask b) {
+    return _mm256_and_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static Mask either(Mask a, Mask b) {
+    return _mm256_or_ps(a, b);
+  }
+  ACTS_TARGET_AVX2 static unsigned bits(Mask m) {
+    return static_cast<unsigned>(_mm256_movemask_ps(m));
+  }
+};
+#endif
+
+#if defined(__AVX512F__)
+/// Sixteen lane implementation using AVX-512
+struct Avx512Ops {
+  static constexpr size_t kWidth = 16;
+  using Vector = __m512;
+  using Mask = __mmask16;
+
+  static Vector load(const float* p) { return _mm512_load_ps(p); }
+  static void store(float* p, Vector v) { _mm512_store_ps(p, v); }
+  static Vector broadcast(float x) { return _mm512_set1_ps(x); }
+  static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+  static Vector sub(Vector a, Vector b) { return _mm512_sub_ps(a, b); }
+  static Vector mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+  static Vector div(Vector a, Vector b) { return _mm512_div_ps(a, b); }
+  static Vector sqrt(Vector a) { return _mm512_sqrt_ps(a); }
+  static Vector abs(Vector a) { return _mm512_abs_ps(a); }
+  // ordered comparisons, i.e. false for NaN as in the scalar code
+  static Mask greater(Vector a, Vector b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+  }
+  static Mask less(Vector a, Vector b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+  }
+  static Mask lessEqual(Vector a, Vector b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);
+  }
+  static Mask equal(Vector a, Vector b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+  }
+  static Mask both(Mask a, Mask b) { return a & b; }
+  static Mask either(Mask a, Mask b) { return a | b; }
+  static unsigned bits(Mask m) { return static_cast<unsigned>(m); }
+};
+#endif
+
+/// The widest available SIMD implementation
+#if defined(__AVX512F__)
+using SimdOps = Avx512Ops;
+#elif defined(ACTS_SEEDING_AVX2)
+using SimdOps = Avx2Ops;
+#else
+using SimdOps = ScalarOps;
+#endif
+
+/// Whether the executing CPU supports the SIMD implementation.
+inline bool simdSupported() {
+#if defined(__AVX512F__) || defined(__AVX2__)
+  // required by the whole compilation anyway
+  return true;
+#elif defined(ACTS_SEEDING_AVX2)
+  static const bool supported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  return supported;
+#else
+  return false;
+#endif
+}
+
+#if defined(ACTS_SEEDING_DETAIL_SIMD)
+/// Find all top space points that form a compatible triplet with a fixed
+/// bottom-middle duplet.
+///
+/// @tparam ops_t SIMD implementation, e.g. Avx2Ops
+/// @tparam sp_t Space point type
+///
+/// @param topLinCircles Transformed coordinates of the top space points
+/// @param topSPs The top space points
+/// @param cuts Quantities of the bottom-middle duplet and the configuration
+/// @param [out] compatibleTopSPs Compatible top space points are appended
+/// @param [out] curvatures Curvature of each compatible triplet is appended
+/// @param [out] impactParameters Impact parameter of each compatible triplet
+///        is appended
+///
+/// Several top space points are evaluated at once. Each cut is computed with
+/// exactly the same floating point operations as in the scalar Seedfinder
+/// loop and the compatible top space points are appended in their input
+/// order, i.e. the result is identical to the scalar loop as long as the
+/// compiler does not contract operations, e.g. into fused multiply-adds.
+///
+/// @note The function is compiled for AVX2 on x86 and must only be called if
+///       simdSupported() is true.
+template <typename ops_t, typename sp_t>
+ACTS_TARGET_AVX2 void compatibleTopSpacePoints(
+    const LinCircleSoA& topLinCircles, const std::vector<const sp_t*>& topSPs,
+    const TripletCuts& cuts, std::vector<const sp_t*>& compatibleTopSPs,
+    std::vector<float>& curvatures, std::vector<float>& impactParameters) {
+  using Ops = ops_t;
+  using Vector = typename Ops::Vector;
+  using Mask = typename Ops::Mask;
+  constexpr size_t kWidth = Ops::kWidth;
+  static_assert(LinCircleSoA::kPadding % kWidth == 0,
+                "LinCircle padding must be a multiple of the SIMD width");
+
+  const Vector zero = Ops::broadcast(0.f);
+  const Vector one = Ops::broadcast(1.f);
+  const Vector two = Ops::broadcast(2.f);
+  const Vector four = Ops::broadcast(4.f);
+  const Vector Ub = Ops::broadcast(cuts.Ub);
+  const Vector Vb = Ops::broadcast(cuts.Vb);
+  const Vector cotThetaB = Ops::broadcast(cuts.cotThetaB);
+  const Vector ErB = Ops::broadcast(cuts.ErB);
+  const Vector iDeltaRB = Ops::broadcast(cuts.iDeltaRB);
+  const Vector iSinTheta2 = Ops::broadcast(cuts.iSinTheta2);
+  const Vector scatteringInRegion2 = Ops::broadcast(cuts.scatteringInRegion2);
+  const Vector rM = Ops::broadcast(cuts.rM);
+  const Vector varianceRM = Ops::broadcast(cuts.varianceRM);
+  const Vector varianceZM = Ops::broadcast(cuts.varianceZM);
+  const Vector minHelixDiameter2 = Ops::broadcast(cuts.minHelixDiameter2);
+  const Vector pT2perRadius = Ops::broadcast(cuts.pT2perRadius);
+  const Vector sigmaScattering = Ops::broadcast(cuts.sigmaScattering);
+  const Vector impactMax = Ops::broadcast(cuts.impactMax);
+
+  alignas(64) float curvatureLanes[kWidth];
+  alignas(64) float impactLanes[kWidth];
+
+  const size_t numTopSP = topLinCircles.size();
+  for (size_t t = 0; t < numTopSP; t += kWidth) {
+    const Vector ltEr = Ops::load(topLinCircles.Er.data() + t);
+    const Vector ltCotTheta = Ops::load(topLinCircles.cotTheta.data() + t);
+    const Vector ltIDeltaR = Ops::load(topLinCircles.iDeltaR.data() + t);
+    const Vector ltU = Ops::load(topLinCircles.U.data() + t);
+    const Vector ltV = Ops::load(topLinCircles.V.data() + t);
+
+    // add errors of spB-spM and spM-spT pairs and add the correlation term
+    // for errors on spM
+    const Vector error2 = Ops::add(
+        Ops::add(ltEr, ErB),
+        Ops::mul(
+            Ops::mul(
+                Ops::mul(two, Ops::add(Ops::mul(Ops::mul(cotThetaB, ltCotTheta),
+                                                varianceRM),
+                                       varianceZM)),
+                iDeltaRB),
+            ltIDeltaR));
+
+    const Vector deltaCotTheta = Ops::sub(cotThetaB, ltCotTheta);
+    const Vector deltaCotTheta2 = Ops::mul(deltaCotTheta, deltaCotTheta);
+    // scattering is only compared if the error is smaller than the difference
+    // in theta
+    const Mask checkScattering =
+        Ops::greater(Ops::sub(deltaCotTheta2, error2), zero);
+    const Vector error = Ops::sqrt(error2);
+    const Vector dCotThetaMinusError2 = Ops::sub(
+        Ops::add(deltaCotTheta2, error2),
+        Ops::mul(Ops::mul(two, Ops::abs(deltaCotTheta)), error));
+    Mask reject =
+        Ops::both(checkScattering,
+                  Ops::greater(dCotThetaMinusError2, scatteringInRegion2));
+
+    // protects against division by 0
+    const Vector dU = Ops::sub(ltU, Ub);
+    reject = Ops::either(reject, Ops::equal(dU, zero));
+    const Vector A = Ops::div(Ops::sub(ltV, Vb), dU);
+    const Vector S2 = Ops::add(one, Ops::mul(A, A));
+    const Vector B = Ops::sub(Vb, Ops::mul(A, Ub));
+    const Vector B2 = Ops::mul(B, B);
+    // calculated radius must not be smaller than minimum radius
+    reject = Ops::either(reject,
+                         Ops::less(S2, Ops::mul(B2, minHelixDiameter2)));
+    // scattering for p(T) calculated from seed curvature
+    const Vector iHelixDiameter2 = Ops::div(B2, S2);
+    const Vector pT2scatter =
+        Ops::mul(Ops::mul(four, iHelixDiameter2), pT2perRadius);
+    const Vector p2scatter = Ops::mul(pT2scatter, iSinTheta2);
+    reject = Ops::either(
+        reject,
+        Ops::both(checkScattering,
+                  Ops::greater(dCotThetaMinusError2,
+                               Ops::mul(Ops::mul(p2scatter, sigmaScattering),
+                                        sigmaScattering))));
+    const Vector Im = Ops::abs(Ops::mul(Ops::sub(A, Ops::mul(B, rM)), rM));
+
+    unsigned accepted =
+        Ops::bits(Ops::lessEqual(Im, impactMax)) & ~Ops::bits(reject);
+    // ignore the padding lanes behind the last top space point
+    if (numTopSP - t < kWidth) {
+      accepted &= (1u << (numTopSP - t)) - 1u;
+    }
+    if (accepted == 0u) {
+      continue;
+    }
+
+    Ops::store(curvatureLanes, Ops::div(B, Ops::sqrt(S2)));
+    Ops::store(impactLanes, Im);
+    for (size_t lane = 0; lane < kWidth; ++lane) {
+      if ((accepted >> lane) & 1u) {
+        compatibleTopSPs.push_back(topSPs[t + lane]);
+        curvatures.push_back(curvatureLanes[lane]);
+        impactParameters.push_back(impactLanes[lane]);
+      }
+    }
+  }
+}
+#endif
+
+}  // namespace detail
+}  // namespace Acts
+
+#undef ACTS_SEEDING_AVX2
+#undef ACTS_TARGET_AVX2
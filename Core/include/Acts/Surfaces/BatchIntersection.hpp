@@ -0,0 +1,140 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <vector>
+
+namespace Acts {
+
+class CylinderSurface;
+class PlaneSurface;
+
+/// @struct RayBlock
+///
+/// A block of track positions and directions in structure-of-arrays layout,
+/// i.e. one contiguous array per coordinate.
+struct RayBlock {
+  Eigen::ArrayXd x, y, z;
+  Eigen::ArrayXd dx, dy, dz;
+
+  /// Constructor
+  ///
+  /// @param size The number of tracks in the block
+  explicit RayBlock(size_t size = 0) { resize(size); }
+
+  /// The number of tracks
+  size_t size() const { return x.size(); }
+
+  /// Change the number of tracks, the content is undefined afterwards
+  void resize(size_t size) {
+    for (auto* array : {&x, &y, &z, &dx, &dy, &dz}) {
+      array->resize(size);
+    }
+  }
+
+  /// Set one track
+  ///
+  /// @param i The index of the track
+  /// @param position The global position of the track
+  /// @param direction The direction of the track
+  void set(size_t i, const Vector3D& position, const Vector3D& direction) {
+    x[i] = position.x();
+    y[i] = position.y();
+    z[i] = position.z();
+    dx[i] = direction.x();
+    dy[i] = direction.y();
+    dz[i] = direction.z();
+  }
+};
+
+/// @struct IntersectionBlock
+///
+/// The intersections of a block of tracks with one surface in
+/// structure-of-arrays layout.
+struct IntersectionBlock {
+  Eigen::ArrayXd x, y, z;
+  Eigen::ArrayXd pathLength;
+  std::vector<Intersection::Status> status;
+
+  /// The number of intersections
+  size_t size() const { return status.size(); }
+
+  /// Change the number of intersections
+  void resize(size_t size) {
+    for (auto* array : {&x, &y, &z, &pathLength}) {
+      array->resize(size);
+    }
+    status.resize(size);
+  }
+
+  /// One intersection
+  Intersection operator[](size_t i) const {
+    return Intersection(Vector3D(x[i], y[i], z[i]), pathLength[i], status[i]);
+  }
+};
+
+/// @brief Intersections of many tracks with the same surface
+///
+/// The functions give the same (primary) intersection as the intersect
+/// method of the surface for every track of the block. The intersection
+/// maths is done on whole arrays, which the compiler can vectorize. Rectangle
+/// bounds of planes and the z bounds of full cylinders are checked on the
+/// arrays as well for absolute boundary checks, all other bounds fall back to
+/// the per-track check of the surface.
+namespace BatchIntersection {
+
+/// Intersect a block of tracks with a plane surface
+///
+/// @param gctx The current geometry context object, e.g. alignment
+/// @param surface The plane surface
+/// @param rays The positions and directions of the tracks
+/// @param bcheck The boundary check directive
+/// @param [out] intersections The intersections, resized to the block
+void intersect(const GeometryContext& gctx, const PlaneSurface& surface,
+               const RayBlock& rays, const BoundaryCheck& bcheck,
+               IntersectionBlock& intersections);
+
+/// Intersect a block of tracks with a cylinder surface
+///
+/// @param gctx The current geometry context object, e.g. alignment
+/// @param surface The cylinder surface
+/// @param rays The positions and directions of the tracks
+/// @param bcheck The boundary check directive
+/// @param [out] intersections The intersections, resized to the block
+void intersect(const GeometryContext& gctx, const CylinderSurface& surface,
+               const RayBlock& rays, const BoundaryCheck& bcheck,
+               IntersectionBlock& intersections);
+
+/// Intersect a block of tracks with surfaces of the same type
+///
+/// @tparam surface_t The surface type, i.e. PlaneSurface or CylinderSurface
+///
+/// @param gctx The current geometry context object, e.g. alignment
+/// @param surfaces The surfaces
+/// @param rays The positions and directions of the tracks
+/// @param bcheck The boundary check directive
+/// @param [out] intersections One block of intersections per surface
+template <typename surface_t>
+void intersect(const GeometryContext& gctx,
+               const std::vector<const surface_t*>& surfaces,
+               const RayBlock& rays, const BoundaryCheck& bcheck,
+               std::vector<IntersectionBlock>& intersections) {
+  intersections.resize(surfaces.size());
+  for (size_t is = 0; is < surfaces.size(); ++is) {
+    intersect(gctx, *surfaces[is], rays, bcheck, intersections[is]);
+  }
+}
+
+}  // namespace BatchIntersection
+}  // namespace Acts
@@ -67,7 +67,8 @@ struct CKFSourceLinkSelector {
   /// the given track parameter on a surface
   ///
   /// @tparam calibrator_t The type of calibrator
-  /// @tparam source_link_t The type of source link
+  /// @tparam source_link_range_t The type of the source link range, e.g. a
+  /// @c std::vector or a @c SourceLinkIndex range
   ///
   /// @param calibrator The measurement calibrator
   /// @param predictedParams The predicted track parameter on a surface
@@ -78,10 +79,10 @@ struct CKFSourceLinkSelector {
   /// link candidates
   /// @param isOutlier The indicator for outlier or not
   ///
-  template <typename calibrator_t, typename source_link_t>
+  template <typename calibrator_t, typename source_link_range_t>
   Result<void> operator()(
       const calibrator_t& calibrator, const BoundParameters& predictedParams,
-      const std::vector<source_link_t>& sourcelinks,
+      const source_link_range_t& sourcelinks,
       std::vector<std::pair<size_t, double>>& sourcelinkChi2,
       std::vector<size_t>& sourcelinkCandidateIndices, bool& isOutlier) const {
     ACTS_VERBOSE("Invoked CKFSourceLinkSelector");
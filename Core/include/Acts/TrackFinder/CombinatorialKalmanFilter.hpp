@@ -15,6 +15,7 @@
 #include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Fitter/detail/VoidKalmanComponents.hpp"
@@ -34,11 +35,15 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/Tracing.hpp"
 
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace Acts {
 
@@ -174,6 +179,62 @@ struct CombinatorialKalmanFilterResult {
   Result<void> result{Result<void>::success()};
 };
 
+/// @brief Reusable temporary storage for the CombinatorialKalmanFilter
+///
+/// When given to the track finding, the intermediate source link selection
+/// buffers, the list of active tips, the source link lookup and the
+/// trajectory holding all explored branches are taken from here instead of
+/// the per-call result. Only the states reachable from the tips of the found
+/// tracks are copied into the result, using the index buffers kept here. One
+/// instance can be reused by consecutive track finding calls, e.g. for all
+/// seeds processed by the same thread, to avoid re-allocating them. It must
+/// not be shared by concurrent calls.
+///
+/// @tparam source_link_t Source link type
+///
+/// @note The propagator state is created by the propagation and is not reused.
+template <typename source_link_t>
+struct CombinatorialKalmanFilterScratch {
+  // Index and chi2 of intermediate source link candidates
+  std::vector<std::pair<size_t, double>> sourcelinkChi2;
+
+  // Index of final source link candidates
+  std::vector<size_t> sourcelinkCandidateIndices;
+
+  // The indices of the 'tip' of the unfinished tracks
+  std::vector<std::pair<size_t, CombinatorialKalmanFilterTipState>> activeTips;
+
+  // The indices of source links in the trajectory below
+  std::unordered_map<const Surface*, std::unordered_map<size_t, size_t>>
+      sourcelinkTips;
+
+  // All track states, including the ones of abandoned branches
+  MultiTrajectory<source_link_t> trajectory;
+
+  // Index in the result trajectory for each state of the trajectory above
+  std::vector<size_t> copiedStates;
+
+  // States of a branch that still have to be copied, last state first
+  std::vector<size_t> branch;
+
+  // Fitted parameters detached from the result while their tips are remapped
+  std::vector<
+      typename std::unordered_map<size_t, BoundParameters>::node_type>
+      fittedParameters;
+
+  /// Clear the content but keep the allocated capacity
+  void clear() {
+    sourcelinkChi2.clear();
+    sourcelinkCandidateIndices.clear();
+    activeTips.clear();
+    // keep the per-surface maps to reuse their buckets
+    for (auto& [surface, tips] : sourcelinkTips) {
+      tips.clear();
+    }
+    trajectory.reset();
+  }
+};
+
 /// @brief CombinatorialKalmanFilter implementation of Acts as a plugin
 ///
 /// to the Propgator
@@ -258,9 +319,11 @@ class CombinatorialKalmanFilter {
     /// The target surface
     const Surface* targetSurface = nullptr;
 
-    /// Allows retrieving measurements for a surface
-    std::unordered_map<const Surface*, std::vector<source_link_t>>
-        inputMeasurements;
+    /// Allows retrieving measurements for a surface; not owned
+    const SourceLinkIndex<source_link_t>* inputMeasurements = nullptr;
+
+    /// Optional reusable temporary buffers; not owned
+    CombinatorialKalmanFilterScratch<source_link_t>* scratch = nullptr;
 
     /// Whether to consider multiple scattering.
     bool multipleScattering = true;
@@ -333,17 +396,17 @@ class CombinatorialKalmanFilter {
         // Record the tips on current surface as trajectory entry indices
         // (taking advantage of fact that those tips are consecutive in list of
         // active tips) and remove those tips from active tips
-        if (not result.activeTips.empty()) {
+        if (not activeTips(result).empty()) {
           // The last active tip
-          const auto& lastActiveTip = result.activeTips.back().first;
+          const auto& lastActiveTip = activeTips(result).back().first;
           // Get the index of previous state
           const auto& iprevious =
-              result.fittedStates.getTrackState(lastActiveTip).previous();
+              fittedStates(result).getTrackState(lastActiveTip).previous();
           // Find the track states which have the same previous state and remove
           // them from active tips
-          while (not result.activeTips.empty()) {
-            const auto& [currentTip, tipState] = result.activeTips.back();
-            if (result.fittedStates.getTrackState(currentTip).previous() !=
+          while (not activeTips(result).empty()) {
+            const auto& [currentTip, tipState] = activeTips(result).back();
+            if (fittedStates(result).getTrackState(currentTip).previous() !=
                 iprevious) {
               break;
             }
@@ -357,18 +420,18 @@ class CombinatorialKalmanFilter {
               result.trackTips.emplace_back(currentTip);
             }
             // Remove the tip from list of active tips
-            result.activeTips.erase(result.activeTips.end() - 1);
+            activeTips(result).erase(activeTips(result).end() - 1);
           }
         }
         // If no more active tip, done with forward filtering; Otherwise, reset
         // propagation state to track state at last tip of active tips
-        if (result.activeTips.empty()) {
+        if (activeTips(result).empty()) {
           ACTS_VERBOSE("Forward Kalman filtering finds "
                        << result.trackTips.size() << " tracks");
           result.forwardFiltered = true;
         } else {
           ACTS_VERBOSE("Propagation jumps to branch with tip = "
-                       << result.activeTips.back().first);
+                       << activeTips(result).back().first);
           reset(state, stepper, result);
         }
       }
@@ -458,7 +521,7 @@ class CombinatorialKalmanFilter {
       // Remember the propagation state has been reset
       result.reset = true;
       auto currentState =
-          result.fittedStates.getTrackState(result.activeTips.back().first);
+          fittedStates(result).getTrackState(activeTips(result).back().first);
 
       // Reset the navigation state
       state.navigation = typename propagator_t::NavigatorState();
@@ -503,8 +566,8 @@ class CombinatorialKalmanFilter {
       size_t nBranchesOnSurface = 0;
 
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface);
-      if (sourcelink_it != inputMeasurements.end()) {
+      auto sourcelinks = inputMeasurements->find(*surface);
+      if (not sourcelinks.empty()) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface " << surface->geoID()
                                             << " detected.");
@@ -516,17 +579,20 @@ class CombinatorialKalmanFilter {
         auto boundState = stepper.boundState(state.stepping, *surface);
         auto boundParams = std::get<BoundParameters>(boundState);
 
-        // Get all source links on surface
-        auto& sourcelinks = sourcelink_it->second;
-
         // Invoke the source link selector to select source links for either
         // measurements or outlier.
         // Calibrator is passed to the selector because
         // selection has to be done based on calibrated measurement
+        // Use the external temporary buffers if available
+        auto& sourcelinkChi2 = (scratch != nullptr) ? scratch->sourcelinkChi2
+                                                    : result.sourcelinkChi2;
+        auto& sourcelinkCandidateIndices =
+            (scratch != nullptr) ? scratch->sourcelinkCandidateIndices
+                                 : result.sourcelinkCandidateIndices;
         bool isOutlier = false;
         auto sourcelinkSelectionRes = m_sourcelinkSelector(
-            m_calibrator, boundParams, sourcelinks, result.sourcelinkChi2,
-            result.sourcelinkCandidateIndices, isOutlier);
+            m_calibrator, boundParams, sourcelinks, sourcelinkChi2,
+            sourcelinkCandidateIndices, isOutlier);
         if (!sourcelinkSelectionRes.ok()) {
           ACTS_ERROR("Selection of source links failed: "
                      << sourcelinkSelectionRes.error());
@@ -537,17 +603,17 @@ class CombinatorialKalmanFilter {
         // The states created on this surface will have the common previous tip
         size_t prevTip = SIZE_MAX;
         TipState prevTipState;
-        if (not result.activeTips.empty()) {
-          prevTip = result.activeTips.back().first;
-          prevTipState = result.activeTips.back().second;
+        if (not activeTips(result).empty()) {
+          prevTip = activeTips(result).back().first;
+          prevTipState = activeTips(result).back().second;
           // New state is to be added. Remove the last tip from active tips
-          result.activeTips.erase(result.activeTips.end() - 1);
+          activeTips(result).erase(activeTips(result).end() - 1);
         }
 
         // Remember the tip of the neighbor state on this surface
         size_t neighborTip = SIZE_MAX;
         // Loop over the selected source links
-        for (const auto& index : result.sourcelinkCandidateIndices) {
+        for (const auto& index : sourcelinkCandidateIndices) {
           // Determine if predicted parameter is already contained in
           // neighboring state
           bool isPredictedShared = (neighborTip != SIZE_MAX);
@@ -556,8 +622,8 @@ class CombinatorialKalmanFilter {
           // contained in other track state
           bool isSourcelinkShared = false;
           size_t sharedTip = SIZE_MAX;
-          auto sourcelinkTips_it = result.sourcelinkTips.find(surface);
-          if (sourcelinkTips_it != result.sourcelinkTips.end()) {
+          auto sourcelinkTips_it = sourcelinkTips(result).find(surface);
+          if (sourcelinkTips_it != sourcelinkTips(result).end()) {
             auto& sourcelinkTipsOnSurface = sourcelinkTips_it->second;
             auto index_it = sourcelinkTipsOnSurface.find(index);
             if (index_it != sourcelinkTipsOnSurface.end()) {
@@ -587,7 +653,7 @@ class CombinatorialKalmanFilter {
             const auto& [currentTip, tipState] = addStateRes.value();
             // Remember the track state tip for this stored source link
             if (not isSourcelinkShared) {
-              auto& sourcelinkTipsOnSurface = result.sourcelinkTips[surface];
+              auto& sourcelinkTipsOnSurface = sourcelinkTips(result)[surface];
               sourcelinkTipsOnSurface.emplace(index, currentTip);
             }
             // Remember the tip of neighbor state on this surface
@@ -596,8 +662,8 @@ class CombinatorialKalmanFilter {
             // Check if need to stop this branch
             if (not m_branchStopper(tipState)) {
               // Remember the active tip and its state
-              result.activeTips.emplace_back(std::move(currentTip),
-                                             std::move(tipState));
+              activeTips(result).emplace_back(std::move(currentTip),
+                                              std::move(tipState));
               // Record the number of branches on surface
               nBranchesOnSurface++;
             }
@@ -610,8 +676,8 @@ class CombinatorialKalmanFilter {
                                                          << " branches");
           // Update stepping state using filtered parameters of last track
           // state on this surface
-          auto ts =
-              result.fittedStates.getTrackState(result.activeTips.back().first);
+          auto ts = fittedStates(result).getTrackState(
+              activeTips(result).back().first);
           stepper.update(state.stepping,
                          MultiTrajectoryHelpers::freeFiltered(
                              state.options.geoContext, ts),
@@ -619,7 +685,7 @@ class CombinatorialKalmanFilter {
           ACTS_VERBOSE("Stepping state is updated with filtered parameter: \n"
                        << ts.filtered().transpose()
                        << " of track state with tip = "
-                       << result.activeTips.back().first);
+                       << activeTips(result).back().first);
         }
         // Update state and stepper with post material effects
         materialInteractor(surface, state, stepper, postUpdate);
@@ -631,9 +697,9 @@ class CombinatorialKalmanFilter {
         // Retrieve the previous tip and its state
         size_t prevTip = SIZE_MAX;
         TipState tipState;
-        if (not result.activeTips.empty()) {
-          prevTip = result.activeTips.back().first;
-          tipState = result.activeTips.back().second;
+        if (not activeTips(result).empty()) {
+          prevTip = activeTips(result).back().first;
+          tipState = activeTips(result).back().second;
         }
 
         // The surface could be either sensitive or passive
@@ -650,7 +716,7 @@ class CombinatorialKalmanFilter {
         if (tipState.nMeasurements > 0 and
             (isSensitive or (not isSensitive and smoothing))) {
           // New state is to be added. Remove the last tip from active tips now
-          result.activeTips.erase(result.activeTips.end() - 1);
+          activeTips(result).erase(activeTips(result).end() - 1);
 
           // No source links on surface, add either hole or passive material
           // TrackState. No storage allocation for uncalibrated/calibrated
@@ -680,8 +746,8 @@ class CombinatorialKalmanFilter {
           // Check the branch
           if (not m_branchStopper(tipState)) {
             // Remember the active tip and its state
-            result.activeTips.emplace_back(std::move(currentTip),
-                                           std::move(tipState));
+            activeTips(result).emplace_back(std::move(currentTip),
+                                            std::move(tipState));
           } else {
             // No branch on this surface
             nBranchesOnSurface = 0;
@@ -698,9 +764,9 @@ class CombinatorialKalmanFilter {
       // Reset current tip if there is no branch on current surface
       if (nBranchesOnSurface == 0) {
         ACTS_DEBUG("Branch on surface " << surface->geoID() << " is stopped");
-        if (not result.activeTips.empty()) {
+        if (not activeTips(result).empty()) {
           ACTS_VERBOSE("Propagation jumps to branch with tip = "
-                       << result.activeTips.back().first);
+                       << activeTips(result).back().first);
           reset(state, stepper, result);
         } else {
           ACTS_VERBOSE("Stop forward Kalman filtering with "
@@ -737,10 +803,10 @@ class CombinatorialKalmanFilter {
       TipState tipState = prevTipState;
 
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = fittedStates(result).addTrackState(stateMask, prevTip);
 
       // Get the track state proxy
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = fittedStates(result).getTrackState(currentTip);
 
       auto [boundParams, jacobian, pathLength] = boundState;
 
@@ -748,7 +814,7 @@ class CombinatorialKalmanFilter {
       if ((not ACTS_CHECK_BIT(stateMask, TrackStatePropMask::Predicted)) and
           neighborTip != SIZE_MAX) {
         // The predicted parameter is already stored, just set the index
-        auto neighborState = result.fittedStates.getTrackState(neighborTip);
+        auto neighborState = fittedStates(result).getTrackState(neighborTip);
         trackStateProxy.data().ipredicted = neighborState.data().ipredicted;
       } else {
         trackStateProxy.predicted() = boundParams.parameters();
@@ -763,7 +829,7 @@ class CombinatorialKalmanFilter {
           sharedTip != SIZE_MAX) {
         // The uncalibrated are already stored, just set the
         // index
-        auto shared = result.fittedStates.getTrackState(sharedTip);
+        auto shared = fittedStates(result).getTrackState(sharedTip);
         trackStateProxy.data().iuncalibrated = shared.data().iuncalibrated;
       } else {
         trackStateProxy.uncalibrated() = sourcelink;
@@ -824,11 +890,11 @@ class CombinatorialKalmanFilter {
                         const BoundState& boundState, result_type& result,
                         size_t prevTip = SIZE_MAX) const {
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = fittedStates(result).addTrackState(stateMask, prevTip);
       ACTS_VERBOSE("Creating Hole track state with tip = " << currentTip);
 
       // now get track state proxy back
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = fittedStates(result).getTrackState(currentTip);
 
       // Set the track state flags
       auto& typeFlags = trackStateProxy.typeFlags();
@@ -868,13 +934,13 @@ class CombinatorialKalmanFilter {
                            result_type& result,
                            size_t prevTip = SIZE_MAX) const {
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = fittedStates(result).addTrackState(stateMask, prevTip);
       ACTS_VERBOSE(
           "Creating track state on in-sensitive material surface with tip = "
           << currentTip);
 
       // now get track state proxy back
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = fittedStates(result).getTrackState(currentTip);
 
       // Set the track state flags
       auto& typeFlags = trackStateProxy.typeFlags();
@@ -969,7 +1035,7 @@ class CombinatorialKalmanFilter {
       std::vector<size_t> measurementIndices;
       // Count track states to be smoothed
       size_t nStates = 0;
-      result.fittedStates.applyBackwards(currentTip, [&](auto st) {
+      fittedStates(result).applyBackwards(currentTip, [&](auto st) {
         bool isMeasurement =
             st.typeFlags().test(TrackStateFlag::MeasurementFlag);
         if (isMeasurement) {
@@ -994,7 +1060,7 @@ class CombinatorialKalmanFilter {
       ACTS_VERBOSE("Apply smoothing on " << nStates
                                          << " filtered track states.");
       // Smooth the track states
-      auto smoothRes = m_smoother(state.geoContext, result.fittedStates,
+      auto smoothRes = m_smoother(state.geoContext, fittedStates(result),
                                   measurementIndices.front());
       if (!smoothRes.ok()) {
         ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
@@ -1002,7 +1068,7 @@ class CombinatorialKalmanFilter {
       }
       // Obtain the smoothed parameters at first measurement state
       auto firstMeasurement =
-          result.fittedStates.getTrackState(measurementIndices.back());
+          fittedStates(result).getTrackState(measurementIndices.back());
 
       // Update the stepping parameters - in order to progress to destination
       ACTS_VERBOSE(
@@ -1022,6 +1088,33 @@ class CombinatorialKalmanFilter {
       return Result<void>::success();
     }
 
+    /// @brief The active tips, taken from the external temporary buffers if
+    /// available
+    ///
+    /// @param result is the mutable result state object
+    std::vector<std::pair<size_t, TipState>>& activeTips(
+        result_type& result) const {
+      return (scratch != nullptr) ? scratch->activeTips : result.activeTips;
+    }
+
+    /// @brief The indices of source links in the trajectory, taken from the
+    /// external temporary buffers if available
+    ///
+    /// @param result is the mutable result state object
+    std::unordered_map<const Surface*, std::unordered_map<size_t, size_t>>&
+    sourcelinkTips(result_type& result) const {
+      return (scratch != nullptr) ? scratch->sourcelinkTips
+                                  : result.sourcelinkTips;
+    }
+
+    /// @brief The trajectory that collects all track states, taken from the
+    /// external temporary buffers if available
+    ///
+    /// @param result is the mutable result state object
+    MultiTrajectory<source_link_t>& fittedStates(result_type& result) const {
+      return (scratch != nullptr) ? scratch->trajectory : result.fittedStates;
+    }
+
     /// Pointer to a logger that is owned by the parent,
     /// CombinatorialKalmanFilter
     const Logger* m_logger;
@@ -1081,6 +1174,9 @@ class CombinatorialKalmanFilter {
   /// It's
   /// @c calibrator_t's job to turn them into calibrated measurements used in
   /// the track finding.
+  /// @note The source links are indexed by surface on every call. Use the
+  /// overload taking a @c SourceLinkIndex to share the index between calls,
+  /// e.g. when finding tracks from multiple seeds in the same event.
   ///
   /// @return the output as an output track
   template <typename source_link_container_t, typename start_parameters_t,
@@ -1095,15 +1191,39 @@ class CombinatorialKalmanFilter {
     static_assert(SourceLinkConcept<SourceLink>,
                   "Source link does not fulfill SourceLinkConcept");
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
+    // To be able to find measurements later, we put them into an index
     ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::unordered_map<const Surface*, std::vector<SourceLink>>
-        inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      const Surface* srf = &sl.referenceSurface();
-      inputMeasurements[srf].emplace_back(sl);
-    }
+    SourceLinkIndex<SourceLink> inputMeasurements(sourcelinks);
+
+    return findTracks<SourceLink, start_parameters_t, parameters_t>(
+        inputMeasurements, sParameters, tfOptions);
+  }
+
+  /// Fit implementation of the foward filter, calls the
+  /// the forward filter and backward smoother
+  ///
+  /// @tparam source_link_t Source link type
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param inputMeasurements The fittable uncalibrated measurements indexed
+  /// by surface; it must outlive the call
+  /// @param sParameters The initial track parameters
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  /// finding
+  /// @param scratch Optional reusable temporary buffers
+  ///
+  /// @return the output as an output track
+  template <typename source_link_t, typename start_parameters_t,
+            typename parameters_t = BoundParameters>
+  Result<CombinatorialKalmanFilterResult<source_link_t>> findTracks(
+      const SourceLinkIndex<source_link_t>& inputMeasurements,
+      const start_parameters_t& sParameters,
+      const CombinatorialKalmanFilterOptions<source_link_selector_t>& tfOptions,
+      CombinatorialKalmanFilterScratch<source_link_t>* scratch =
+          nullptr) const {
+    ACTS_TRACE_SCOPE("CombinatorialKalmanFilter::findTracks");
+    using SourceLink = source_link_t;
 
     // Create the ActionList and AbortList
     using CombinatorialKalmanFilterAborter = Aborter<SourceLink, parameters_t>;
@@ -1123,7 +1243,12 @@ class CombinatorialKalmanFilter {
     auto& combKalmanActor =
         propOptions.actionList.template get<CombinatorialKalmanFilterActor>();
     combKalmanActor.m_logger = m_logger.get();
-    combKalmanActor.inputMeasurements = std::move(inputMeasurements);
+    combKalmanActor.inputMeasurements = &inputMeasurements;
+    combKalmanActor.scratch = scratch;
+    if (scratch != nullptr) {
+      // Left-overs of a previous call; the trajectory keeps its capacity
+      scratch->clear();
+    }
     combKalmanActor.targetSurface = tfOptions.referenceSurface;
     combKalmanActor.multipleScattering = tfOptions.multipleScattering;
     combKalmanActor.energyLoss = tfOptions.energyLoss;
@@ -1146,11 +1271,11 @@ class CombinatorialKalmanFilter {
       return result.error();
     }
 
-    const auto& propRes = *result;
+    auto& propRes = *result;
 
     /// Get the result of the CombinatorialKalmanFilter
     auto combKalmanResult =
-        propRes.template get<CombinatorialKalmanFilterResult>();
+        std::move(propRes.template get<CombinatorialKalmanFilterResult>());
 
     /// The propagation could already reach max step size
     /// before the track finding is finished during two phases:
@@ -1168,10 +1293,121 @@ class CombinatorialKalmanFilter {
       return combKalmanResult.result.error();
     }
 
+    if (scratch != nullptr) {
+      // The reused trajectory also holds the abandoned branches
+      copyFoundTracks(*scratch, combKalmanResult);
+    }
+
     // Return the converted Track
     return combKalmanResult;
   }
 
+  /// Fit implementation of the foward filter for a range of initial track
+  /// parameters, e.g. all seeds in an event
+  ///
+  /// @tparam source_link_t Source link type
+  /// @tparam start_parameters_iterator_t Iterator over the initial parameters
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param inputMeasurements The fittable uncalibrated measurements indexed
+  /// by surface; it must outlive the call
+  /// @param sBegin Begin of the initial track parameters range
+  /// @param sEnd End of the initial track parameters range
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  /// finding
+  /// @param scratch Optional reusable temporary buffers; if none are given,
+  /// buffers local to this call are shared by all initial parameters
+  ///
+  /// @note The initial parameters are processed sequentially. The call is
+  /// thread-safe as long as the scratch buffers are not shared, i.e.
+  /// different sub-ranges of the initial parameters can be processed in
+  /// parallel by the caller.
+  ///
+  /// @return the output for each initial parameters in the same order
+  template <typename source_link_t, typename start_parameters_iterator_t,
+            typename parameters_t = BoundParameters>
+  std::vector<Result<CombinatorialKalmanFilterResult<source_link_t>>>
+  findTracks(
+      const SourceLinkIndex<source_link_t>& inputMeasurements,
+      start_parameters_iterator_t sBegin, start_parameters_iterator_t sEnd,
+      const CombinatorialKalmanFilterOptions<source_link_selector_t>& tfOptions,
+      CombinatorialKalmanFilterScratch<source_link_t>* scratch =
+          nullptr) const {
+    using StartParameters =
+        std::decay_t<decltype(*std::declval<start_parameters_iterator_t>())>;
+
+    CombinatorialKalmanFilterScratch<source_link_t> localScratch;
+    if (scratch == nullptr) {
+      scratch = &localScratch;
+    }
+
+    std::vector<Result<CombinatorialKalmanFilterResult<source_link_t>>>
+        results;
+    results.reserve(std::distance(sBegin, sEnd));
+    for (auto it = sBegin; it != sEnd; ++it) {
+      results.push_back(
+          findTracks<source_link_t, StartParameters, parameters_t>(
+              inputMeasurements, *it, tfOptions, scratch));
+    }
+    return results;
+  }
+
+ private:
+  /// Copy the states of the found tracks into the result trajectory
+  ///
+  /// Only the states reachable from the track tips are copied, and states
+  /// that are shared by several tracks are copied only once. The track tips
+  /// and the fitted parameters are updated to the new indices. The index
+  /// buffers and the fitted parameter nodes are reused via the scratch.
+  ///
+  /// @tparam source_link_t Source link type
+  ///
+  /// @param scratch The buffers with the trajectory of all explored states
+  /// @param result The track finding result with indices into the scratch
+  template <typename source_link_t>
+  void copyFoundTracks(
+      CombinatorialKalmanFilterScratch<source_link_t>& scratch,
+      CombinatorialKalmanFilterResult<source_link_t>& result) const {
+    const auto& source = scratch.trajectory;
+    auto& target = result.fittedStates;
+    // Map from the source to the target state indices
+    auto& copiedStates = scratch.copiedStates;
+    copiedStates.assign(source.size(), SIZE_MAX);
+    // Detach the fitted parameters to re-insert them with the new tips
+    auto& fittedParameters = scratch.fittedParameters;
+    fittedParameters.clear();
+    while (not result.fittedParameters.empty()) {
+      fittedParameters.push_back(
+          result.fittedParameters.extract(result.fittedParameters.begin()));
+    }
+    auto& branch = scratch.branch;
+    for (auto& tip : result.trackTips) {
+      // Collect the states back to the first one that is already copied
+      branch.clear();
+      size_t istate = tip;
+      while (istate != detail_lt::IndexData::kInvalid and
+             copiedStates[istate] == SIZE_MAX) {
+        branch.push_back(istate);
+        istate = source.getTrackState(istate).previous();
+      }
+      size_t iprevious = (istate == detail_lt::IndexData::kInvalid)
+                             ? SIZE_MAX
+                             : copiedStates[istate];
+      for (auto it = branch.rbegin(); it != branch.rend(); ++it) {
+        auto sourceState = source.getTrackState(*it);
+        iprevious = target.addTrackState(sourceState.getMask(), iprevious);
+        target.getTrackState(iprevious).copyFrom(sourceState);
+        copiedStates[*it] = iprevious;
+      }
+      tip = copiedStates[tip];
+    }
+    // Fitted parameters are only assigned to track tips
+    for (auto& node : fittedParameters) {
+      node.key() = copiedStates[node.key()];
+      result.fittedParameters.insert(std::move(node));
+    }
+    fittedParameters.clear();
+  }
 };  // namespace Acts
 
 }  // namespace Acts
\ No newline at end of file
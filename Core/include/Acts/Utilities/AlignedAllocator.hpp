@@ -0,0 +1,62 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace Acts {
+
+/// @brief Standard allocator with an over-aligned start address
+///
+/// @tparam T Type of the allocated elements
+/// @tparam kAlignment Alignment of the allocated memory in bytes, must be a
+///         power of two and at least the natural alignment of @c T
+///
+/// Can be used with standard containers to place their elements on cache
+/// line or SIMD register boundaries, e.g. a 64 byte aligned @c std::vector.
+template <typename T, std::size_t kAlignment>
+struct AlignedAllocator {
+  static_assert((kAlignment & (kAlignment - 1)) == 0,
+                "Alignment must be a power of two");
+  static_assert(alignof(T) <= kAlignment,
+                "Alignment must not be smaller than the natural alignment");
+
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, kAlignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, kAlignment>& /*other*/) noexcept {
+  }
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(
+        ::operator new(n * sizeof(T), std::align_val_t(kAlignment)));
+  }
+
+  void deallocate(T* p, std::size_t /*n*/) noexcept {
+    ::operator delete(p, std::align_val_t(kAlignment));
+  }
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, kAlignment>& /*other*/) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const AlignedAllocator<U, kAlignment>& /*other*/) const {
+    return false;
+  }
+};
+
+}  // namespace Acts
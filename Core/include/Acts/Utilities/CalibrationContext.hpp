@@ -13,7 +13,7 @@
 #include ACTS_CORE_CALIBRATIONCONTEXT_PLUGIN
 #else
 
-#include <any>
+#include "Acts/Utilities/ContextType.hpp"
 
 namespace Acts {
 
@@ -21,9 +21,9 @@ namespace Acts {
 /// payload object regarding detector calbiration
 ///
 /// It is propagated through the code to allow for event/thread
-/// dependent calibration
-
-using CalibrationContext = std::any;
+/// dependent calibration. The payload can be accessed with
+/// std::any_cast or, without the type information lookup, with get<T>().
+using CalibrationContext = ContextType;
 
 }  // namespace Acts
 
@@ -0,0 +1,167 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <any>
+#include <type_traits>
+#include <utility>
+
+namespace Acts {
+
+/// @brief Type-erased context payload with a typed fast path
+///
+/// This is a std::any and can be used as such, e.g. with std::any_cast.
+/// In addition, the address and the type of the payload are resolved once
+/// when the payload is set or the context is copied. The payload can then be
+/// accessed with get<T>() by a single pointer comparison, without the type
+/// information lookup and the payload copy of std::any_cast<T>(context).
+/// This matters for accessors that are called many times with the same
+/// context, e.g. the contextual detector element transforms.
+///
+/// A context assigned from a plain std::any carries no type information; get
+/// then falls back to std::any_cast. The payload must only be modified
+/// through the context itself, not through a std::any reference to it.
+class ContextType : public std::any {
+ public:
+  /// Construct an empty context
+  ContextType() noexcept = default;
+
+  /// Construct from a plain std::any, i.e. without the typed fast path
+  ContextType(const std::any& other) : std::any(other) {}
+  ContextType(std::any&& other) noexcept : std::any(std::move(other)) {}
+
+  /// Construct with a payload
+  ///
+  /// @tparam payload_t Type of the payload
+  template <typename payload_t,
+            typename = std::enable_if_t<
+                not std::is_base_of_v<std::any, std::decay_t<payload_t>>>>
+  ContextType(payload_t&& payload)
+      : std::any(std::forward<payload_t>(payload)),
+        m_resolve(&resolve<std::decay_t<payload_t>>) {
+    m_payload = m_resolve(*this);
+  }
+
+  // the base class must be selected explicitly, the std::any constructor
+  // template would otherwise wrap the context in another std::any
+  ContextType(const ContextType& other)
+      : std::any(static_cast<const std::any&>(other)),
+        m_resolve(other.m_resolve) {
+    updatePayload();
+  }
+
+  ContextType(ContextType&& other) noexcept
+      : std::any(std::move(static_cast<std::any&>(other))),
+        m_resolve(other.m_resolve) {
+    updatePayload();
+    other.clearPayload();
+  }
+
+  ContextType& operator=(const ContextType& other) {
+    std::any::operator=(static_cast<const std::any&>(other));
+    m_resolve = other.m_resolve;
+    updatePayload();
+    return *this;
+  }
+
+  ContextType& operator=(ContextType&& other) noexcept {
+    std::any::operator=(std::move(static_cast<std::any&>(other)));
+    m_resolve = other.m_resolve;
+    updatePayload();
+    other.clearPayload();
+    return *this;
+  }
+
+  /// Assign a payload
+  ///
+  /// @tparam payload_t Type of the payload
+  template <typename payload_t,
+            typename = std::enable_if_t<
+                not std::is_base_of_v<std::any, std::decay_t<payload_t>>>>
+  ContextType& operator=(payload_t&& payload) {
+    std::any::operator=(std::forward<payload_t>(payload));
+    m_resolve = &resolve<std::decay_t<payload_t>>;
+    updatePayload();
+    return *this;
+  }
+
+  /// Assign from a plain std::any, i.e. without the typed fast path
+  ContextType& operator=(const std::any& other) {
+    std::any::operator=(other);
+    clearPayload();
+    return *this;
+  }
+  ContextType& operator=(std::any&& other) noexcept {
+    std::any::operator=(std::move(other));
+    clearPayload();
+    return *this;
+  }
+
+  /// Construct a payload in place
+  ///
+  /// @tparam payload_t Type of the payload
+  /// @param args Arguments of the payload constructor
+  /// @return Reference to the new payload
+  template <typename payload_t, typename... args_t>
+  std::decay_t<payload_t>& emplace(args_t&&... args) {
+    auto& payload =
+        std::any::emplace<payload_t>(std::forward<args_t>(args)...);
+    m_resolve = &resolve<std::decay_t<payload_t>>;
+    m_payload = &payload;
+    return payload;
+  }
+
+  /// Remove the payload
+  void reset() noexcept {
+    std::any::reset();
+    clearPayload();
+  }
+
+  /// Exchange the payloads of two contexts
+  void swap(ContextType& other) noexcept {
+    std::any::swap(other);
+    std::swap(m_resolve, other.m_resolve);
+    updatePayload();
+    other.updatePayload();
+  }
+
+  /// Access the payload
+  ///
+  /// @tparam payload_t Type of the payload
+  /// @return Pointer to the payload or nullptr if the type does not match
+  template <typename payload_t>
+  const payload_t* get() const noexcept {
+    if (m_resolve == &resolve<payload_t>) {
+      return static_cast<const payload_t*>(m_payload);
+    }
+    return std::any_cast<payload_t>(static_cast<const std::any*>(this));
+  }
+
+ private:
+  using Resolver = const void* (*)(const std::any&);
+
+  // the resolver of each payload type also serves as its type key
+  template <typename payload_t>
+  static const void* resolve(const std::any& context) noexcept {
+    return std::any_cast<payload_t>(&context);
+  }
+
+  void updatePayload() noexcept {
+    m_payload = (m_resolve != nullptr) ? m_resolve(*this) : nullptr;
+  }
+  void clearPayload() noexcept {
+    m_resolve = nullptr;
+    m_payload = nullptr;
+  }
+
+  Resolver m_resolve = nullptr;
+  const void* m_payload = nullptr;
+};
+
+}  // namespace Acts
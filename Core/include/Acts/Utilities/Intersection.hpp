@@ -11,6 +11,9 @@
 ///////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <limits>
 
 #include "Definitions.hpp"
@@ -159,4 +162,43 @@ struct SameSurfaceIntersection {
   }
 };
 
+/// @brief Sort intersections according to the navigation direction
+///
+/// Navigation candidates are mostly collected in (or close to) their order
+/// along the track, e.g. the layers are walked from one to the next. Short
+/// ranges are thus sorted by insertion, which is linear for ordered input,
+/// longer ones fall back to std::sort.
+///
+/// @tparam iterator_t Random access iterator of the intersections
+/// @param begin Begin of the intersection range
+/// @param end End of the intersection range
+/// @param navDir The navigation direction
+template <typename iterator_t>
+void sortIntersections(iterator_t begin, iterator_t end,
+                       NavigationDirection navDir) {
+  auto insertionSort = [&](auto&& compare) {
+    for (auto it = begin; it != end; ++it) {
+      // already in place after its predecessor
+      if (it == begin or not compare(*it, *std::prev(it))) {
+        continue;
+      }
+      auto insertPos = std::upper_bound(begin, it, *it, compare);
+      std::rotate(insertPos, it, std::next(it));
+    }
+  };
+  // insertion sort is not faster anymore beyond a few dozen candidates
+  constexpr std::ptrdiff_t maxInsertionSort = 32;
+  if (std::distance(begin, end) > maxInsertionSort) {
+    if (navDir == forward) {
+      std::sort(begin, end);
+    } else {
+      std::sort(begin, end, std::greater<>());
+    }
+  } else if (navDir == forward) {
+    insertionSort(std::less<>());
+  } else {
+    insertionSort(std::greater<>());
+  }
+}
+
 }  // namespace Acts
@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+namespace Acts {
+namespace Tracing {
+
+/// @brief Receiver of the scoped markers, e.g. a profiler
+///
+/// Markers are reported on the thread executing the marked scope and in
+/// nested order per thread, i.e. the end of a scope always belongs to the
+/// last begin on the same thread.
+class Tracer {
+ public:
+  virtual ~Tracer() = default;
+
+  /// Called when a marked scope is entered
+  ///
+  /// @param name The name of the scope, a string literal
+  virtual void begin(const char* name) = 0;
+  /// Called when a marked scope is left
+  ///
+  /// @param name The name of the scope, a string literal
+  virtual void end(const char* name) = 0;
+};
+
+/// Set the tracer receiving all markers
+///
+/// @param tracer The tracer, nullptr to ignore all markers
+///
+/// @note The tracer must outlive all marked scopes entered while it is set.
+void setTracer(Tracer* tracer);
+
+/// The tracer receiving all markers, nullptr if none is set
+Tracer* tracer();
+
+/// @brief Report entering and leaving a scope to the tracer
+///
+/// Use the ACTS_TRACE_SCOPE macro instead, which removes the marker unless
+/// tracing is enabled at compile time. Markers are meant for coarse scopes,
+/// e.g. a full propagation or track finding call, and not for code executed
+/// on every propagation step.
+class ScopedMarker {
+ public:
+  /// @param name The name of the scope, a string literal
+  explicit ScopedMarker(const char* name) : m_name(name), m_tracer(tracer()) {
+    if (m_tracer != nullptr) {
+      m_tracer->begin(m_name);
+    }
+  }
+  ScopedMarker(const ScopedMarker&) = delete;
+  ScopedMarker& operator=(const ScopedMarker&) = delete;
+  ~ScopedMarker() {
+    if (m_tracer != nullptr) {
+      m_tracer->end(m_name);
+    }
+  }
+
+ private:
+  const char* m_name;
+  Tracer* m_tracer;
+};
+
+}  // namespace Tracing
+}  // namespace Acts
+
+#define ACTS_TRACE_CONCAT_IMPL(a, b) a##b
+#define ACTS_TRACE_CONCAT(a, b) ACTS_TRACE_CONCAT_IMPL(a, b)
+
+/// @brief Mark the enclosing scope for the tracer
+///
+/// @param name The name of the scope, a string literal
+///
+/// The marker only exists if ACTS_ENABLE_TRACING is defined, i.e. if Acts is
+/// configured with the ACTS_ENABLE_TRACING option, and compiles to nothing
+/// otherwise.
+#ifdef ACTS_ENABLE_TRACING
+#define ACTS_TRACE_SCOPE(name)                                     \
+  ::Acts::Tracing::ScopedMarker ACTS_TRACE_CONCAT(actsTraceMarker, \
+                                                  __LINE__)(name)
+#else
+#define ACTS_TRACE_SCOPE(name)
+#endif
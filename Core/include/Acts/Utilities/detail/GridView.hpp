@@ -0,0 +1,95 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/detail/GridBase.hpp"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+namespace Acts {
+
+namespace detail {
+
+/// @brief read-only view of the values of a regular multi-dimensional grid
+///
+/// @tparam T    type of values stored inside the bins of the grid
+/// @tparam Axes parameter pack of axis types defining the grid
+///
+/// Counterpart of Acts::detail::Grid for values which are not owned by the
+/// grid itself, e.g. values in a memory-mapped file which may be shared with
+/// other processes. The values are laid out as in Acts::detail::Grid, i.e.
+/// including the under- and overflow bins in the order of the global bins.
+/// The bin look-up and the interpolation are shared with Acts::detail::Grid
+/// through Acts::detail::GridBase.
+template <typename T, class... Axes>
+class GridView final : public GridBase<GridView<T, Axes...>, T, Axes...> {
+  using Base = GridBase<GridView<T, Axes...>, T, Axes...>;
+
+ public:
+  /// number of dimensions of the grid
+  static constexpr size_t DIM = sizeof...(Axes);
+
+  /// type of values stored
+  using value_type = T;
+  /// constant reference type to values stored
+  using const_reference = const value_type&;
+  /// type for points in d-dimensional grid space
+  using point_t = std::array<double, DIM>;
+  /// index type using local bin indices along each axis
+  using index_t = std::array<size_t, DIM>;
+
+  /// @brief constructor
+  ///
+  /// @param [in] axes   actual axis objects spanning the grid
+  /// @param [in] values pointer to the values of all bins (including under-
+  ///                    and overflow bins) in the order of the global bins
+  /// @param [in] owner  object keeping the values alive, e.g. a memory
+  ///                    mapping; it is shared by all copies of the view
+  ///
+  /// @pre @c values must point to at least size() valid objects of type
+  ///      @c T, suitably aligned for @c T, for the lifetime of @c owner.
+  GridView(std::tuple<Axes...> axes, const T* values,
+           std::shared_ptr<const void> owner)
+      : Base(std::move(axes)),
+        m_values(values),
+        m_owner(std::move(owner)),
+        m_size(this->size()) {
+    if (m_values == nullptr) {
+      throw std::invalid_argument("Missing grid values");
+    }
+  }
+
+  /// @brief access value stored in bin with given global bin number
+  ///
+  /// @param  [in] bin global bin number
+  /// @return const-reference to value stored in bin
+  const_reference at(size_t bin) const {
+    if (bin >= m_size) {
+      throw std::out_of_range("Global bin is out of range");
+    }
+    return m_values[bin];
+  }
+
+  /// @copydoc Acts::detail::Grid::data
+  const value_type* data() const { return m_values; }
+
+ private:
+  /// linear value store for each bin, owned by m_owner
+  const T* m_values = nullptr;
+  /// owner of the values
+  std::shared_ptr<const void> m_owner = nullptr;
+  /// number of values
+  size_t m_size = 0;
+};
+}  // namespace detail
+
+}  // namespace Acts
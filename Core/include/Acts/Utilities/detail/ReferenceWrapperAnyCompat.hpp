@@ -11,6 +11,8 @@
 // This workround does not work on libc++. To detect libc++, we include
 // one STL header and then check if _LIBCPP_VERSION is defined.
 
+#include "Acts/Utilities/ContextType.hpp"
+
 #include <any>
 #include <type_traits>
 
@@ -31,6 +33,18 @@ struct is_constructible<std::reference_wrapper<const std::any>,
 template <>
 struct is_copy_constructible<std::reference_wrapper<const std::any>>
     : public true_type {};
+// the contexts derive from std::any and are affected in the same way
+template <>
+struct is_constructible<std::reference_wrapper<const Acts::ContextType>,
+                        const std::reference_wrapper<const Acts::ContextType>&>
+    : public true_type {};
+template <>
+struct is_constructible<std::reference_wrapper<const Acts::ContextType>,
+                        std::reference_wrapper<const Acts::ContextType>&>
+    : public true_type {};
+template <>
+struct is_copy_constructible<std::reference_wrapper<const Acts::ContextType>>
+    : public true_type {};
 }  // namespace std
 
 #endif
@@ -10,9 +10,11 @@
 
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
-#include <map>
+#include <optional>
+#include <vector>
 
 namespace Acts {
 
@@ -45,7 +47,18 @@ struct VertexInfo {
   // Vector of all track currently held by vertex
   std::vector<const input_track_t*> trackLinks;
 
-  std::map<const input_track_t*, const BoundParameters> ip3dParams;
+  // The tracks at the vertex, in the order of trackLinks
+  std::vector<TrackAtVertex<input_track_t>> tracksAtVertex;
+
+  // The 3d impact parameters of the tracks, in the order of trackLinks
+  std::vector<std::optional<BoundParameters>> ip3dParams;
+
+  // The position at which the track compatibilities were estimated
+  Acts::Vector4D compatibilityPosition{Acts::Vector4D::Zero()};
+
+  // Number of tracks, from the front, with a compatibility estimated
+  // at compatibilityPosition
+  size_t nCompatibilities = 0;
 };
 
 }  // namespace Acts
\ No newline at end of file
@@ -83,7 +83,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
       break;
     }
     // Update fitter state with all vertices
-    fitterState.addVertexToMultiMap(vtxCandidate);
+    fitterState.addVertexToTracks(vtxCandidate);
 
     // Perform the fit
     auto fitResult = m_cfg.vertexFitter.addVtxToFit(
@@ -238,11 +238,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     double ipSig = *sigRes;
     if (ipSig < m_cfg.tracksMaxSignificance) {
       // Create TrackAtVertex objects, unique for each (track, vertex) pair
-      fitterState.tracksAtVerticesMap.emplace(std::make_pair(trk, &vtx),
-                                              TrackAtVertex(params, trk));
-
-      // Add the original track parameters to the list for vtx
-      fitterState.vtxInfoMap[&vtx].trackLinks.push_back(trk);
+      // and add the original track parameters to the list for vtx
+      fitterState.addTrackAtVertex(&vtx, TrackAtVertex(params, trk));
     }
   }
   return {};
@@ -262,7 +259,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
   // candidate were found
   // TODO: This is for now how it's done in athena... this look a bit
   // nasty to me
-  if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+  if (fitterState.vertexInfo(&vtx).trackLinks.empty()) {
     // Find nearest track to vertex candidate
     double smallestDeltaZ = std::numeric_limits<double>::max();
     double newZ = 0;
@@ -281,7 +278,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
       vtx.setFullPosition(Vector4D(0., 0., newZ, 0.));
 
       // Update vertex info for current vertex
-      fitterState.vtxInfoMap[&vtx] =
+      fitterState.vertexInfo(&vtx) =
           VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
 
       // Try to add compatible track with adapted vertex position
@@ -291,7 +288,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         return Result<bool>::failure(res.error());
       }
 
-      if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+      if (fitterState.vertexInfo(&vtx).trackLinks.empty()) {
         ACTS_DEBUG(
             "No tracks near seed were found, while at least one was "
             "expected. Break.");
@@ -318,7 +315,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<bool> {
   // Add vertex info to fitter state
-  fitterState.vtxInfoMap[&vtx] =
+  fitterState.vertexInfo(&vtx) =
       VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
 
   // Add all compatible tracks to vertex
@@ -347,9 +344,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         FitterState_t& fitterState) const -> std::pair<int, bool> {
   bool isGoodVertex = false;
   int nCompatibleTracks = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trkAtVtx : fitterState.vertexInfo(&vtx).tracksAtVertex) {
+    const auto& trk = trkAtVtx.originalParams;
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -385,9 +381,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
         FitterState_t& fitterState,
         std::vector<const InputTrack_t*>& removedSeedTracks) const -> void {
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trkAtVtx : fitterState.vertexInfo(&vtx).tracksAtVertex) {
+    const auto& trk = trkAtVtx.originalParams;
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -416,9 +411,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 
   auto maxCompSeedIt = seedTracks.end();
   const InputTrack_t* removedTrack = nullptr;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trkAtVtx : fitterState.vertexInfo(&vtx).tracksAtVertex) {
+    const auto& trk = trkAtVtx.originalParams;
     double compatibility = trkAtVtx.vertexCompatibility;
     if (compatibility > maxCompatibility) {
       // Try to find track in seed tracks
@@ -471,9 +465,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::keepNewVertex(
   double contamination = 0.;
   double contaminationNum = 0;
   double contaminationDeNom = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trkAtVtx : fitterState.vertexInfo(&vtx).tracksAtVertex) {
     double trackWeight = trkAtVtx.trackWeight;
     contaminationNum += trackWeight * (1. - trackWeight);
     contaminationDeNom += trackWeight * trackWeight;
@@ -547,7 +539,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::deleteLastVertex(
   allVerticesPtr.pop_back();
 
   // Update fitter state with removed vertex candidate
-  fitterState.removeVertexFromMultiMap(vtx);
+  fitterState.removeVertexFromTracks(vtx);
 
   // Do the fit with removed vertex
   auto fitResult = m_cfg.vertexFitter.addVtxToFit(
@@ -567,12 +559,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::getVertexOutputList(
   std::vector<Vertex<InputTrack_t>> outputVec;
   for (auto vtx : allVerticesPtr) {
     auto& outVtx = *vtx;
-    std::vector<TrackAtVertex<InputTrack_t>> tracksAtVtx;
-    for (const auto& trk : fitterState.vtxInfoMap[vtx].trackLinks) {
-      tracksAtVtx.push_back(
-          fitterState.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
-    }
-    outVtx.setTracksAtVertex(tracksAtVtx);
+    outVtx.setTracksAtVertex(fitterState.vertexInfo(vtx).tracksAtVertex);
     outputVec.push_back(outVtx);
   }
   return Result<std::vector<Vertex<InputTrack_t>>>(outputVec);
@@ -20,7 +20,11 @@
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -65,35 +69,78 @@ class AdaptiveMultiVertexFitter {
     // Linearizer state
     typename Linearizer_t::State linearizerState;
 
-    // Map to store vertices information
-    std::map<Vertex<InputTrack_t>*, VertexInfo<InputTrack_t>> vtxInfoMap;
+    // Dense indices of the vertices and tracks known to the state
+    std::unordered_map<const Vertex<InputTrack_t>*, size_t> vertexIndices;
+    std::unordered_map<const InputTrack_t*, size_t> trackIndices;
 
-    std::multimap<const InputTrack_t*, Vertex<InputTrack_t>*>
-        trackToVerticesMultiMap;
+    // The vertices and their information by vertex index, the information
+    // holds the row of tracks at the vertex
+    std::vector<Vertex<InputTrack_t>*> vertices;
+    std::vector<VertexInfo<InputTrack_t>> vertexInfos;
 
-    std::map<std::pair<const InputTrack_t*, Vertex<InputTrack_t>*>,
-             TrackAtVertex<InputTrack_t>>
-        tracksAtVerticesMap;
+    // The vertices using a track by track index, as pairs of the vertex
+    // index and the position of the track in the row of that vertex
+    std::vector<std::vector<std::pair<size_t, size_t>>> trackToVertices;
+
+    // Buffer for the compatibilities of one track at all its vertices
+    std::vector<double> trkToVtxCompatibilities;
 
     /// @brief Default State constructor
     State() = default;
 
-    // Adds a vertex to trackToVerticesMultiMap
-    void addVertexToMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto trk : vtxInfoMap[&vtx].trackLinks) {
-        trackToVerticesMultiMap.emplace(trk, &vtx);
+    // The dense index of a vertex, assigned on first use
+    size_t vertexIndex(Vertex<InputTrack_t>* vtx) {
+      auto [it, inserted] = vertexIndices.emplace(vtx, vertices.size());
+      if (inserted) {
+        vertices.push_back(vtx);
+        vertexInfos.emplace_back();
+      }
+      return it->second;
+    }
+
+    // The dense index of a track, assigned on first use
+    size_t trackIndex(const InputTrack_t* trk) {
+      auto [it, inserted] = trackIndices.emplace(trk, trackToVertices.size());
+      if (inserted) {
+        trackToVertices.emplace_back();
+      }
+      return it->second;
+    }
+
+    // The information of a vertex
+    VertexInfo<InputTrack_t>& vertexInfo(Vertex<InputTrack_t>* vtx) {
+      return vertexInfos[vertexIndex(vtx)];
+    }
+
+    // Adds a track to the row of a vertex, tracks added after the vertex
+    // was added to the tracks are not seen by the other vertices
+    void addTrackAtVertex(Vertex<InputTrack_t>* vtx,
+                          const TrackAtVertex<InputTrack_t>& trkAtVtx) {
+      auto& info = vertexInfo(vtx);
+      info.trackLinks.push_back(trkAtVtx.originalParams);
+      info.tracksAtVertex.push_back(trkAtVtx);
+      info.ip3dParams.emplace_back();
+    }
+
+    // Adds a vertex to the vertices of all its tracks
+    void addVertexToTracks(Vertex<InputTrack_t>& vtx) {
+      const size_t iVtx = vertexIndex(&vtx);
+      const auto& trackLinks = vertexInfos[iVtx].trackLinks;
+      for (size_t iTrk = 0; iTrk < trackLinks.size(); ++iTrk) {
+        trackToVertices[trackIndex(trackLinks[iTrk])].emplace_back(iVtx, iTrk);
       }
     }
 
-    // Removes a vertex from trackToVerticesMultiMap
-    void removeVertexFromMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto iter = trackToVerticesMultiMap.begin();
-           iter != trackToVerticesMultiMap.end();) {
-        if (iter->second == &vtx) {
-          iter = trackToVerticesMultiMap.erase(iter);
-        } else {
-          ++iter;
-        }
+    // Removes a vertex from the vertices of all its tracks
+    void removeVertexFromTracks(Vertex<InputTrack_t>& vtx) {
+      const size_t iVtx = vertexIndex(&vtx);
+      for (auto trk : vertexInfos[iVtx].trackLinks) {
+        auto& trkVertices = trackToVertices[trackIndex(trk)];
+        trkVertices.erase(std::remove_if(trkVertices.begin(), trkVertices.end(),
+                                         [&](const auto& link) {
+                                           return link.first == iVtx;
+                                         }),
+                          trkVertices.end());
       }
     }
   };
@@ -234,16 +281,6 @@ class AdaptiveMultiVertexFitter {
       State& state, const Linearizer_t& linearizer,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
-  /// @brief Tests if vertex is already in list of vertices or not
-  ///
-  /// @param vtx Vertex to test
-  /// @param verticesVec Vector of vertices to search
-  ///
-  /// @return True if vtx is already in verticesVec
-  bool isAlreadyInList(
-      Vertex<InputTrack_t>* vtx,
-      const std::vector<Vertex<InputTrack_t>*>& verticesVec) const;
-
   /// @brief Prepares vertex object for the actual fit, i.e.
   /// all TrackAtVertex objects at current vertex will obtain
   /// `ip3dParams` from ImpactPointEstimator::estimate3DImpactParameters
@@ -257,7 +294,8 @@ class AdaptiveMultiVertexFitter {
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
   /// @brief Sets vertexCompatibility for all TrackAtVertex objects
-  /// at current vertex
+  /// at current vertex, the compatibilities are only estimated again
+  /// if the vertex moved since their last estimation
   ///
   /// @param state The state object
   /// @param currentVtx Current vertex
@@ -283,8 +321,8 @@ class AdaptiveMultiVertexFitter {
   /// @param state The state object
   /// @param trk The track
   ///
-  /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
+  /// @return Vector of compatibility values, a buffer of the state
+  const std::vector<double>& collectTrackToVertexCompatibilities(
       State& state, const InputTrack_t* trk) const;
 
   /// @brief Determines if vertex position has shifted more than
@@ -56,7 +56,7 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
     // Initial loop over all vertices in state.vertexCollection
 
     for (auto currentVtx : state.vertexCollection) {
-      VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[currentVtx];
+      VertexInfo<input_track_t>& currentVtxInfo = state.vertexInfo(currentVtx);
       currentVtxInfo.relinearize = false;
       // Store old position of vertex, i.e. seed position
       // in case of first iteration or position determined
@@ -73,14 +73,13 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fitImpl(
         prepareVertexForFit(state, currentVtx, vertexingOptions);
       }
       // Determine if constraint vertex exist
-      if (state.vtxInfoMap[currentVtx].constraintVertex.fullCovariance() !=
+      if (currentVtxInfo.constraintVertex.fullCovariance() !=
           SymMatrix4D::Zero()) {
         currentVtx->setFullPosition(
-            state.vtxInfoMap[currentVtx].constraintVertex.fullPosition());
-        currentVtx->setFitQuality(
-            state.vtxInfoMap[currentVtx].constraintVertex.fitQuality());
+            currentVtxInfo.constraintVertex.fullPosition());
+        currentVtx->setFitQuality(currentVtxInfo.constraintVertex.fitQuality());
         currentVtx->setFullCovariance(
-            state.vtxInfoMap[currentVtx].constraintVertex.fullCovariance());
+            currentVtxInfo.constraintVertex.fullCovariance());
       }
 
       else if (currentVtx->fullCovariance() == SymMatrix4D::Zero()) {
@@ -123,11 +122,13 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
     State& state, Vertex<input_track_t>& newVertex,
     const linearizer_t& linearizer,
     const VertexingOptions<input_track_t>& vertexingOptions) const {
-  if (state.vtxInfoMap[&newVertex].trackLinks.empty()) {
+  if (state.vertexInfo(&newVertex).trackLinks.empty()) {
     return VertexingError::EmptyInput;
   }
 
   std::vector<Vertex<input_track_t>*> verticesToFit;
+  // Flags of the vertices in verticesToFit by vertex index
+  std::vector<bool> isInFit(state.vertices.size(), false);
 
   // Prepares vtx and tracks for fast estimation method of their
   // compatibility with vertex
@@ -146,19 +147,17 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
     for (auto& lastVtxIter : lastIterAddedVertices) {
       // Loop over all track at current lastVtxIter
       const std::vector<const input_track_t*>& trks =
-          state.vtxInfoMap[lastVtxIter].trackLinks;
+          state.vertexInfo(lastVtxIter).trackLinks;
       for (const auto& trk : trks) {
-        // Retrieve list of links to all vertices that currently use the current
-        // track
-        auto range = state.trackToVerticesMultiMap.equal_range(trk);
-
-        // Loop over all attached vertices and add those to vertex fit
-        // which are not already in `verticesToFit`
-        for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-          auto newVtxIter = vtxIter->second;
-          if (!isAlreadyInList(newVtxIter, verticesToFit)) {
+        // Loop over all vertices that currently use the current track
+        // and add those to vertex fit which are not already in
+        // `verticesToFit`
+        for (const auto& link : state.trackToVertices[state.trackIndex(trk)]) {
+          auto newVtxIter = state.vertices[link.first];
+          if (!isInFit[link.first]) {
             // Add newVtxIter to verticesToFit
             verticesToFit.push_back(newVtxIter);
+            isInFit[link.first] = true;
 
             // Add newVtxIter vertex to currentIterAddedVertices
             // if vertex != lastVtxIter
@@ -185,35 +184,31 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
   return {};
 }
 
-template <typename input_track_t, typename linearizer_t>
-bool Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
-    isAlreadyInList(
-        Vertex<input_track_t>* vtx,
-        const std::vector<Vertex<input_track_t>*>& verticesVec) const {
-  return std::find(verticesVec.begin(), verticesVec.end(), vtx) !=
-         verticesVec.end();
-}
-
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::prepareVertexForFit(
         State& state, Vertex<input_track_t>* vtx,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   // The current vertex info object
-  auto& currentVtxInfo = state.vtxInfoMap[vtx];
+  auto& currentVtxInfo = state.vertexInfo(vtx);
   // The seed position
   const Vector3D& seedPos = currentVtxInfo.seedPosition.template head<3>();
 
-  // Loop over all tracks at current vertex
-  for (const auto& trk : currentVtxInfo.trackLinks) {
+  // Loop over all tracks at current vertex without ip3dParams
+  for (size_t iTrk = 0; iTrk < currentVtxInfo.trackLinks.size(); ++iTrk) {
+    auto& ip3dParams = currentVtxInfo.ip3dParams[iTrk];
+    if (ip3dParams) {
+      continue;
+    }
     auto res = m_cfg.ipEst.estimate3DImpactParameters(
         vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_extractParameters(*trk), seedPos, state.ipState);
+        m_extractParameters(*currentVtxInfo.trackLinks[iTrk]), seedPos,
+        state.ipState);
     if (!res.ok()) {
       return res.error();
     }
     // Set ip3dParams for current trackAtVertex
-    currentVtxInfo.ip3dParams.emplace(trk, *(res.value()));
+    ip3dParams.emplace(*(res.value()));
   }
   return {};
 }
@@ -224,35 +219,42 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     setAllVertexCompatibilities(
         State& state, Vertex<input_track_t>* currentVtx,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
-  VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[currentVtx];
+  VertexInfo<input_track_t>& currentVtxInfo = state.vertexInfo(currentVtx);
+
+  // The ip3dParams of a track never change once they are set, the
+  // compatibilities only have to be estimated again if the vertex moved
+  if (currentVtxInfo.compatibilityPosition != currentVtxInfo.oldPosition) {
+    currentVtxInfo.compatibilityPosition = currentVtxInfo.oldPosition;
+    currentVtxInfo.nCompatibilities = 0;
+  }
 
   // Loop over tracks at current vertex and
   // estimate compatibility with vertex
-  for (const auto& trk : currentVtxInfo.trackLinks) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, currentVtx));
+  for (size_t iTrk = currentVtxInfo.nCompatibilities;
+       iTrk < currentVtxInfo.trackLinks.size(); ++iTrk) {
+    auto& ip3dParams = currentVtxInfo.ip3dParams[iTrk];
     // Recover from cases where linearization point != 0 but
     // more tracks were added later on
-    if (currentVtxInfo.ip3dParams.find(trk) ==
-        currentVtxInfo.ip3dParams.end()) {
+    if (!ip3dParams) {
       auto res = m_cfg.ipEst.estimate3DImpactParameters(
           vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-          m_extractParameters(*trk),
+          m_extractParameters(*currentVtxInfo.trackLinks[iTrk]),
           VectorHelpers::position(currentVtxInfo.linPoint), state.ipState);
       if (!res.ok()) {
         return res.error();
       }
       // Set ip3dParams for current trackAtVertex
-      currentVtxInfo.ip3dParams.emplace(trk, *(res.value()));
+      ip3dParams.emplace(*(res.value()));
     }
     // Set compatibility with current vertex
     auto compRes = m_cfg.ipEst.get3dVertexCompatibility(
-        vertexingOptions.geoContext, &(currentVtxInfo.ip3dParams.at(trk)),
+        vertexingOptions.geoContext, &(*ip3dParams),
         VectorHelpers::position(currentVtxInfo.oldPosition));
     if (!compRes.ok()) {
       return compRes.error();
     }
-    trkAtVtx.vertexCompatibility = *compRes;
+    currentVtxInfo.tracksAtVertex[iTrk].vertexCompatibility = *compRes;
+    currentVtxInfo.nCompatibilities = iTrk + 1;
   }
   return {};
 }
@@ -263,10 +265,10 @@ Acts::Result<void> Acts::
         State& state, const linearizer_t& linearizer,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   for (auto vtx : state.vertexCollection) {
-    VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[vtx];
+    VertexInfo<input_track_t>& currentVtxInfo = state.vertexInfo(vtx);
 
-    for (const auto& trk : currentVtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+    for (auto& trkAtVtx : currentVtxInfo.tracksAtVertex) {
+      const input_track_t* trk = trkAtVtx.originalParams;
 
       // Set trackWeight for current track
       double currentTrkWeight = m_cfg.annealingTool.getWeight(
@@ -278,16 +280,16 @@ Acts::Result<void> Acts::
         // Check if linearization state exists or need to be relinearized
         if (trkAtVtx.linearizedState.covarianceAtPCA ==
                 BoundSymMatrix::Zero() ||
-            state.vtxInfoMap[vtx].relinearize) {
+            currentVtxInfo.relinearize) {
           auto result = linearizer.linearizeTrack(
-              m_extractParameters(*trk), state.vtxInfoMap[vtx].oldPosition,
+              m_extractParameters(*trk), currentVtxInfo.oldPosition,
               vertexingOptions.geoContext, vertexingOptions.magFieldContext,
               state.linearizerState);
           if (!result.ok()) {
             return result.error();
           }
           trkAtVtx.linearizedState = *result;
-          state.vtxInfoMap[vtx].linPoint = state.vtxInfoMap[vtx].oldPosition;
+          currentVtxInfo.linPoint = currentVtxInfo.oldPosition;
         }
         // Update the vertex with the new track
         KalmanVertexUpdater::updateVertexWithTrack<input_track_t>(*vtx,
@@ -304,18 +306,17 @@ Acts::Result<void> Acts::
 }
 
 template <typename input_track_t, typename linearizer_t>
-std::vector<double>
+const std::vector<double>&
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     collectTrackToVertexCompatibilities(State& state,
                                         const input_track_t* trk) const {
-  std::vector<double> trkToVtxCompatibilities;
-  trkToVtxCompatibilities.reserve(state.vertexCollection.size());
-  auto range = state.trackToVerticesMultiMap.equal_range(trk);
-
-  for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-    trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtxIter->second))
-            .vertexCompatibility);
+  auto& trkToVtxCompatibilities = state.trkToVtxCompatibilities;
+  trkToVtxCompatibilities.clear();
+
+  for (const auto& link : state.trackToVertices[state.trackIndex(trk)]) {
+    trkToVtxCompatibilities.push_back(state.vertexInfos[link.first]
+                                          .tracksAtVertex[link.second]
+                                          .vertexCompatibility);
   }
 
   return trkToVtxCompatibilities;
@@ -325,7 +326,7 @@ template <typename input_track_t, typename linearizer_t>
 bool Acts::AdaptiveMultiVertexFitter<
     input_track_t, linearizer_t>::checkSmallShift(State& state) const {
   for (auto vtx : state.vertexCollection) {
-    Vector3D diff = state.vtxInfoMap[vtx].oldPosition.template head<3>() -
+    Vector3D diff = state.vertexInfo(vtx).oldPosition.template head<3>() -
                     vtx->fullPosition().template head<3>();
     ActsSymMatrixD<3> vtxWgt =
         (vtx->fullCovariance().template block<3, 3>(0, 0)).inverse();
@@ -341,10 +342,9 @@ template <typename input_track_t, typename linearizer_t>
 void Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     doVertexSmoothing(State& state, const GeometryContext& geoContext) const {
   for (const auto vtx : state.vertexCollection) {
-    for (const auto trk : state.vtxInfoMap[vtx].trackLinks) {
-      KalmanVertexTrackUpdater::update<input_track_t>(
-          geoContext, state.tracksAtVerticesMap.at(std::make_pair(trk, vtx)),
-          *vtx);
+    for (auto& trkAtVtx : state.vertexInfo(vtx).tracksAtVertex) {
+      KalmanVertexTrackUpdater::update<input_track_t>(geoContext, trkAtVtx,
+                                                      *vtx);
     }
   }
 }
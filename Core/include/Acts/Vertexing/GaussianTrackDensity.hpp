@@ -9,8 +9,12 @@
 #pragma once
 
 #include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Utilities/Definitions.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <numeric>
 #include <set>
 
 namespace Acts {
@@ -84,6 +88,15 @@ class GaussianTrackDensity {
     State(unsigned int nTracks) { trackEntries.reserve(nTracks); }
     // Vector to cache track information
     std::vector<TrackEntry> trackEntries;
+    // The track information ordered by the lower bounds in
+    // structure-of-arrays layout, for the density evaluation
+    Eigen::ArrayXd lowerBounds;
+    Eigen::ArrayXd upperBounds;
+    Eigen::ArrayXd c0;
+    Eigen::ArrayXd c1;
+    Eigen::ArrayXd c2;
+    // The running maximum of the ordered upper bounds
+    Eigen::ArrayXd maxUpperBounds;
   };
 
   /// Default constructor
@@ -144,9 +157,17 @@ class GaussianTrackDensity {
                  const std::function<BoundParameters(input_track_t)>&
                      extractParameters) const;
 
+  /// @brief Order the cached track information by the lower bounds
+  ///
+  /// @param state The track density state
+  void sortTracks(State& state) const;
+
   /// @brief Evaluate the density function and its two first
   /// derivatives at the specified coordinate along the beamline
   ///
+  /// Only the tracks whose bounds can contain the coordinate are summed,
+  /// they are found by binary search in the ordered track information.
+  ///
   /// @param state The track density state
   /// @param z z-position along the beamline
   ///
@@ -174,27 +195,9 @@ class GaussianTrackDensity {
   /// @return The step size
   double stepSize(double y, double dy, double ddy) const;
 
-  // Helper class to evaluate and store track density at specific position
-  class GaussianTrackDensityStore {
-   public:
-    // Initialise at the z coordinate at which the density is to be evaluated
-    GaussianTrackDensityStore(double z_coordinate) : m_z(z_coordinate) {}
-
-    // Add the contribution of a single track to the density
-    void addTrackToDensity(const TrackEntry& entry);
-
-    // Return density, first and second derivatives
-    inline std::tuple<double, double, double> densityAndDerivatives() const {
-      return {m_density, m_firstDerivative, m_secondDerivative};
-    }
-
-   private:
-    // Store density and derivatives for z position m_z
-    double m_z;
-    double m_density{0};
-    double m_firstDerivative{0};
-    double m_secondDerivative{0};
-  };
+  /// The number of tracks evaluated together, the temporary arrays stay on
+  /// the stack
+  static constexpr size_t s_chunkSize = 64;
 };
 
 #include "Acts/Vertexing/GaussianTrackDensity.ipp"
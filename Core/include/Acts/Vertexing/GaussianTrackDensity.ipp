@@ -15,6 +15,7 @@ Acts::GaussianTrackDensity<input_track_t>::globalMaximumWithWidth(
     const std::function<BoundParameters(input_track_t)>& extractParameters)
     const {
   addTracks(state, trackList, extractParameters);
+  sortTracks(state);
 
   double maxPosition = 0.;
   double maxDensity = 0.;
@@ -114,15 +115,69 @@ void Acts::GaussianTrackDensity<input_track_t>::addTracks(
   }
 }
 
+template <typename input_track_t>
+void Acts::GaussianTrackDensity<input_track_t>::sortTracks(State& state) const {
+  const auto& entries = state.trackEntries;
+  std::vector<size_t> order(entries.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return entries[a].lowerBound < entries[b].lowerBound;
+  });
+
+  for (auto* array : {&state.lowerBounds, &state.upperBounds, &state.c0,
+                      &state.c1, &state.c2, &state.maxUpperBounds}) {
+    array->resize(entries.size());
+  }
+  double maxUpperBound = std::numeric_limits<double>::lowest();
+  for (size_t i = 0; i < order.size(); ++i) {
+    const TrackEntry& entry = entries[order[i]];
+    state.lowerBounds[i] = entry.lowerBound;
+    state.upperBounds[i] = entry.upperBound;
+    state.c0[i] = entry.c0;
+    state.c1[i] = entry.c1;
+    state.c2[i] = entry.c2;
+    maxUpperBound = std::max(maxUpperBound, entry.upperBound);
+    state.maxUpperBounds[i] = maxUpperBound;
+  }
+}
+
 template <typename input_track_t>
 std::tuple<double, double, double>
 Acts::GaussianTrackDensity<input_track_t>::trackDensityAndDerivatives(
     State& state, double z) const {
-  GaussianTrackDensityStore densityResult(z);
-  for (const auto& trackEntry : state.trackEntries) {
-    densityResult.addTrackToDensity(trackEntry);
+  using Chunk =
+      Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor, s_chunkSize, 1>;
+
+  // Take tracks only if z is within their bounds: all tracks in front of
+  // the first running maximum above z end before it and all tracks from the
+  // first lower bound at z on start behind it
+  const double* maxUpperBounds = state.maxUpperBounds.data();
+  const double* lowerBounds = state.lowerBounds.data();
+  const size_t nTracks = state.lowerBounds.size();
+  const size_t begin =
+      std::upper_bound(maxUpperBounds, maxUpperBounds + nTracks, z) -
+      maxUpperBounds;
+  const size_t end =
+      std::lower_bound(lowerBounds, lowerBounds + nTracks, z) - lowerBounds;
+
+  double density = 0.;
+  double firstDerivative = 0.;
+  double secondDerivative = 0.;
+  for (size_t chunk = begin; chunk < end; chunk += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, end - chunk);
+    const auto c0 = state.c0.segment(chunk, n);
+    const auto c1 = state.c1.segment(chunk, n);
+    const auto c2 = state.c2.segment(chunk, n);
+    // the exponential is evaluated on the whole chunk and vectorized
+    const Chunk delta = (state.upperBounds.segment(chunk, n) > z)
+                            .select((c0 + z * (c1 + z * c2)).exp(), 0.);
+    const Chunk qPrime = c1 + 2. * z * c2;
+    const Chunk deltaPrime = delta * qPrime;
+    density += delta.sum();
+    firstDerivative += deltaPrime.sum();
+    secondDerivative += (2. * c2 * delta + qPrime * deltaPrime).sum();
   }
-  return densityResult.densityAndDerivatives();
+  return {density, firstDerivative, secondDerivative};
 }
 
 template <typename input_track_t>
@@ -143,17 +198,3 @@ double Acts::GaussianTrackDensity<input_track_t>::stepSize(double y, double dy,
                                                            double ddy) const {
   return (m_cfg.isGaussianShaped ? (y * dy) / (dy * dy - y * ddy) : -dy / ddy);
 }
-
-template <typename input_track_t>
-void Acts::GaussianTrackDensity<input_track_t>::GaussianTrackDensityStore::
-    addTrackToDensity(const TrackEntry& entry) {
-  // Take track only if it's within bounds
-  if (entry.lowerBound < m_z && m_z < entry.upperBound) {
-    double delta = std::exp(entry.c0 + m_z * (entry.c1 + m_z * entry.c2));
-    double qPrime = entry.c1 + 2. * m_z * entry.c2;
-    double deltaPrime = delta * qPrime;
-    m_density += delta;
-    m_firstDerivative += deltaPrime;
-    m_secondDerivative += 2. * entry.c2 * delta + qPrime * deltaPrime;
-  }
-}
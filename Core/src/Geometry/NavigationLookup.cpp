@@ -0,0 +1,178 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/NavigationLookup.hpp"
+
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+Acts::NavigationLookup::NavigationLookup(const GeometryContext& gctx,
+                                         const TrackingGeometry& tGeometry,
+                                         const Config& cfg)
+    : m_cfg(cfg) {
+  if (m_cfg.nPhiBins == 0 or m_cfg.nEtaBins == 0) {
+    throw std::invalid_argument("Navigation lookup needs direction bins");
+  }
+  if (not(m_cfg.etaMin < m_cfg.etaMax)) {
+    throw std::invalid_argument("Navigation lookup needs a valid eta range");
+  }
+  buildVolume(gctx, *tGeometry.highestTrackingVolume());
+}
+
+const Acts::NavigationLookup::Surfaces* Acts::NavigationLookup::candidates(
+    const GeometryContext& gctx, const Layer& layer, const Vector3D& position,
+    const Vector3D& direction) const {
+  auto layerCandidates = m_layers.find(&layer);
+  if (layerCandidates == m_layers.end()) {
+    return nullptr;
+  }
+  // the line from the origin through the position defines the bin
+  const Vector3D line = position - m_cfg.origin;
+  const size_t bin = directionBin(line);
+  if (bin == layerCandidates->second.size()) {
+    return nullptr;
+  }
+  // the track has to stay within the tolerance of that line while it
+  // crosses the layer, i.e. within the path limit of the surface search
+  const double sinAngle =
+      line.normalized().cross(direction.normalized()).norm();
+  const double pathInLayer =
+      1.5 * layer.thickness() *
+      layer.surfaceRepresentation().pathCorrection(gctx, position, direction);
+  if (not(sinAngle * pathInLayer <= m_cfg.tolerance)) {
+    return nullptr;
+  }
+  return &layerCandidates->second[bin];
+}
+
+size_t Acts::NavigationLookup::directionBin(const Vector3D& direction) const {
+  const double eta = VectorHelpers::eta(direction);
+  if (not(m_cfg.etaMin <= eta and eta < m_cfg.etaMax)) {
+    return m_cfg.nPhiBins * m_cfg.nEtaBins;
+  }
+  const double phi = VectorHelpers::phi(direction);
+  const size_t iPhi =
+      std::min(static_cast<size_t>((phi + M_PI) / (2 * M_PI) * m_cfg.nPhiBins),
+               m_cfg.nPhiBins - 1);
+  const size_t iEta = std::min(
+      static_cast<size_t>((eta - m_cfg.etaMin) / (m_cfg.etaMax - m_cfg.etaMin) *
+                          m_cfg.nEtaBins),
+      m_cfg.nEtaBins - 1);
+  return iEta * m_cfg.nPhiBins + iPhi;
+}
+
+void Acts::NavigationLookup::buildVolume(const GeometryContext& gctx,
+                                         const TrackingVolume& volume) {
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      buildVolume(gctx, *subVolume);
+    }
+  }
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      if (layer->surfaceArray() != nullptr) {
+        buildLayer(gctx, *layer);
+      }
+    }
+  }
+}
+
+void Acts::NavigationLookup::buildLayer(const GeometryContext& gctx,
+                                        const Layer& layer) {
+  // number of points per polyhedron edge and segments for curved bounds
+  constexpr size_t nEdgePoints = 8;
+  const double phiBinWidth = 2 * M_PI / m_cfg.nPhiBins;
+  const double etaBinWidth = (m_cfg.etaMax - m_cfg.etaMin) / m_cfg.nEtaBins;
+
+  std::vector<Surfaces> bins(m_cfg.nPhiBins * m_cfg.nEtaBins);
+  for (const Surface* surface : layer.surfaceArray()->surfaces()) {
+    // The angular footprint of the surface as seen from the origin. phi is
+    // monotonic along straight edges, but eta is not, i.e. the edges are
+    // sampled. The tolerance is added as an angle at each point.
+    const Vector3D center = surface->center(gctx) - m_cfg.origin;
+    const double phiCenter = VectorHelpers::phi(center);
+    double phiMin = M_PI;
+    double phiMax = -M_PI;
+    double etaMin = std::numeric_limits<double>::max();
+    double etaMax = std::numeric_limits<double>::lowest();
+    auto addPoint = [&](const Vector3D& point) {
+      const Vector3D line = point - m_cfg.origin;
+      const double r = VectorHelpers::perp(line);
+      const double margin =
+          (r > 0) ? m_cfg.tolerance / r : std::numeric_limits<double>::max();
+      // phi relative to the center to avoid the wrap around
+      const double dPhi =
+          detail::radian_sym(VectorHelpers::phi(line) - phiCenter);
+      const double eta = VectorHelpers::eta(line);
+      phiMin = std::min(phiMin, dPhi - margin);
+      phiMax = std::max(phiMax, dPhi + margin);
+      etaMin = std::min(etaMin, eta - margin);
+      etaMax = std::max(etaMax, eta + margin);
+    };
+    const Polyhedron polyhedron =
+        surface->polyhedronRepresentation(gctx, nEdgePoints);
+    for (const auto& face : polyhedron.faces) {
+      for (size_t iv = 0; iv < face.size(); ++iv) {
+        const Vector3D& start = polyhedron.vertices[face[iv]];
+        const Vector3D& end = polyhedron.vertices[face[(iv + 1) % face.size()]];
+        for (size_t ip = 0; ip < nEdgePoints; ++ip) {
+          addPoint(start + (end - start) * ip / nEdgePoints);
+        }
+      }
+    }
+
+    // overlapping bins, a footprint around the z axis covers all of phi
+    if (etaMax < m_cfg.etaMin or m_cfg.etaMax <= etaMin) {
+      continue;
+    }
+    const size_t iEtaMin = static_cast<size_t>(
+        std::floor((std::max(etaMin, m_cfg.etaMin) - m_cfg.etaMin) /
+                   etaBinWidth));
+    const size_t iEtaMax =
+        std::min(static_cast<size_t>(std::floor(
+                     (std::min(etaMax, m_cfg.etaMax) - m_cfg.etaMin) /
+                     etaBinWidth)),
+                 m_cfg.nEtaBins - 1);
+    long iPhiMin = 0;
+    long iPhiMax = m_cfg.nPhiBins - 1;
+    if (phiMax - phiMin < M_PI) {
+      iPhiMin = std::floor((phiCenter + phiMin + M_PI) / phiBinWidth);
+      iPhiMax = std::floor((phiCenter + phiMax + M_PI) / phiBinWidth);
+      iPhiMax = std::min(iPhiMax, iPhiMin + long(m_cfg.nPhiBins) - 1);
+    }
+    const long nPhiBins = m_cfg.nPhiBins;
+    for (size_t iEta = iEtaMin; iEta <= iEtaMax; ++iEta) {
+      for (long iPhi = iPhiMin; iPhi <= iPhiMax; ++iPhi) {
+        const size_t iPhiWrapped = ((iPhi % nPhiBins) + nPhiBins) % nPhiBins;
+        bins[iEta * m_cfg.nPhiBins + iPhiWrapped].push_back(surface);
+      }
+    }
+  }
+
+  // order the candidates by their distance from the origin
+  for (auto& candidates : bins) {
+    std::sort(candidates.begin(), candidates.end(),
+              [&](const Surface* a, const Surface* b) {
+                return (a->center(gctx) - m_cfg.origin).norm() <
+                       (b->center(gctx) - m_cfg.origin).norm();
+              });
+    candidates.shrink_to_fit();
+  }
+  m_layers.emplace(&layer, std::move(bins));
+}
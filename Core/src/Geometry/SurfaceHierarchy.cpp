@@ -0,0 +1,209 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/SurfaceHierarchy.hpp"
+
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/// The surface area of a box with the given extent
+double boxArea(const Acts::Vector3D& extent) {
+  return 2 * (extent.x() * extent.y() + extent.y() * extent.z() +
+              extent.z() * extent.x());
+}
+
+}  // namespace
+
+Acts::SurfaceHierarchy::SurfaceHierarchy(
+    const GeometryContext& gctx, const std::vector<const Surface*>& surfaces,
+    const Config& cfg)
+    : m_cfg(cfg) {
+  if (m_cfg.maxLeafSize == 0 or m_cfg.nSahBins < 2) {
+    throw std::invalid_argument(
+        "Surface hierarchy needs non-empty leaves and two SAH bins");
+  }
+  if (surfaces.empty()) {
+    return;
+  }
+
+  // the boxes of the surfaces, the surface is the box entity
+  const Vector3D envelope = Vector3D::Constant(m_cfg.envelope);
+  std::vector<BoundingBox> boxes;
+  boxes.reserve(surfaces.size());
+  for (const Surface* surface : surfaces) {
+    const Polyhedron polyhedron =
+        surface->polyhedronRepresentation(gctx, m_cfg.nSegments);
+    Vector3D vmin = Vector3D::Constant(std::numeric_limits<double>::max());
+    Vector3D vmax = Vector3D::Constant(std::numeric_limits<double>::lowest());
+    for (const Vector3D& vertex : polyhedron.vertices) {
+      vmin = vmin.cwiseMin(vertex);
+      vmax = vmax.cwiseMax(vertex);
+    }
+    boxes.emplace_back(surface, vmin - envelope, vmax + envelope);
+  }
+
+  // a binary tree with leaves of at least one surface
+  m_nodes.reserve(2 * surfaces.size());
+  build(boxes, 0, boxes.size());
+  m_nodes.shrink_to_fit();
+
+  m_surfaces.reserve(boxes.size());
+  for (const auto& box : boxes) {
+    m_surfaces.push_back(box.entity());
+  }
+}
+
+void Acts::SurfaceHierarchy::build(std::vector<BoundingBox>& boxes,
+                                   size_t first, size_t last) {
+  Vector3D vmin = Vector3D::Constant(std::numeric_limits<double>::max());
+  Vector3D vmax = Vector3D::Constant(std::numeric_limits<double>::lowest());
+  for (size_t ib = first; ib < last; ++ib) {
+    vmin = vmin.cwiseMin(boxes[ib].min());
+    vmax = vmax.cwiseMax(boxes[ib].max());
+  }
+  // the node is a leaf until it is split, the index is stable while the
+  // node array grows
+  const size_t iNode = m_nodes.size();
+  m_nodes.push_back(
+      Node{BoundingBox(nullptr, vmin, vmax), 0, first, last - first});
+  if (last - first > m_cfg.maxLeafSize) {
+    const size_t middle = split(boxes, first, last, vmin, vmax);
+    if (middle != first and middle != last) {
+      m_nodes[iNode].first = 0;
+      m_nodes[iNode].count = 0;
+      build(boxes, first, middle);
+      build(boxes, middle, last);
+    }
+  }
+  m_nodes[iNode].skip = m_nodes.size();
+}
+
+size_t Acts::SurfaceHierarchy::split(std::vector<BoundingBox>& boxes,
+                                     size_t first, size_t last,
+                                     const Vector3D& vmin,
+                                     const Vector3D& vmax) const {
+  const size_t nBins = m_cfg.nSahBins;
+  const double parentArea = boxArea(vmax - vmin);
+
+  // range of the box centers
+  Vector3D cmin = Vector3D::Constant(std::numeric_limits<double>::max());
+  Vector3D cmax = Vector3D::Constant(std::numeric_limits<double>::lowest());
+  for (size_t ib = first; ib < last; ++ib) {
+    cmin = cmin.cwiseMin(boxes[ib].center());
+    cmax = cmax.cwiseMax(boxes[ib].center());
+  }
+
+  struct Bin {
+    size_t count = 0;
+    Vector3D vmin = Vector3D::Constant(std::numeric_limits<double>::max());
+    Vector3D vmax = Vector3D::Constant(std::numeric_limits<double>::lowest());
+  };
+  auto binIndex = [&](const BoundingBox& box, int axis) {
+    const double extent = cmax[axis] - cmin[axis];
+    return std::min(static_cast<size_t>((box.center()[axis] - cmin[axis]) /
+                                        extent * nBins),
+                    nBins - 1);
+  };
+
+  double bestCost = std::numeric_limits<double>::max();
+  int bestAxis = -1;
+  size_t bestBin = 0;
+  std::vector<Bin> bins(nBins);
+  std::vector<double> rightCost(nBins);
+  for (int axis = 0; axis < 3; ++axis) {
+    if (not(cmax[axis] > cmin[axis])) {
+      continue;
+    }
+    std::fill(bins.begin(), bins.end(), Bin());
+    for (size_t ib = first; ib < last; ++ib) {
+      Bin& bin = bins[binIndex(boxes[ib], axis)];
+      ++bin.count;
+      bin.vmin = bin.vmin.cwiseMin(boxes[ib].min());
+      bin.vmax = bin.vmax.cwiseMax(boxes[ib].max());
+    }
+    // sweep from the right to get the cost of all right sides, then from
+    // the left to evaluate the split in front of each bin
+    Bin right;
+    for (size_t ib = nBins - 1; ib > 0; --ib) {
+      right.count += bins[ib].count;
+      right.vmin = right.vmin.cwiseMin(bins[ib].vmin);
+      right.vmax = right.vmax.cwiseMax(bins[ib].vmax);
+      rightCost[ib] =
+          (right.count > 0) ? right.count * boxArea(right.vmax - right.vmin)
+                            : 0.;
+    }
+    Bin left;
+    for (size_t ib = 1; ib < nBins; ++ib) {
+      left.count += bins[ib - 1].count;
+      left.vmin = left.vmin.cwiseMin(bins[ib - 1].vmin);
+      left.vmax = left.vmax.cwiseMax(bins[ib - 1].vmax);
+      if (left.count == 0 or left.count == last - first) {
+        continue;
+      }
+      const double cost =
+          (left.count * boxArea(left.vmax - left.vmin) + rightCost[ib]) /
+          parentArea;
+      if (cost < bestCost) {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = ib;
+      }
+    }
+  }
+
+  if (bestAxis < 0) {
+    return first;
+  }
+  auto middle = std::partition(boxes.begin() + first, boxes.begin() + last,
+                               [&](const BoundingBox& box) {
+                                 return binIndex(box, bestAxis) < bestBin;
+                               });
+  return std::distance(boxes.begin(), middle);
+}
+
+Acts::SurfaceHierarchies::SurfaceHierarchies(
+    const GeometryContext& gctx, const TrackingGeometry& tGeometry,
+    const SurfaceHierarchy::Config& cfg) {
+  buildVolume(gctx, *tGeometry.highestTrackingVolume(), cfg);
+}
+
+const Acts::SurfaceHierarchy* Acts::SurfaceHierarchies::find(
+    const Layer& layer) const {
+  auto hierarchy = m_hierarchies.find(&layer);
+  return (hierarchy != m_hierarchies.end()) ? &hierarchy->second : nullptr;
+}
+
+void Acts::SurfaceHierarchies::buildVolume(
+    const GeometryContext& gctx, const TrackingVolume& volume,
+    const SurfaceHierarchy::Config& cfg) {
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      buildVolume(gctx, *subVolume, cfg);
+    }
+  }
+  if (volume.confinedLayers() == nullptr) {
+    return;
+  }
+  for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+    if (layer->surfaceArray() != nullptr) {
+      m_hierarchies.emplace(
+          layer.get(),
+          SurfaceHierarchy(gctx, layer->surfaceArray()->surfaces(), cfg));
+    }
+  }
+}
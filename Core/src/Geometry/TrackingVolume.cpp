@@ -477,9 +477,18 @@ Acts::TrackingVolume::compatibleBoundaries(
     const GeometryContext& gctx, const Vector3D& position,
     const Vector3D& direction,
     const NavigationOptions<Surface>& options) const {
+  std::vector<BoundaryIntersection> bIntersections;
+  compatibleBoundaries(gctx, position, direction, options, bIntersections);
+  return bIntersections;
+}
+
+void Acts::TrackingVolume::compatibleBoundaries(
+    const GeometryContext& gctx, const Vector3D& position,
+    const Vector3D& direction, const NavigationOptions<Surface>& options,
+    std::vector<BoundaryIntersection>& bIntersections) const {
+  bIntersections.clear();
   // Loop over boundarySurfaces and calculate the intersection
   auto excludeObject = options.startObject;
-  std::vector<BoundaryIntersection> bIntersections;
 
   // The signed direction: solution (except overstepping) is positive
   auto sDirection = options.navDir * direction;
@@ -557,12 +566,8 @@ Acts::TrackingVolume::compatibleBoundaries(
   }
 
   // Sort them accordingly to the navigation direction
-  if (options.navDir == forward) {
-    std::sort(bIntersections.begin(), bIntersections.end());
-  } else {
-    std::sort(bIntersections.begin(), bIntersections.end(), std::greater<>());
-  }
-  return bIntersections;
+  sortIntersections(bIntersections.begin(), bIntersections.end(),
+                    options.navDir);
 }
 
 std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
@@ -570,6 +575,15 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
     const Vector3D& direction, const NavigationOptions<Layer>& options) const {
   // the layer intersections which are valid
   std::vector<LayerIntersection> lIntersections;
+  compatibleLayers(gctx, position, direction, options, lIntersections);
+  return lIntersections;
+}
+
+void Acts::TrackingVolume::compatibleLayers(
+    const GeometryContext& gctx, const Vector3D& position,
+    const Vector3D& direction, const NavigationOptions<Layer>& options,
+    std::vector<LayerIntersection>& lIntersections) const {
+  lIntersections.clear();
 
   // the confinedLayers
   if (m_confinedLayers != nullptr) {
@@ -605,15 +619,11 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
               ? nullptr
               : tLayer->nextLayer(gctx, position, options.navDir * direction);
     }
-    // sort them accordingly to the navigation direction
-    if (options.navDir == forward) {
-      std::sort(lIntersections.begin(), lIntersections.end());
-    } else {
-      std::sort(lIntersections.begin(), lIntersections.end(), std::greater<>());
-    }
+    // sort them accordingly to the navigation direction, the layers are
+    // walked along the direction and thus collected in order already
+    sortIntersections(lIntersections.begin(), lIntersections.end(),
+                      options.navDir);
   }
-  // and return
-  return lIntersections;
 }
 
 namespace {
@@ -692,11 +702,8 @@ Acts::TrackingVolume::compatibleSurfacesFromHierarchy(
   }
 
   // Sort according to the path length
-  if (options.navDir == forward) {
-    std::sort(sIntersections.begin(), sIntersections.end());
-  } else {
-    std::sort(sIntersections.begin(), sIntersections.end(), std::greater<>());
-  }
+  sortIntersections(sIntersections.begin(), sIntersections.end(),
+                    options.navDir);
 
   return sIntersections;
 }
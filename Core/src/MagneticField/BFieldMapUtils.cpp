@@ -13,20 +13,44 @@
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+/// Storage policy for the given field values, integral values are scaled
+/// such that the largest field component is represented by the largest
+/// integer
+template <typename scalar_t, typename vector_t>
+Acts::BFieldMapStorage<scalar_t> makeStorage(
+    const std::vector<vector_t>& bField, double BFieldUnit) {
+  Acts::BFieldMapStorage<scalar_t> storage;
+  if constexpr (std::is_integral_v<scalar_t>) {
+    double maxAbs = 0.;
+    for (const auto& value : bField) {
+      maxAbs = std::max(maxAbs, value.cwiseAbs().maxCoeff());
+    }
+    maxAbs *= std::abs(BFieldUnit);
+    if (maxAbs > 0.) {
+      storage.scale = maxAbs / std::numeric_limits<scalar_t>::max();
+    }
+  }
+  return storage;
+}
 
-using Acts::VectorHelpers::perp;
-using Acts::VectorHelpers::phi;
+}  // namespace
 
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
-                                               std::array<size_t, 2> nBinsRZ)>&
-                        localToGlobalBin,
-                    std::vector<double> rPos, std::vector<double> zPos,
-                    std::vector<Acts::Vector2D> bField, double lengthUnit,
-                    double BFieldUnit, bool firstQuadrant) {
+template <typename scalar_t>
+Acts::CompactBFieldMapperRZ<scalar_t> Acts::fieldMapperRZ(
+    const std::function<size_t(std::array<size_t, 2> binsRZ,
+                               std::array<size_t, 2> nBinsRZ)>&
+        localToGlobalBin,
+    std::vector<double> rPos, std::vector<double> zPos,
+    std::vector<Acts::Vector2D> bField, double lengthUnit, double BFieldUnit,
+    bool firstQuadrant) {
   // [1] Create Grid
   // sort the values
   std::sort(rPos.begin(), rPos.end());
@@ -65,71 +89,47 @@ Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
                                       nBinsZ);
 
   // Create the grid
-  using Grid_t =
-      Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis>;
+  using Mapper_t = Acts::CompactBFieldMapperRZ<scalar_t>;
+  using Grid_t = typename Mapper_t::Grid_t;
   Grid_t grid(std::make_tuple(std::move(rAxis), std::move(zAxis)));
 
-  // [2] Set the bField values
+  // [2] Set the bField values, encoded for storage
+  const auto storage = makeStorage<scalar_t>(bField, BFieldUnit);
   for (size_t i = 1; i <= nBinsR; ++i) {
     for (size_t j = 1; j <= nBinsZ; ++j) {
       std::array<size_t, 2> nIndices = {{rPos.size(), zPos.size()}};
-      Grid_t::index_t indices = {{i, j}};
+      typename Grid_t::index_t indices = {{i, j}};
       if (firstQuadrant) {
         // std::vectors begin with 0 and we do not want the user needing to
         // take underflow or overflow bins in account this is why we need to
         // subtract by one
         size_t n = std::abs(int(j) - int(zPos.size()));
-        Grid_t::index_t indicesFirstQuadrant = {{i - 1, n}};
+        typename Grid_t::index_t indicesFirstQuadrant = {{i - 1, n}};
 
-        grid.atLocalBins(indices) =
+        grid.atLocalBins(indices) = storage.encode(
             bField.at(localToGlobalBin(indicesFirstQuadrant, nIndices)) *
-            BFieldUnit;
+            BFieldUnit);
       } else {
         // std::vectors begin with 0 and we do not want the user needing to
         // take underflow or overflow bins in account this is why we need to
         // subtract by one
-        grid.atLocalBins(indices) =
+        grid.atLocalBins(indices) = storage.encode(
             bField.at(localToGlobalBin({{i - 1, j - 1}}, nIndices)) *
-            BFieldUnit;
+            BFieldUnit);
       }
     }
   }
-  grid.setExteriorBins(Acts::Vector2D::Zero());
-
-  // [3] Create the transformation for the position
-  // map (x,y,z) -> (r,z)
-  auto transformPos = [](const Acts::Vector3D& pos) {
-    return Acts::Vector2D(perp(pos), pos.z());
-  };
+  grid.setExteriorBins(Grid_t::value_type::Zero());
 
-  // [4] Create the transformation for the bfield
-  // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2D& field,
-                            const Acts::Vector3D& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi, sin_phi;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3D(field.x() * cos_phi, field.x() * sin_phi, field.y());
-  };
-
-  // [5] Create the mapper & BField Service
+  // [3] Create the mapper & BField Service using the transformations
+  // map (x,y,z) -> (r,z) and (Br,Bz) -> (Bx,By,Bz)
   // create field mapping
-  return Acts::InterpolatedBFieldMapper<Grid_t>(transformPos, transformBField,
-                                                std::move(grid));
+  return Mapper_t(Acts::RZPositionTransform(), Acts::RZFieldTransform(),
+                  std::move(grid), storage);
 }
 
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-Acts::fieldMapperXYZ(
+template <typename scalar_t>
+Acts::CompactBFieldMapperXYZ<scalar_t> Acts::fieldMapperXYZ(
     const std::function<size_t(std::array<size_t, 3> binsXYZ,
                                std::array<size_t, 3> nBinsXYZ)>&
         localToGlobalBin,
@@ -191,18 +191,17 @@ Acts::fieldMapperXYZ(
   Acts::detail::EquidistantAxis zAxis(zMin * lengthUnit, zMax * lengthUnit,
                                       nBinsZ);
   // Create the grid
-  using Grid_t =
-      Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis>;
+  using Mapper_t = Acts::CompactBFieldMapperXYZ<scalar_t>;
+  using Grid_t = typename Mapper_t::Grid_t;
   Grid_t grid(
       std::make_tuple(std::move(xAxis), std::move(yAxis), std::move(zAxis)));
 
-  // [2] Set the bField values
+  // [2] Set the bField values, encoded for storage
+  const auto storage = makeStorage<scalar_t>(bField, BFieldUnit);
   for (size_t i = 1; i <= nBinsX; ++i) {
     for (size_t j = 1; j <= nBinsY; ++j) {
       for (size_t k = 1; k <= nBinsZ; ++k) {
-        Grid_t::index_t indices = {{i, j, k}};
+        typename Grid_t::index_t indices = {{i, j, k}};
         std::array<size_t, 3> nIndices = {
             {xPos.size(), yPos.size(), zPos.size()}};
         if (firstOctant) {
@@ -212,47 +211,54 @@ Acts::fieldMapperXYZ(
           size_t m = std::abs(int(i) - (int(xPos.size())));
           size_t n = std::abs(int(j) - (int(yPos.size())));
           size_t l = std::abs(int(k) - (int(zPos.size())));
-          Grid_t::index_t indicesFirstOctant = {{m, n, l}};
+          typename Grid_t::index_t indicesFirstOctant = {{m, n, l}};
 
-          grid.atLocalBins(indices) =
+          grid.atLocalBins(indices) = storage.encode(
               bField.at(localToGlobalBin(indicesFirstOctant, nIndices)) *
-              BFieldUnit;
+              BFieldUnit);
 
         } else {
           // std::vectors begin with 0 and we do not want the user needing to
           // take underflow or overflow bins in account this is why we need to
           // subtract by one
-          grid.atLocalBins(indices) =
+          grid.atLocalBins(indices) = storage.encode(
               bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
-              BFieldUnit;
+              BFieldUnit);
         }
       }
     }
   }
-  grid.setExteriorBins(Acts::Vector3D::Zero());
-
-  // [3] Create the transformation for the position
-  // map (x,y,z) -> (r,z)
-  auto transformPos = [](const Acts::Vector3D& pos) { return pos; };
+  grid.setExteriorBins(Grid_t::value_type::Zero());
 
-  // [4] Create the transformation for the bfield
-  // map (Bx,By,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector3D& field,
-                            const Acts::Vector3D& /*pos*/) { return field; };
-
-  // [5] Create the mapper & BField Service
+  // [3] Create the mapper & BField Service using the identity transformations
+  // map (x,y,z) -> (x,y,z) and (Bx,By,Bz) -> (Bx,By,Bz)
   // create field mapping
-  return Acts::InterpolatedBFieldMapper<Grid_t>(transformPos, transformBField,
-                                                std::move(grid));
+  return Mapper_t(Acts::XYZPositionTransform(), Acts::XYZFieldTransform(),
+                  std::move(grid), storage);
 }
 
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-Acts::solenoidFieldMapper(std::pair<double, double> rlim,
-                          std::pair<double, double> zlim,
-                          std::pair<size_t, size_t> nbins,
-                          const SolenoidBField& field) {
+// the supported storage types
+#define ACTS_FIELD_MAPPER_INSTANTIATION(scalar_t)                           \
+  template Acts::CompactBFieldMapperRZ<scalar_t>                            \
+  Acts::fieldMapperRZ<scalar_t>(                                            \
+      const std::function<size_t(std::array<size_t, 2>,                     \
+                                 std::array<size_t, 2>)>&,                  \
+      std::vector<double>, std::vector<double>, std::vector<Acts::Vector2D>, \
+      double, double, bool);                                                \
+  template Acts::CompactBFieldMapperXYZ<scalar_t>                           \
+  Acts::fieldMapperXYZ<scalar_t>(                                           \
+      const std::function<size_t(std::array<size_t, 3>,                     \
+                                 std::array<size_t, 3>)>&,                  \
+      std::vector<double>, std::vector<double>, std::vector<double>,        \
+      std::vector<Acts::Vector3D>, double, double, bool);
+ACTS_FIELD_MAPPER_INSTANTIATION(double)
+ACTS_FIELD_MAPPER_INSTANTIATION(float)
+ACTS_FIELD_MAPPER_INSTANTIATION(int16_t)
+#undef ACTS_FIELD_MAPPER_INSTANTIATION
+
+Acts::InterpolatedBFieldMapperRZ Acts::solenoidFieldMapper(
+    std::pair<double, double> rlim, std::pair<double, double> zlim,
+    std::pair<size_t, size_t> nbins, const SolenoidBField& field) {
   double rMin, rMax, zMin, zMax;
   std::tie(rMin, rMax) = rlim;
   std::tie(zMin, zMax) = zlim;
@@ -276,30 +282,6 @@ Acts::solenoidFieldMapper(std::pair<double, double> rlim,
                          Acts::detail::EquidistantAxis>;
   Grid_t grid(std::make_tuple(std::move(rAxis), std::move(zAxis)));
 
-  // Create the transformation for the position
-  // map (x,y,z) -> (r,z)
-  auto transformPos = [](const Acts::Vector3D& pos) {
-    return Acts::Vector2D(perp(pos), pos.z());
-  };
-
-  // Create the transformation for the bfield
-  // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2D& bfield,
-                            const Acts::Vector3D& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi, sin_phi;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3D(bfield.x() * cos_phi, bfield.x() * sin_phi,
-                          bfield.y());
-  };
-
   // iterate over all bins, set their value to the solenoid value
   // at their lower left position
   for (size_t i = 0; i <= nBinsR + 1; i++) {
@@ -318,9 +300,10 @@ Acts::solenoidFieldMapper(std::pair<double, double> rlim,
     }
   }
 
-  // Create the mapper & BField Service
+  // Create the mapper & BField Service using the transformations
+  // map (x,y,z) -> (r,z) and (Br,Bz) -> (Bx,By,Bz)
   // create field mapping
-  Acts::InterpolatedBFieldMapper<Grid_t> mapper(transformPos, transformBField,
-                                                std::move(grid));
-  return mapper;
+  return Acts::InterpolatedBFieldMapperRZ(Acts::RZPositionTransform(),
+                                          Acts::RZFieldTransform(),
+                                          std::move(grid));
 }
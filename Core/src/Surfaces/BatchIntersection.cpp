@@ -0,0 +1,244 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/BatchIntersection.hpp"
+
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+/// The number of tracks processed together, the temporary arrays of a chunk
+/// stay on the stack and in the first level cache
+constexpr size_t s_chunkSize = 64;
+
+using Array = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor,
+                           s_chunkSize, 1>;
+
+/// The status of an intersection at a valid path length
+Acts::Intersection::Status pathStatus(double path) {
+  return (path * path < Acts::s_onSurfaceTolerance * Acts::s_onSurfaceTolerance)
+             ? Acts::Intersection::Status::onSurface
+             : Acts::Intersection::Status::reachable;
+}
+
+/// Set an invalid intersection, as the default Intersection
+void setInvalid(Acts::IntersectionBlock& intersections, size_t i) {
+  intersections.x[i] = 0.;
+  intersections.y[i] = 0.;
+  intersections.z[i] = 0.;
+  intersections.pathLength[i] = std::numeric_limits<double>::infinity();
+  intersections.status[i] = Acts::Intersection::Status::unreachable;
+}
+
+}  // namespace
+
+void Acts::BatchIntersection::intersect(const GeometryContext& gctx,
+                                        const PlaneSurface& surface,
+                                        const RayBlock& rays,
+                                        const BoundaryCheck& bcheck,
+                                        IntersectionBlock& intersections) {
+  intersections.resize(rays.size());
+
+  const auto& tMatrix = surface.transform(gctx).matrix();
+  const Vector3D normal = tMatrix.block<3, 1>(0, 2);
+  const Vector3D center = tMatrix.block<3, 1>(0, 3);
+  const auto& bounds = surface.bounds();
+  // rectangles are checked on the arrays for absolute checks
+  const bool checkRectangle = bcheck and
+                              bounds.type() == SurfaceBounds::eRectangle and
+                              bcheck.type() == BoundaryCheck::Type::eAbsolute;
+
+  for (size_t begin = 0; begin < rays.size(); begin += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, rays.size() - begin);
+    const auto x = rays.x.segment(begin, n);
+    const auto y = rays.y.segment(begin, n);
+    const auto z = rays.z.segment(begin, n);
+    const auto dx = rays.dx.segment(begin, n);
+    const auto dy = rays.dy.segment(begin, n);
+    const auto dz = rays.dz.segment(begin, n);
+
+    // the maths of PlanarHelper::intersect on the arrays
+    const Array denom = dx * normal.x() + dy * normal.y() + dz * normal.z();
+    const Array path = ((center.x() - x) * normal.x() +
+                        (center.y() - y) * normal.y() +
+                        (center.z() - z) * normal.z()) /
+                       denom;
+    const Array ix = x + path * dx;
+    const Array iy = y + path * dy;
+    const Array iz = z + path * dz;
+    intersections.x.segment(begin, n) = ix;
+    intersections.y.segment(begin, n) = iy;
+    intersections.z.segment(begin, n) = iz;
+    intersections.pathLength.segment(begin, n) = path;
+    for (size_t i = 0; i < n; ++i) {
+      if (denom[i] != 0.) {
+        intersections.status[begin + i] = pathStatus(path[i]);
+      } else {
+        setInvalid(intersections, begin + i);
+      }
+    }
+    if (not bcheck) {
+      continue;
+    }
+
+    // local coordinates of the intersections
+    const Array lx = ix - center.x();
+    const Array ly = iy - center.y();
+    const Array lz = iz - center.z();
+    const Array loc0 =
+        lx * tMatrix(0, 0) + ly * tMatrix(1, 0) + lz * tMatrix(2, 0);
+    const Array loc1 =
+        lx * tMatrix(0, 1) + ly * tMatrix(1, 1) + lz * tMatrix(2, 1);
+    if (checkRectangle) {
+      // inside the rectangle or within the tolerance of its closest point
+      const auto& rectangle = static_cast<const RectangleBounds&>(bounds);
+      const Vector2D& vmin = rectangle.min();
+      const Vector2D& vmax = rectangle.max();
+      const Vector2D& tolerance = bcheck.tolerance();
+      const auto inside = ((loc0 - vmax.x()) <= tolerance.x() and
+                           (vmin.x() - loc0) <= tolerance.x() and
+                           (loc1 - vmax.y()) <= tolerance.y() and
+                           (vmin.y() - loc1) <= tolerance.y())
+                              .eval();
+      for (size_t i = 0; i < n; ++i) {
+        if (intersections.status[begin + i] !=
+                Intersection::Status::unreachable and
+            not inside[i]) {
+          intersections.status[begin + i] = Intersection::Status::missed;
+        }
+      }
+      continue;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      if (intersections.status[begin + i] !=
+              Intersection::Status::unreachable and
+          not surface.insideBounds(Vector2D(loc0[i], loc1[i]), bcheck)) {
+        intersections.status[begin + i] = Intersection::Status::missed;
+      }
+    }
+  }
+}
+
+void Acts::BatchIntersection::intersect(const GeometryContext& gctx,
+                                        const CylinderSurface& surface,
+                                        const RayBlock& rays,
+                                        const BoundaryCheck& bcheck,
+                                        IntersectionBlock& intersections) {
+  intersections.resize(rays.size());
+
+  const auto& bounds = surface.bounds();
+  const double R = bounds.get(CylinderBounds::eR);
+  const auto& tMatrix = surface.transform(gctx).matrix();
+  const Vector3D axis = tMatrix.block<3, 1>(0, 2);
+  const Vector3D center = tMatrix.block<3, 1>(0, 3);
+  // full cylinders are checked along the axis on the arrays for absolute
+  // checks, as in CylinderSurface::intersect
+  const bool checkZ = bcheck and bounds.coversFullAzimuth() and
+                      bcheck.type() == BoundaryCheck::Type::eAbsolute;
+  const double hZ = bounds.get(CylinderBounds::eHalfLengthZ) +
+                    s_onSurfaceTolerance + bcheck.tolerance()[eLOC_Z];
+
+  for (size_t begin = 0; begin < rays.size(); begin += s_chunkSize) {
+    const size_t n = std::min(s_chunkSize, rays.size() - begin);
+    const auto x = rays.x.segment(begin, n);
+    const auto y = rays.y.segment(begin, n);
+    const auto z = rays.z.segment(begin, n);
+    const auto dx = rays.dx.segment(begin, n);
+    const auto dy = rays.dy.segment(begin, n);
+    const auto dz = rays.dz.segment(begin, n);
+
+    // the quadratic equation of CylinderSurface::intersectionSolver
+    const Array pcx = x - center.x();
+    const Array pcy = y - center.y();
+    const Array pcz = z - center.z();
+    // position and direction crossed with the cylinder axis
+    const Array px = pcy * axis.z() - pcz * axis.y();
+    const Array py = pcz * axis.x() - pcx * axis.z();
+    const Array pz = pcx * axis.y() - pcy * axis.x();
+    const Array ax = dy * axis.z() - dz * axis.y();
+    const Array ay = dz * axis.x() - dx * axis.z();
+    const Array az = dx * axis.y() - dy * axis.x();
+    const Array a = ax * ax + ay * ay + az * az;
+    const Array b = 2. * (ax * px + ay * py + az * pz);
+    const Array c = px * px + py * py + pz * pz - R * R;
+    // the solutions of detail::RealQuadraticEquation
+    const Array discriminant = b * b - 4 * a * c;
+    const Array root = discriminant.max(0.).sqrt();
+    const Array q = -0.5 * (b + (b > 0).select(root, -root));
+    const Array first = q / a;
+    const Array second = c / q;
+    const Array x1 = x + first * dx;
+    const Array y1 = y + first * dy;
+    const Array z1 = z + first * dz;
+    const Array x2 = x + second * dx;
+    const Array y2 = y + second * dy;
+    const Array z2 = z + second * dz;
+    Array cZ1, cZ2;
+    if (checkZ) {
+      cZ1 = (x1 - center.x()) * axis.x() + (y1 - center.y()) * axis.y() +
+            (z1 - center.z()) * axis.z();
+      cZ2 = (x2 - center.x()) * axis.x() + (y2 - center.y()) * axis.y() +
+            (z2 - center.z()) * axis.z();
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      const size_t it = begin + i;
+      if (discriminant[i] < 0) {
+        setInvalid(intersections, it);
+        continue;
+      }
+      auto boundaryCheck = [&](const Vector3D& solution, const Array& cZ,
+                               Intersection::Status status) {
+        if (not bcheck) {
+          return status;
+        }
+        if (checkZ) {
+          return (cZ[i] * cZ[i] < hZ * hZ) ? status
+                                           : Intersection::Status::missed;
+        }
+        const Vector3D direction(dx[i], dy[i], dz[i]);
+        return surface.isOnSurface(gctx, solution, direction, bcheck)
+                   ? status
+                   : Intersection::Status::missed;
+      };
+      // the first solution, the only one for a vanishing discriminant
+      const Vector3D solution1(x1[i], y1[i], z1[i]);
+      const auto status1 = boundaryCheck(solution1, cZ1, pathStatus(first[i]));
+      bool takeFirst = true;
+      auto status2 = Intersection::Status::missed;
+      if (discriminant[i] > 0) {
+        status2 = boundaryCheck(Vector3D(x2[i], y2[i], z2[i]), cZ2,
+                                pathStatus(second[i]));
+        // the first valid one, the closer one if both are (in)valid
+        const bool check1 = status1 != Intersection::Status::missed or
+                            status2 == Intersection::Status::missed;
+        takeFirst = (check1 and first[i] * first[i] < second[i] * second[i]) or
+                    status2 == Intersection::Status::missed;
+      }
+      if (takeFirst) {
+        intersections.x[it] = x1[i];
+        intersections.y[it] = y1[i];
+        intersections.z[it] = z1[i];
+        intersections.pathLength[it] = first[i];
+        intersections.status[it] = status1;
+      } else {
+        intersections.x[it] = x2[i];
+        intersections.y[it] = y2[i];
+        intersections.z[it] = z2[i];
+        intersections.pathLength[it] = second[i];
+        intersections.status[it] = status2;
+      }
+    }
+  }
+}
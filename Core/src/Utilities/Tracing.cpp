@@ -0,0 +1,23 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/Tracing.hpp"
+
+#include <atomic>
+
+namespace {
+std::atomic<Acts::Tracing::Tracer*> s_tracer{nullptr};
+}  // namespace
+
+void Acts::Tracing::setTracer(Tracer* tracer) {
+  s_tracer.store(tracer, std::memory_order_release);
+}
+
+Acts::Tracing::Tracer* Acts::Tracing::tracer() {
+  return s_tracer.load(std::memory_order_acquire);
+}
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 
 #include <memory>
 #include <string>
@@ -62,6 +65,9 @@ class DigitizationAlgorithm final : public BareAlgorithm {
   };
 
   Config m_cfg;
+  ReadHandle<pmr::SimHitContainer> m_inputSimulatedHits;
+  WriteHandle<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>>
+      m_outputClusters;
   /// Lookup container for all digitizable surfaces
   std::unordered_map<Acts::GeometryID, Digitizable> m_digitizables;
 };
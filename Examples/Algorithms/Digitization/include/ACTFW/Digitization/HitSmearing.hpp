@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimHit.hpp"
+#include "ACTFW/EventData/SimSourceLink.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
@@ -48,6 +50,8 @@ class HitSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<pmr::SimHitContainer> m_inputSimulatedHits;
+  WriteHandle<pmr::SimSourceLinkContainer> m_outputSourceLinks;
   /// Lookup container for hit surfaces that generate smeared hits
   std::unordered_map<Acts::GeometryID, const Acts::Surface*> m_surfaces;
 };
@@ -69,14 +69,16 @@ FW::DigitizationAlgorithm::DigitizationAlgorithm(
     // record all valid surfaces
     this->m_digitizables.insert_or_assign(surface->geoID(), dg);
   });
+  declareInput(m_inputSimulatedHits, m_cfg.inputSimulatedHits);
+  declareOutput(m_outputClusters, m_cfg.outputClusters);
 }
 
 FW::ProcessCode FW::DigitizationAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   // Prepare the input and output collections
-  const auto& hits =
-      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
-  FW::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters;
+  const auto& hits = m_inputSimulatedHits(ctx);
+  FW::pmr::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters(
+      ctx.eventStore.memoryResource());
 
   for (auto&& [moduleGeoId, moduleHits] : groupByModule(hits)) {
     // can only digitize hits on digitizable surfaces
@@ -165,6 +167,6 @@ FW::ProcessCode FW::DigitizationAlgorithm::execute(
                           << " clusters");
 
   // write the clusters to the EventStore
-  ctx.eventStore.add(m_cfg.outputClusters, std::move(clusters));
+  m_outputClusters(ctx, std::move(clusters));
   return FW::ProcessCode::SUCCESS;
 }
@@ -40,13 +40,14 @@ FW::HitSmearing::HitSmearing(const Config& cfg, Acts::Logging::Level lvl)
     }
     this->m_surfaces.insert_or_assign(surface->geoID(), surface);
   });
+  declareInput(m_inputSimulatedHits, m_cfg.inputSimulatedHits);
+  declareOutput(m_outputSourceLinks, m_cfg.outputSourceLinks);
 }
 
 FW::ProcessCode FW::HitSmearing::execute(const AlgorithmContext& ctx) const {
   // setup input and output containers
-  const auto& hits =
-      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
-  SimSourceLinkContainer sourceLinks;
+  const auto& hits = m_inputSimulatedHits(ctx);
+  pmr::SimSourceLinkContainer sourceLinks(ctx.eventStore.memoryResource());
   sourceLinks.reserve(hits.size());
 
   // setup random number generator
@@ -90,6 +91,6 @@ FW::ProcessCode FW::HitSmearing::execute(const AlgorithmContext& ctx) const {
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputSourceLinks, std::move(sourceLinks));
+  m_outputSourceLinks(ctx, std::move(sourceLinks));
   return ProcessCode::SUCCESS;
 }
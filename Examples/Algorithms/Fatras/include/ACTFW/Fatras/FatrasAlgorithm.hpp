@@ -55,6 +55,10 @@ class FatrasAlgorithm final : public BareAlgorithm {
                << m_cfg.simulator.charged.selectHitSurface.material);
     ACTS_DEBUG("hits on passive surfaces: "
                << m_cfg.simulator.charged.selectHitSurface.passive);
+    declareInput(m_inputParticles, m_cfg.inputParticles);
+    declareOutput(m_outputParticlesInitial, m_cfg.outputParticlesInitial);
+    declareOutput(m_outputParticlesFinal, m_cfg.outputParticlesFinal);
+    declareOutput(m_outputHits, m_cfg.outputHits);
   }
 
   /// Run the simulation for a single event.
@@ -62,12 +66,12 @@ class FatrasAlgorithm final : public BareAlgorithm {
   /// @param ctx the algorithm context containing all event information
   FW::ProcessCode execute(const AlgorithmContext& ctx) const final override {
     // read input containers
-    const auto& inputParticles =
-        ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+    const auto& inputParticles = m_inputParticles(ctx);
     // prepare output containers
     SimParticleContainer::sequence_type particlesInitialUnordered;
     SimParticleContainer::sequence_type particlesFinalUnordered;
-    SimHitContainer::sequence_type hitsUnordered;
+    pmr::SimHitContainer::sequence_type hitsUnordered(
+        ctx.eventStore.memoryResource());
     // reserve appropriate resources
     constexpr auto meanHitsPerParticle = 16u;
     particlesInitialUnordered.reserve(inputParticles.size());
@@ -107,22 +111,25 @@ class FatrasAlgorithm final : public BareAlgorithm {
     // restore ordering for output containers
     SimParticleContainer particlesInitial;
     SimParticleContainer particlesFinal;
-    SimHitContainer hits;
+    pmr::SimHitContainer hits(ctx.eventStore.memoryResource());
     particlesInitial.adopt_sequence(std::move(particlesInitialUnordered));
     particlesFinal.adopt_sequence(std::move(particlesFinalUnordered));
     hits.adopt_sequence(std::move(hitsUnordered));
 
     // store ordered output containers
-    ctx.eventStore.add(m_cfg.outputParticlesInitial,
-                       std::move(particlesInitial));
-    ctx.eventStore.add(m_cfg.outputParticlesFinal, std::move(particlesFinal));
-    ctx.eventStore.add(m_cfg.outputHits, std::move(hits));
+    m_outputParticlesInitial(ctx, std::move(particlesInitial));
+    m_outputParticlesFinal(ctx, std::move(particlesFinal));
+    m_outputHits(ctx, std::move(hits));
 
     return FW::ProcessCode::SUCCESS;
   }
 
  private:
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
+  WriteHandle<SimParticleContainer> m_outputParticlesInitial;
+  WriteHandle<SimParticleContainer> m_outputParticlesFinal;
+  WriteHandle<pmr::SimHitContainer> m_outputHits;
 };
 
 }  // namespace FW
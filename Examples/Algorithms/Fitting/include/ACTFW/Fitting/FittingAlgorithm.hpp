@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ACTFW/EventData/ProtoTrack.hpp"
 #include "ACTFW/EventData/SimSourceLink.hpp"
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
@@ -37,6 +38,11 @@ class FittingAlgorithm final : public BareAlgorithm {
   static FitterFunction makeFitterFunction(
       std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
       Options::BFieldVariant magneticField, Acts::Logging::Level lvl);
+  /// Create the fitter function implementation for any field map, e.g. a
+  /// memory-mapped one.
+  static FitterFunction makeFitterFunction(
+      std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+      Options::BFieldMapVariant magneticField, Acts::Logging::Level lvl);
 
   struct Config {
     /// Input source links collection.
@@ -65,6 +71,10 @@ class FittingAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<pmr::SimSourceLinkContainer> m_inputSourceLinks;
+  ReadHandle<pmr::ProtoTrackContainer> m_inputProtoTracks;
+  ReadHandle<TrackParametersContainer> m_inputInitialTrackParameters;
+  WriteHandle<TrajectoryContainer> m_outputTrajectories;
 };
 
 }  // namespace FW
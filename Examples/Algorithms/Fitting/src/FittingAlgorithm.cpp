@@ -30,17 +30,19 @@ FW::FittingAlgorithm::FittingAlgorithm(Config cfg, Acts::Logging::Level level)
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing output trajectories collection");
   }
+  declareInput(m_inputSourceLinks, m_cfg.inputSourceLinks);
+  declareInput(m_inputProtoTracks, m_cfg.inputProtoTracks);
+  declareInput(m_inputInitialTrackParameters,
+               m_cfg.inputInitialTrackParameters);
+  declareOutput(m_outputTrajectories, m_cfg.outputTrajectories);
 }
 
 FW::ProcessCode FW::FittingAlgorithm::execute(
     const FW::AlgorithmContext& ctx) const {
   // Read input data
-  const auto sourceLinks =
-      ctx.eventStore.get<SimSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto protoTracks =
-      ctx.eventStore.get<ProtoTrackContainer>(m_cfg.inputProtoTracks);
-  const auto initialParameters = ctx.eventStore.get<TrackParametersContainer>(
-      m_cfg.inputInitialTrackParameters);
+  const auto& sourceLinks = m_inputSourceLinks(ctx);
+  const auto& protoTracks = m_inputProtoTracks(ctx);
+  const auto& initialParameters = m_inputInitialTrackParameters(ctx);
 
   // Consistency cross checks
   if (protoTracks.size() != initialParameters.size()) {
@@ -122,6 +124,6 @@ FW::ProcessCode FW::FittingAlgorithm::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
+  m_outputTrajectories(ctx, std::move(trajectories));
   return FW::ProcessCode::SUCCESS;
 }
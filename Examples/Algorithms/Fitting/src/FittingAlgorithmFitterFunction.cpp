@@ -42,40 +42,54 @@ struct FitterFunctionImpl {
     return fitter.fit(sourceLinks, initialParameters, options);
   };
 };
-}  // namespace
 
-FW::FittingAlgorithm::FitterFunction FW::FittingAlgorithm::makeFitterFunction(
+// instantiate the fitter for the given magnetic field
+template <typename magnetic_field_t>
+FW::FittingAlgorithm::FitterFunction makeFitter(
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
-    Options::BFieldVariant magneticField, Acts::Logging::Level lvl) {
+    std::shared_ptr<magnetic_field_t> inputField, Acts::Logging::Level lvl) {
   using Updater = Acts::GainMatrixUpdater;
   using Smoother = Acts::GainMatrixSmoother;
+  using MagneticField = Acts::SharedBField<magnetic_field_t>;
+  using Stepper = Acts::EigenStepper<MagneticField>;
+  using Navigator = Acts::Navigator;
+  using Propagator = Acts::Propagator<Stepper, Navigator>;
+  using Fitter = Acts::KalmanFitter<Propagator, Updater, Smoother>;
 
+  // construct all components for the fitter
+  MagneticField field(std::move(inputField));
+  Stepper stepper(std::move(field));
+  Navigator navigator(trackingGeometry);
+  navigator.resolvePassive = false;
+  navigator.resolveMaterial = true;
+  navigator.resolveSensitive = true;
+  Propagator propagator(std::move(stepper), std::move(navigator));
+  Fitter fitter(std::move(propagator),
+                Acts::getDefaultLogger("KalmanFitter", lvl));
+
+  // build the fitter functions. owns the fitter object.
+  return FitterFunctionImpl<Fitter>(std::move(fitter));
+}
+}  // namespace
+
+FW::FittingAlgorithm::FitterFunction FW::FittingAlgorithm::makeFitterFunction(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    Options::BFieldVariant magneticField, Acts::Logging::Level lvl) {
   // unpack the magnetic field variant and instantiate the corresponding fitter.
+  // each entry in the variant is already a shared_ptr.
   return std::visit(
       [trackingGeometry, lvl](auto&& inputField) -> FitterFunction {
-        // each entry in the variant is already a shared_ptr
-        // need ::element_type to get the real magnetic field type
-        using InputMagneticField =
-            typename std::decay_t<decltype(inputField)>::element_type;
-        using MagneticField = Acts::SharedBField<InputMagneticField>;
-        using Stepper = Acts::EigenStepper<MagneticField>;
-        using Navigator = Acts::Navigator;
-        using Propagator = Acts::Propagator<Stepper, Navigator>;
-        using Fitter = Acts::KalmanFitter<Propagator, Updater, Smoother>;
-
-        // construct all components for the fitter
-        MagneticField field(std::move(inputField));
-        Stepper stepper(std::move(field));
-        Navigator navigator(trackingGeometry);
-        navigator.resolvePassive = false;
-        navigator.resolveMaterial = true;
-        navigator.resolveSensitive = true;
-        Propagator propagator(std::move(stepper), std::move(navigator));
-        Fitter fitter(std::move(propagator),
-                      Acts::getDefaultLogger("KalmanFitter", lvl));
+        return makeFitter(trackingGeometry, std::move(inputField), lvl);
+      },
+      std::move(magneticField));
+}
 
-        // build the fitter functions. owns the fitter object.
-        return FitterFunctionImpl<Fitter>(std::move(fitter));
+FW::FittingAlgorithm::FitterFunction FW::FittingAlgorithm::makeFitterFunction(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    Options::BFieldMapVariant magneticField, Acts::Logging::Level lvl) {
+  return std::visit(
+      [trackingGeometry, lvl](auto&& inputField) -> FitterFunction {
+        return makeFitter(trackingGeometry, std::move(inputField), lvl);
       },
       std::move(magneticField));
 }
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 class G4RunManager;
 class G4VUserDetectorConstruction;
@@ -52,6 +53,8 @@ class GeantinoRecording final : public FW::BareAlgorithm {
 
  private:
   Config m_cfg;
+  FW::WriteHandle<std::vector<Acts::RecordedMaterialTrack>>
+      m_outputMaterialTracks;
   std::unique_ptr<G4RunManager> m_runManager;
   // has to be mutable; algorithm interface enforces object constness
   mutable std::mutex m_runManagerLock;
@@ -44,6 +44,7 @@ GeantinoRecording::GeantinoRecording(GeantinoRecording::Config&& cfg,
       new PrimaryGeneratorAction("geantino", 1000., m_cfg.seed1, m_cfg.seed2));
   m_runManager->SetUserAction(new SteppingAction());
   m_runManager->Initialize();
+  declareOutput(m_outputMaterialTracks, m_cfg.outputMaterialTracks);
 }
 
 // needed to allow std::unique_ptr<G4RunManager> with forward-declared class.
@@ -62,7 +63,7 @@ FW::ProcessCode GeantinoRecording::execute(
 
   auto materialTracks = EventAction::instance()->materialTracks();
   // Write the recorded material to the event store
-  ctx.eventStore.add(m_cfg.outputMaterialTracks, move(materialTracks));
+  m_outputMaterialTracks(ctx, move(materialTracks));
 
   return FW::ProcessCode::SUCCESS;
 }
@@ -22,12 +22,13 @@ FW::FlattenEvent::FlattenEvent(const Config& cfg, Acts::Logging::Level lvl)
   if (m_cfg.outputParticles.empty()) {
     throw std::invalid_argument("Missing output particles collection");
   }
+  declareInput(m_inputEvent, m_cfg.inputEvent);
+  declareOutput(m_outputParticles, m_cfg.outputParticles);
 }
 
 FW::ProcessCode FW::FlattenEvent::execute(const AlgorithmContext& ctx) const {
   // setup input and output containers
-  const auto& event =
-      ctx.eventStore.get<std::vector<SimVertex>>(m_cfg.inputEvent);
+  const auto& event = m_inputEvent(ctx);
   SimParticleContainer::sequence_type unsortedParticles;
 
   // extract particles
@@ -42,6 +43,6 @@ FW::ProcessCode FW::FlattenEvent::execute(const AlgorithmContext& ctx) const {
   SimParticleContainer particles;
   particles.adopt_sequence(std::move(unsortedParticles));
 
-  ctx.eventStore.add(m_cfg.outputParticles, std::move(particles));
+  m_outputParticles(ctx, std::move(particles));
   return ProcessCode::SUCCESS;
 }
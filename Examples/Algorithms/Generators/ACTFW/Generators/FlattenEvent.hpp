@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimParticle.hpp"
+#include "ACTFW/EventData/SimVertex.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
+#include <vector>
+
 namespace FW {
 
 /// Convert nested vector of vertices into a vector of particles.
@@ -30,6 +34,8 @@ class FlattenEvent final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<std::vector<SimVertex>> m_inputEvent;
+  WriteHandle<SimParticleContainer> m_outputParticles;
 };
 
 }  // namespace FW
@@ -92,6 +92,8 @@ FW::ParticleSelector::ParticleSelector(const Config& cfg,
                                        << "]");
   ACTS_DEBUG("remove charged particles " << m_cfg.removeCharged);
   ACTS_DEBUG("remove neutral particles " << m_cfg.removeNeutral);
+  declareInput(m_inputEvent, m_cfg.inputEvent);
+  declareOutput(m_outputEvent, m_cfg.outputEvent);
 }
 
 FW::ProcessCode FW::ParticleSelector::execute(
@@ -99,7 +101,7 @@ FW::ProcessCode FW::ParticleSelector::execute(
   using SimEvent = std::vector<SimVertex>;
 
   // prepare input/ output types
-  const auto& input = ctx.eventStore.get<SimEvent>(m_cfg.inputEvent);
+  const auto& input = m_inputEvent(ctx);
   SimEvent selected;
 
   auto within = [](double x, double min, double max) {
@@ -150,6 +152,6 @@ FW::ProcessCode FW::ParticleSelector::execute(
   ACTS_DEBUG("event " << ctx.eventNumber << " selected " << selectedParticles
                       << " from " << allParticles << " particles");
 
-  ctx.eventStore.add(m_cfg.outputEvent, std::move(selected));
+  m_outputEvent(ctx, std::move(selected));
   return ProcessCode::SUCCESS;
 }
@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimVertex.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Utilities/OptionsFwd.hpp"
 
 #include <limits>
+#include <vector>
 
 namespace FW {
 
@@ -60,6 +62,8 @@ class ParticleSelector : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<std::vector<SimVertex>> m_inputEvent;
+  WriteHandle<std::vector<SimVertex>> m_outputEvent;
 };
 
 }  // namespace FW
@@ -12,11 +12,13 @@
 #include "ACTFW/MaterialMapping/IMaterialWriter.hpp"
 #include "Acts/Material/SurfaceMaterialMapper.hpp"
 #include "Acts/Material/VolumeMaterialMapper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
 #include <climits>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace Acts {
 
@@ -104,6 +106,8 @@ class MaterialMapping : public FW::BareAlgorithm {
 
  private:
   Config m_cfg;  //!< internal config object
+  ReadHandle<std::vector<Acts::RecordedMaterialTrack>> m_inputMaterialTracks;
+  WriteHandle<std::vector<Acts::RecordedMaterialTrack>> m_outputMaterialTracks;
   Acts::SurfaceMaterialMapper::State
       m_mappingState;  //!< Material mapping state
   Acts::VolumeMaterialMapper::State
@@ -38,6 +38,10 @@ FW::MaterialMapping::MaterialMapping(const FW::MaterialMapping::Config& cnf,
     m_mappingStateVol = m_cfg.materialVolumeMapper->createState(
         m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
   }
+  declareInput(m_inputMaterialTracks, m_cfg.collection);
+  if (m_cfg.materialSurfaceMapper) {
+    declareOutput(m_outputMaterialTracks, m_cfg.mappingMaterialCollection);
+  }
 }
 
 FW::MaterialMapping::~MaterialMapping() {
@@ -92,8 +96,7 @@ FW::ProcessCode FW::MaterialMapping::execute(
   if (m_cfg.materialSurfaceMapper) {
     // Write to the collection to the EventStore
     std::vector<Acts::RecordedMaterialTrack> mtrackCollection =
-        context.eventStore.get<std::vector<Acts::RecordedMaterialTrack>>(
-            m_cfg.collection);
+        m_inputMaterialTracks(context);
 
     // To make it work with the framework needs a lock guard
     auto mappingState =
@@ -104,14 +107,12 @@ FW::ProcessCode FW::MaterialMapping::execute(
       m_cfg.materialSurfaceMapper->mapMaterialTrack(*mappingState, mTrack);
     }
 
-    context.eventStore.add(m_cfg.mappingMaterialCollection,
-                           std::move(mtrackCollection));
+    m_outputMaterialTracks(context, std::move(mtrackCollection));
   }
   if (m_cfg.materialVolumeMapper) {
     // Write to the collection to the EventStore
     std::vector<Acts::RecordedMaterialTrack> mtrackCollection =
-        context.eventStore.get<std::vector<Acts::RecordedMaterialTrack>>(
-            m_cfg.collection);
+        m_inputMaterialTracks(context);
 
     // To make it work with the framework needs a lock guard
     auto mappingState =
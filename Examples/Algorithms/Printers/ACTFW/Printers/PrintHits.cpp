@@ -20,17 +20,16 @@
 
 FW::PrintHits::PrintHits(const FW::PrintHits::Config& cfg,
                          Acts::Logging::Level level)
-    : BareAlgorithm("PrintHits", level), m_cfg(cfg) {}
+    : BareAlgorithm("PrintHits", level), m_cfg(cfg) {
+  declareInput(m_inputClusters, m_cfg.inputClusters);
+  declareInput(m_inputHitParticlesMap, m_cfg.inputHitParticlesMap);
+  declareInput(m_inputHitIds, m_cfg.inputHitIds);
+}
 
 FW::ProcessCode FW::PrintHits::execute(const FW::AlgorithmContext& ctx) const {
-  using Clusters = FW::GeometryIdMultimap<Acts::PlanarModuleCluster>;
-  using HitParticlesMap = FW::IndexMultimap<ActsFatras::Barcode>;
-  using HitIds = std::vector<size_t>;
-
-  const auto& clusters = ctx.eventStore.get<Clusters>(m_cfg.inputClusters);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputHitParticlesMap);
-  const auto& hitIds = ctx.eventStore.get<HitIds>(m_cfg.inputHitIds);
+  const auto& clusters = m_inputClusters(ctx);
+  const auto& hitParticlesMap = m_inputHitParticlesMap(ctx);
+  const auto& hitIds = m_inputHitIds(ctx);
 
   // print hits selected by id
   ACTS_INFO("Hits by id selection")
@@ -8,10 +8,15 @@
 
 #pragma once
 
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/IndexContainers.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace FW {
 
@@ -41,6 +46,10 @@ class PrintHits : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>>
+      m_inputClusters;
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputHitParticlesMap;
+  ReadHandle<std::vector<size_t>> m_inputHitIds;
 };
 
 }  // namespace FW
@@ -16,14 +16,15 @@
 #include "ActsFatras/Utilities/ParticleData.hpp"
 
 FW::PrintParticles::PrintParticles(const Config& cfg, Acts::Logging::Level lvl)
-    : BareAlgorithm("PrintParticles", lvl), m_cfg(cfg) {}
+    : BareAlgorithm("PrintParticles", lvl), m_cfg(cfg) {
+  declareInput(m_inputParticles, m_cfg.inputParticles);
+}
 
 FW::ProcessCode FW::PrintParticles::execute(
     const FW::AlgorithmContext& ctx) const {
   using namespace Acts::UnitLiterals;
 
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
 
   for (const auto& particle : particles) {
     ACTS_INFO(
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
 #include <string>
@@ -28,6 +29,7 @@ class PrintParticles : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
 };
 
 }  // namespace FW
@@ -38,7 +38,12 @@ template <typename propagator_t>
 PropagationAlgorithm<propagator_t>::PropagationAlgorithm(
     const PropagationAlgorithm<propagator_t>::Config& cfg,
     Acts::Logging::Level loglevel)
-    : BareAlgorithm("PropagationAlgorithm", loglevel), m_cfg(cfg) {}
+    : BareAlgorithm("PropagationAlgorithm", loglevel), m_cfg(cfg) {
+  declareOutput(m_cfg.propagationStepCollection);
+  if (m_cfg.recordMaterialInteractions) {
+    declareOutput(m_cfg.propagationMaterialCollection);
+  }
+}
 
 /// Templated execute test method for
 /// charged and netural particles
@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+namespace FW {
+
+/// Create the seeds for all groups of a binned space point container in
+/// parallel.
+///
+/// @tparam external_spacepoint_t The space point type
+/// @tparam platform_t The Seedfinder platform
+///
+/// @param finder The seed finder; must be usable concurrently, i.e. its seed
+///        filter and experiment cuts must not have mutable state
+/// @param spGroup The binned space points
+/// @param arena The task arena that limits the concurrency of the seeding
+/// @param groupsPerTask The minimum number of groups processed by one task
+/// @return The seeds of all groups, ordered as in a sequential iteration
+///
+/// The middle space point groups are independent and are distributed across
+/// the threads of the task arena. Each thread collects its seeds in a local
+/// buffer, which are merged in group order afterwards. The output thus does
+/// not depend on the number of threads or the scheduling.
+template <typename external_spacepoint_t, typename platform_t>
+std::vector<Acts::Seed<external_spacepoint_t>> createSeedsParallel(
+    const Acts::Seedfinder<external_spacepoint_t, platform_t>& finder,
+    Acts::BinnedSPGroup<external_spacepoint_t>& spGroup,
+    tbb::task_arena& arena, size_t groupsPerTask = 1) {
+  using Seed = Acts::Seed<external_spacepoint_t>;
+
+  // the seeds of one group within the buffer of a thread
+  struct GroupSeeds {
+    size_t group;
+    size_t begin;
+    size_t end;
+  };
+  struct ThreadBuffer {
+    std::vector<Seed> seeds;
+    std::vector<GroupSeeds> groups;
+  };
+  tbb::enumerable_thread_specific<ThreadBuffer> buffers;
+
+  const size_t numGroups = spGroup.numGroups();
+  arena.execute([&] {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0u, numGroups,
+                                   std::max<size_t>(groupsPerTask, 1u)),
+        [&](const tbb::blocked_range<size_t>& r) {
+          ThreadBuffer& buffer = buffers.local();
+          for (size_t igroup = r.begin(); igroup < r.end(); ++igroup) {
+            auto group = spGroup.group(igroup);
+            auto seeds = finder.createSeedsForGroup(
+                group.bottom(), group.middle(), group.top());
+            if (seeds.empty()) {
+              continue;
+            }
+            const size_t begin = buffer.seeds.size();
+            // Seed is copy-constructible, but not assignable
+            std::copy(seeds.begin(), seeds.end(),
+                      std::back_inserter(buffer.seeds));
+            buffer.groups.push_back({igroup, begin, buffer.seeds.size()});
+          }
+        });
+  });
+
+  // deterministic merge of the thread buffers in group order
+  std::vector<std::tuple<size_t, const ThreadBuffer*, const GroupSeeds*>>
+      order;
+  size_t numSeeds = 0;
+  for (const ThreadBuffer& buffer : buffers) {
+    numSeeds += buffer.seeds.size();
+    for (const GroupSeeds& groupSeeds : buffer.groups) {
+      order.emplace_back(groupSeeds.group, &buffer, &groupSeeds);
+    }
+  }
+  std::sort(order.begin(), order.end(), [](const auto& lhs, const auto& rhs) {
+    return std::get<0>(lhs) < std::get<0>(rhs);
+  });
+
+  std::vector<Seed> seeds;
+  seeds.reserve(numSeeds);
+  for (const auto& [igroup, buffer, groupSeeds] : order) {
+    std::copy(buffer->seeds.begin() + groupSeeds->begin,
+              buffer->seeds.begin() + groupSeeds->end,
+              std::back_inserter(seeds));
+  }
+  return seeds;
+}
+
+}  // namespace FW
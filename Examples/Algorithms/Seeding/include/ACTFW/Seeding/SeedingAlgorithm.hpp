@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/ProtoTrack.hpp"
+#include "ACTFW/EventData/SimSourceLink.hpp"
+#include "ACTFW/EventData/Track.hpp"
+#include "ACTFW/Framework/BareAlgorithm.hpp"
+#include "ACTFW/Seeding/SimSpacePoint.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Seeding/IExperimentCuts.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <memory>
+#include <string>
+
+#include <tbb/task_arena.h>
+
+namespace FW {
+
+/// Find track seeds from three space points.
+///
+/// Space points are built either from the simulated source links or from the
+/// digitized planar module clusters; exactly one of the two inputs must be
+/// configured. The seeds are written as proto tracks that contain the indices
+/// of the three measurements within the input container and optionally as
+/// initial track parameters estimated from the helix through the three space
+/// points. Both outputs are stored in the same order.
+class SeedingAlgorithm final : public BareAlgorithm {
+ public:
+  struct Config {
+    /// Input source links collection.
+    std::string inputSourceLinks;
+    /// Input clusters collection.
+    std::string inputClusters;
+    /// Output proto tracks collection.
+    std::string outputProtoTracks;
+    /// Output initial track parameters collection; optional.
+    std::string outputTrackParameters;
+    /// Seed finder configuration; the seed filter is created internally.
+    Acts::SeedfinderConfig<SimSpacePoint> finderConfig;
+    /// Seed filter configuration.
+    Acts::SeedFilterConfig filterConfig;
+    /// Optional experiment specific cuts used by the seed filter.
+    std::shared_ptr<Acts::IExperimentCuts<SimSpacePoint>> experimentCuts =
+        nullptr;
+    /// Number of threads used for the seeding within one event; -1 for all.
+    int numThreads = 1;
+    /// Resolutions of the initial track parameters.
+    double sigmaLoc0 = 1 * Acts::UnitConstants::mm;
+    double sigmaLoc1 = 1 * Acts::UnitConstants::mm;
+    double sigmaPhi = 1 * Acts::UnitConstants::degree;
+    double sigmaTheta = 1 * Acts::UnitConstants::degree;
+    /// Relative momentum resolution of the initial track parameters.
+    double sigmaPRel = 0.1;
+    double sigmaT0 = 1 * Acts::UnitConstants::ns;
+  };
+
+  SeedingAlgorithm(Config cfg, Acts::Logging::Level lvl);
+
+  ProcessCode execute(const AlgorithmContext& ctx) const final override;
+
+ private:
+  /// Build the space points from the configured input collection.
+  SimSpacePointContainer createSpacePoints(const AlgorithmContext& ctx) const;
+
+  Config m_cfg;
+  ReadHandle<pmr::SimSourceLinkContainer> m_inputSourceLinks;
+  ReadHandle<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>>
+      m_inputClusters;
+  WriteHandle<pmr::ProtoTrackContainer> m_outputProtoTracks;
+  WriteHandle<TrackParametersContainer> m_outputTrackParameters;
+  std::shared_ptr<const Acts::Seedfinder<SimSpacePoint, Acts::CpuSimd>>
+      m_finder;
+  std::unique_ptr<tbb::task_arena> m_arena;
+};
+
+}  // namespace FW
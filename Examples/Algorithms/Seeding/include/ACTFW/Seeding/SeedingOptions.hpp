@@ -0,0 +1,28 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ACTFW/Seeding/SeedingAlgorithm.hpp"
+#include "ACTFW/Utilities/OptionsFwd.hpp"
+
+namespace FW {
+namespace Options {
+
+/// Add Seeding options.
+///
+/// @param desc The options description to add options to
+void addSeedingOptions(Description& desc);
+
+/// Read Seeding options to create the algorithm config.
+///
+/// @param variables The variables to read from
+SeedingAlgorithm::Config readSeedingConfig(const Variables& variables);
+
+}  // namespace Options
+}  // namespace FW
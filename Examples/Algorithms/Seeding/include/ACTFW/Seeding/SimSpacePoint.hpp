@@ -0,0 +1,57 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace FW {
+
+/// Space point built from a single measurement for the seed finder.
+///
+/// Only the information needed by the seed finder is stored. The index
+/// refers to the position of the originating measurement in the input
+/// measurement container and is used to build proto tracks from seeds.
+class SimSpacePoint {
+ public:
+  SimSpacePoint(float x, float y, float z, float varianceR, float varianceZ,
+                size_t measurementIndex)
+      : m_x(x),
+        m_y(y),
+        m_z(z),
+        m_r(std::hypot(x, y)),
+        m_varianceR(varianceR),
+        m_varianceZ(varianceZ),
+        m_measurementIndex(measurementIndex) {}
+
+  constexpr float x() const { return m_x; }
+  constexpr float y() const { return m_y; }
+  constexpr float z() const { return m_z; }
+  constexpr float r() const { return m_r; }
+  constexpr float varianceR() const { return m_varianceR; }
+  constexpr float varianceZ() const { return m_varianceZ; }
+  constexpr size_t measurementIndex() const { return m_measurementIndex; }
+
+ private:
+  // global position
+  float m_x;
+  float m_y;
+  float m_z;
+  float m_r;
+  // variance in r and z of the global position
+  float m_varianceR;
+  float m_varianceZ;
+  // index of the measurement in the input container
+  size_t m_measurementIndex;
+};
+
+using SimSpacePointContainer = std::vector<SimSpacePoint>;
+
+}  // namespace FW
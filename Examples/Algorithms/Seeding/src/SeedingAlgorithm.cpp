@@ -0,0 +1,221 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Seeding/SeedingAlgorithm.hpp"
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/ProtoTrack.hpp"
+#include "ACTFW/EventData/SimSourceLink.hpp"
+#include "ACTFW/EventData/Track.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Seeding/ParallelSeeding.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/EstimateTrackParamsFromSeed.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+namespace {
+
+/// Build a space point from a two-dimensional measurement on a surface.
+///
+/// The local covariance is propagated to the global frame using the
+/// local-to-global jacobian of the surface and then projected onto the
+/// radial and the longitudinal direction.
+template <typename measurement_t>
+FW::SimSpacePoint makeSpacePoint(const Acts::GeometryContext& gctx,
+                                 const measurement_t& meas, size_t index) {
+  const auto& surface = meas.referenceObject();
+  const auto parameters = meas.parameters();
+  const auto covariance = meas.covariance();
+
+  const Acts::Vector2D local(parameters[0], parameters[1]);
+  Acts::Vector3D global = Acts::Vector3D::Zero();
+  surface.localToGlobal(gctx, local, Acts::Vector3D::UnitZ(), global);
+
+  // the direction only enters the jacobian for non-planar surfaces
+  const Acts::Vector3D direction = global.normalized();
+  Acts::BoundVector bound = Acts::BoundVector::Zero();
+  bound[Acts::eLOC_0] = local[0];
+  bound[Acts::eLOC_1] = local[1];
+  bound[Acts::ePHI] = Acts::VectorHelpers::phi(direction);
+  bound[Acts::eTHETA] = Acts::VectorHelpers::theta(direction);
+  Acts::BoundToFreeMatrix jacobian = Acts::BoundToFreeMatrix::Zero();
+  surface.initJacobianToGlobal(gctx, jacobian, global, direction, bound);
+  const Acts::ActsMatrixD<3, 2> localToGlobal =
+      jacobian.template topLeftCorner<3, 2>();
+  const Acts::ActsSymMatrixD<3> globalCov =
+      localToGlobal * covariance.template topLeftCorner<2, 2>() *
+      localToGlobal.transpose();
+
+  const double x = global.x();
+  const double y = global.y();
+  const double r2 = std::max(x * x + y * y, 1e-12);
+  const double varianceR = (x * x * globalCov(0, 0) +
+                            2 * x * y * globalCov(0, 1) +
+                            y * y * globalCov(1, 1)) /
+                           r2;
+  const double varianceZ = globalCov(2, 2);
+
+  return FW::SimSpacePoint(global.x(), global.y(), global.z(), varianceR,
+                           varianceZ, index);
+}
+
+}  // namespace
+
+FW::SeedingAlgorithm::SeedingAlgorithm(FW::SeedingAlgorithm::Config cfg,
+                                       Acts::Logging::Level lvl)
+    : FW::BareAlgorithm("SeedingAlgorithm", lvl), m_cfg(std::move(cfg)) {
+  if (m_cfg.inputSourceLinks.empty() == m_cfg.inputClusters.empty()) {
+    throw std::invalid_argument(
+        "Exactly one of input source links or clusters collection is needed");
+  }
+  if (m_cfg.outputProtoTracks.empty()) {
+    throw std::invalid_argument("Missing output proto tracks collection");
+  }
+  if (m_cfg.numThreads == 0 or m_cfg.numThreads < -1) {
+    throw std::invalid_argument("Invalid number of seeding threads");
+  }
+
+  m_cfg.finderConfig.seedFilter =
+      std::make_shared<Acts::SeedFilter<SimSpacePoint>>(
+          m_cfg.filterConfig, m_cfg.experimentCuts.get());
+  m_finder =
+      std::make_shared<Acts::Seedfinder<SimSpacePoint, Acts::CpuSimd>>(
+          m_cfg.finderConfig);
+  // the arena is shared by all events; it can be used concurrently
+  m_arena = std::make_unique<tbb::task_arena>(m_cfg.numThreads);
+  m_arena->initialize();
+  if (not m_cfg.inputSourceLinks.empty()) {
+    declareInput(m_inputSourceLinks, m_cfg.inputSourceLinks);
+  } else {
+    declareInput(m_inputClusters, m_cfg.inputClusters);
+  }
+  declareOutput(m_outputProtoTracks, m_cfg.outputProtoTracks);
+  if (not m_cfg.outputTrackParameters.empty()) {
+    declareOutput(m_outputTrackParameters, m_cfg.outputTrackParameters);
+  }
+}
+
+FW::SimSpacePointContainer FW::SeedingAlgorithm::createSpacePoints(
+    const AlgorithmContext& ctx) const {
+  SimSpacePointContainer spacePoints;
+  size_t index = 0;
+  size_t skipped = 0;
+
+  if (not m_cfg.inputSourceLinks.empty()) {
+    const auto& sourceLinks = m_inputSourceLinks(ctx);
+    spacePoints.reserve(sourceLinks.size());
+    for (const auto& sourceLink : sourceLinks) {
+      std::visit(
+          [&](const auto& meas) {
+            if constexpr (std::decay_t<decltype(meas)>::size() < 2) {
+              ++skipped;
+            } else {
+              spacePoints.push_back(
+                  makeSpacePoint(ctx.geoContext, meas, index));
+            }
+          },
+          *sourceLink);
+      ++index;
+    }
+  } else {
+    const auto& clusters = m_inputClusters(ctx);
+    spacePoints.reserve(clusters.size());
+    for (const auto& [moduleId, cluster] : clusters) {
+      spacePoints.push_back(makeSpacePoint(ctx.geoContext, cluster, index));
+      ++index;
+    }
+  }
+
+  if (0 < skipped) {
+    ACTS_DEBUG("Skipped " << skipped << " one-dimensional measurements");
+  }
+  return spacePoints;
+}
+
+FW::ProcessCode FW::SeedingAlgorithm::execute(
+    const AlgorithmContext& ctx) const {
+  const auto spacePoints = createSpacePoints(ctx);
+  std::vector<const SimSpacePoint*> spacePointPtrs;
+  spacePointPtrs.reserve(spacePoints.size());
+  for (const auto& spacePoint : spacePoints) {
+    spacePointPtrs.push_back(&spacePoint);
+  }
+
+  // group the space points in (phi,z) bins as required by the seed finder
+  const auto& finderCfg = m_cfg.finderConfig;
+  Acts::SpacePointGridConfig gridCfg;
+  gridCfg.bFieldInZ = finderCfg.bFieldInZ;
+  gridCfg.minPt = finderCfg.minPt;
+  gridCfg.rMax = finderCfg.rMax;
+  gridCfg.zMax = finderCfg.zMax;
+  gridCfg.zMin = finderCfg.zMin;
+  gridCfg.deltaRMax = finderCfg.deltaRMax;
+  gridCfg.cotThetaMax = finderCfg.cotThetaMax;
+  auto grid = Acts::SpacePointGridCreator::createGrid<SimSpacePoint>(gridCfg);
+  auto binFinder = std::make_shared<Acts::BinFinder<SimSpacePoint>>();
+  auto covTool = [](const SimSpacePoint& sp, float, float,
+                    float) -> Acts::Vector2D {
+    return {sp.varianceR(), sp.varianceZ()};
+  };
+  Acts::BinnedSPGroup<SimSpacePoint> spGroup(
+      spacePointPtrs.begin(), spacePointPtrs.end(), covTool, binFinder,
+      binFinder, std::move(grid), finderCfg);
+
+  const auto seeds = createSeedsParallel(*m_finder, spGroup, *m_arena);
+
+  // the proto tracks use the event memory
+  pmr::ProtoTrackContainer protoTracks(ctx.eventStore.memoryResource());
+  protoTracks.reserve(seeds.size());
+  for (const auto& seed : seeds) {
+    auto& protoTrack = protoTracks.emplace_back();
+    protoTrack.reserve(seed.sp().size());
+    for (const SimSpacePoint* sp : seed.sp()) {
+      protoTrack.push_back(sp->measurementIndex());
+    }
+  }
+
+  if (not m_cfg.outputTrackParameters.empty()) {
+    // the seed finder uses kilotesla for the field strength
+    const double bFieldZ =
+        finderCfg.bFieldInZ * 1000 * Acts::UnitConstants::T;
+    Acts::BoundSymMatrix cov = Acts::BoundSymMatrix::Zero();
+    cov(Acts::eLOC_0, Acts::eLOC_0) = m_cfg.sigmaLoc0 * m_cfg.sigmaLoc0;
+    cov(Acts::eLOC_1, Acts::eLOC_1) = m_cfg.sigmaLoc1 * m_cfg.sigmaLoc1;
+    cov(Acts::ePHI, Acts::ePHI) = m_cfg.sigmaPhi * m_cfg.sigmaPhi;
+    cov(Acts::eTHETA, Acts::eTHETA) = m_cfg.sigmaTheta * m_cfg.sigmaTheta;
+    cov(Acts::eQOP, Acts::eQOP) = m_cfg.sigmaPRel * m_cfg.sigmaPRel;
+    cov(Acts::eT, Acts::eT) = m_cfg.sigmaT0 * m_cfg.sigmaT0;
+
+    TrackParametersContainer parameters;
+    parameters.reserve(seeds.size());
+    for (const auto& seed : seeds) {
+      parameters.push_back(
+          Acts::estimateTrackParamsFromSeed(seed, bFieldZ, cov));
+    }
+    m_outputTrackParameters(ctx, std::move(parameters));
+  }
+
+  ACTS_DEBUG("Created " << seeds.size() << " seeds from "
+                        << spacePoints.size() << " space points");
+  m_outputProtoTracks(ctx, std::move(protoTracks));
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,51 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Seeding/SeedingOptions.hpp"
+
+#include <boost/program_options.hpp>
+
+void FW::Options::addSeedingOptions(FW::Options::Description& desc) {
+  using boost::program_options::value;
+
+  auto opt = desc.add_options();
+  opt("seeding-threads", value<int>()->default_value(1),
+      "Number of threads used for the seeding within one event; -1 for all");
+  opt("seeding-min-pt", value<double>()->default_value(0.5),
+      "Minimum transverse momentum of the seeds in GeV");
+  opt("seeding-impact-max", value<double>()->default_value(10.),
+      "Maximum transverse impact parameter of the seeds in mm");
+  opt("seeding-bfield-z", value<double>()->default_value(2.),
+      "Magnetic field along the z axis used by the seeding in T");
+}
+
+FW::SeedingAlgorithm::Config FW::Options::readSeedingConfig(
+    const FW::Options::Variables& variables) {
+  // the seed finder uses MeV, mm and kT
+  SeedingAlgorithm::Config cfg;
+  auto& finderCfg = cfg.finderConfig;
+  finderCfg.minPt = variables["seeding-min-pt"].template as<double>() * 1000.;
+  finderCfg.impactMax = variables["seeding-impact-max"].template as<double>();
+  finderCfg.bFieldInZ =
+      variables["seeding-bfield-z"].template as<double>() / 1000.;
+  // pixel detector of the generic detector
+  finderCfg.rMax = 200.;
+  finderCfg.deltaRMin = 5.;
+  finderCfg.deltaRMax = 160.;
+  finderCfg.collisionRegionMin = -250.;
+  finderCfg.collisionRegionMax = 250.;
+  finderCfg.zMin = -2000.;
+  finderCfg.zMax = 2000.;
+  finderCfg.maxSeedsPerSpM = 5;
+  // 2.7 eta
+  finderCfg.cotThetaMax = 7.40627;
+  finderCfg.sigmaScattering = 1.;
+  finderCfg.beamPos = {0., 0.};
+  cfg.numThreads = variables["seeding-threads"].template as<int>();
+  return cfg;
+}
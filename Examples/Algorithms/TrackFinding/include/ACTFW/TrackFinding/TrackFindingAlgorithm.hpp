@@ -14,6 +14,7 @@
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinder/CKFSourceLinkSelector.hpp"
 #include "Acts/TrackFinder/CombinatorialKalmanFilter.hpp"
@@ -26,13 +27,18 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
  public:
   using TrackFinderResult =
       Acts::Result<Acts::CombinatorialKalmanFilterResult<SimSourceLink>>;
-  /// Track finding function that takes input measurements, initial trackstate
-  /// and track finder options and returns some track-finding-specific result.
+  /// Source links indexed by surface; shared by all seeds in an event.
+  using SourceLinkIndex = Acts::SourceLinkIndex<SimSourceLink>;
+  /// Track finding function that takes input measurements, a range of
+  /// initial trackstates, the track finder options and reusable scratch
+  /// buffers and returns some track-finding-specific result for each initial
+  /// trackstate.
   using CKFOptions =
       Acts::CombinatorialKalmanFilterOptions<Acts::CKFSourceLinkSelector>;
-  using TrackFinderFunction = std::function<TrackFinderResult(
-      const SimSourceLinkContainer&, const TrackParameters&,
-      const CKFOptions&)>;
+  using TrackFinderFunction = std::function<std::vector<TrackFinderResult>(
+      const SourceLinkIndex&, TrackParametersContainer::const_iterator,
+      TrackParametersContainer::const_iterator, const CKFOptions&,
+      Acts::CombinatorialKalmanFilterScratch<SimSourceLink>&)>;
 
   /// Create the track finder function implementation.
   ///
@@ -41,6 +47,11 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
   static TrackFinderFunction makeTrackFinderFunction(
       std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
       Options::BFieldVariant magneticField, Acts::Logging::Level lvl);
+  /// Create the track finder function implementation for any field map, e.g.
+  /// a memory-mapped one.
+  static TrackFinderFunction makeTrackFinderFunction(
+      std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+      Options::BFieldMapVariant magneticField, Acts::Logging::Level lvl);
 
   struct Config {
     /// Input source links collection.
@@ -53,6 +64,9 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
     TrackFinderFunction findTracks;
     /// CKF source link selector config
     Acts::CKFSourceLinkSelector::Config sourcelinkSelectorCfg;
+    /// Maximum number of seeds processed by one parallel task; seeds within
+    /// a task share the reusable track finding buffers.
+    size_t seedsPerTask = 8;
   };
 
   /// Constructor of the track finding algorithm
@@ -69,6 +83,9 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<pmr::SimSourceLinkContainer> m_inputSourceLinks;
+  ReadHandle<TrackParametersContainer> m_inputInitialTrackParameters;
+  WriteHandle<TrajectoryContainer> m_outputTrajectories;
 };
 
 }  // namespace FW
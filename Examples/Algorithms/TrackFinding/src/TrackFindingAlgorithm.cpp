@@ -12,8 +12,11 @@
 #include "ACTFW/Framework/WhiteBoard.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
+#include <tbb/tbb.h>
+
 FW::TrackFindingAlgorithm::TrackFindingAlgorithm(Config cfg,
                                                  Acts::Logging::Level level)
     : FW::BareAlgorithm("TrackFindingAlgorithm", level), m_cfg(std::move(cfg)) {
@@ -27,51 +30,71 @@ FW::TrackFindingAlgorithm::TrackFindingAlgorithm(Config cfg,
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing output trajectories collection");
   }
+  declareInput(m_inputSourceLinks, m_cfg.inputSourceLinks);
+  declareInput(m_inputInitialTrackParameters,
+               m_cfg.inputInitialTrackParameters);
+  declareOutput(m_outputTrajectories, m_cfg.outputTrajectories);
 }
 
 FW::ProcessCode FW::TrackFindingAlgorithm::execute(
     const FW::AlgorithmContext& ctx) const {
   // Read input data
-  const auto sourceLinks =
-      ctx.eventStore.get<SimSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto initialParameters = ctx.eventStore.get<TrackParametersContainer>(
-      m_cfg.inputInitialTrackParameters);
+  const auto& sourceLinks = m_inputSourceLinks(ctx);
+  const auto& initialParameters = m_inputInitialTrackParameters(ctx);
+
+  // Index the source links by surface once for all seeds
+  const SourceLinkIndex sourceLinkIndex(sourceLinks);
 
-  // Prepare the output data with MultiTrajectory
-  TrajectoryContainer trajectories;
-  trajectories.reserve(initialParameters.size());
+  // Prepare the output data with MultiTrajectory. Every seed writes only to
+  // its own slot which keeps the output order independent of the scheduling.
+  TrajectoryContainer trajectories(initialParameters.size());
 
   // Construct a perigee surface as the target surface
   auto pSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(
       Acts::Vector3D{0., 0., 0.});
 
-  // Perform the track finding for each starting parameter
-  // @TODO: use seeds from track seeding algorithm as starting parameter
-  for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
-    const auto& initialParams = initialParameters[iseed];
+  // Set the CombinatorialKalmanFilter options
+  FW::TrackFindingAlgorithm::CKFOptions ckfOptions(
+      ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
+      m_cfg.sourcelinkSelectorCfg, &(*pSurface));
 
-    // Set the CombinatorialKalmanFilter options
-    FW::TrackFindingAlgorithm::CKFOptions ckfOptions(
-        ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
-        m_cfg.sourcelinkSelectorCfg, &(*pSurface));
+  // Reusable track finding buffers; owned by each worker thread and shared
+  // by all seeds that the thread processes
+  tbb::enumerable_thread_specific<
+      Acts::CombinatorialKalmanFilterScratch<SimSourceLink>>
+      scratches;
 
-    ACTS_DEBUG("Invoke track finding seeded by truth particle " << iseed);
-    auto result = m_cfg.findTracks(sourceLinks, initialParams, ckfOptions);
-    if (result.ok()) {
-      // Get the track finding output object
-      const auto& trackFindingOutput = result.value();
-      // Create a SimMultiTrajectory
-      trajectories.emplace_back(std::move(trackFindingOutput.fittedStates),
-                                std::move(trackFindingOutput.trackTips),
-                                std::move(trackFindingOutput.fittedParameters));
-    } else {
-      ACTS_WARNING("Track finding failed for truth seed "
-                   << iseed << " with error" << result.error());
-      // Track finding failed, but still create an empty SimMultiTrajectory
-      trajectories.push_back(SimMultiTrajectory());
-    }
-  }
+  // Perform the track finding for ranges of starting parameters in parallel
+  // @TODO: use seeds from track seeding algorithm as starting parameter
+  tbb::parallel_for(
+      tbb::blocked_range<size_t>(0u, initialParameters.size(),
+                                 std::max<size_t>(m_cfg.seedsPerTask, 1u)),
+      [&](const tbb::blocked_range<size_t>& r) {
+        ACTS_DEBUG("Invoke track finding seeded by truth particles "
+                   << r.begin() << " to " << r.end() - 1);
+        auto results = m_cfg.findTracks(
+            sourceLinkIndex, initialParameters.begin() + r.begin(),
+            initialParameters.begin() + r.end(), ckfOptions,
+            scratches.local());
+
+        for (size_t iseed = r.begin(); iseed < r.end(); ++iseed) {
+          auto& result = results[iseed - r.begin()];
+          if (result.ok()) {
+            // Get the track finding output object
+            auto& trackFindingOutput = result.value();
+            // Create a SimMultiTrajectory
+            trajectories[iseed] = SimMultiTrajectory(
+                std::move(trackFindingOutput.fittedStates),
+                std::move(trackFindingOutput.trackTips),
+                std::move(trackFindingOutput.fittedParameters));
+          } else {
+            ACTS_WARNING("Track finding failed for truth seed "
+                         << iseed << " with error" << result.error());
+            // Track finding failed, but still keep an empty SimMultiTrajectory
+          }
+        }
+      });
 
-  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
+  m_outputTrajectories(ctx, std::move(trajectories));
   return FW::ProcessCode::SUCCESS;
 }
@@ -27,54 +27,70 @@ struct TrackFinderFunctionImpl {
 
   TrackFinderFunctionImpl(TrackFinder&& f) : trackFinder(std::move(f)) {}
 
-  FW::TrackFindingAlgorithm::TrackFinderResult operator()(
-      const FW::SimSourceLinkContainer& sourceLinks,
-      const FW::TrackParameters& initialParameters,
+  std::vector<FW::TrackFindingAlgorithm::TrackFinderResult> operator()(
+      const FW::TrackFindingAlgorithm::SourceLinkIndex& sourceLinks,
+      FW::TrackParametersContainer::const_iterator initialParametersBegin,
+      FW::TrackParametersContainer::const_iterator initialParametersEnd,
       const Acts::CombinatorialKalmanFilterOptions<Acts::CKFSourceLinkSelector>&
-          options) const {
-    return trackFinder.findTracks(sourceLinks, initialParameters, options);
+          options,
+      Acts::CombinatorialKalmanFilterScratch<FW::SimSourceLink>& scratch)
+      const {
+    return trackFinder.findTracks(sourceLinks, initialParametersBegin,
+                                  initialParametersEnd, options, &scratch);
   };
 };
+
+// instantiate the track finder for the given magnetic field
+template <typename magnetic_field_t>
+FW::TrackFindingAlgorithm::TrackFinderFunction makeTrackFinder(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    std::shared_ptr<magnetic_field_t> inputField, Acts::Logging::Level lvl) {
+  using Updater = Acts::GainMatrixUpdater;
+  using Smoother = Acts::GainMatrixSmoother;
+  using MagneticField = Acts::SharedBField<magnetic_field_t>;
+  using Stepper = Acts::EigenStepper<MagneticField>;
+  using Navigator = Acts::Navigator;
+  using Propagator = Acts::Propagator<Stepper, Navigator>;
+  using SourceLinkSelector = Acts::CKFSourceLinkSelector;
+  using CKF = Acts::CombinatorialKalmanFilter<Propagator, Updater, Smoother,
+                                              SourceLinkSelector>;
+
+  // construct all components for the track finder
+  MagneticField field(std::move(inputField));
+  Stepper stepper(std::move(field));
+  Navigator navigator(trackingGeometry);
+  navigator.resolvePassive = false;
+  navigator.resolveMaterial = true;
+  navigator.resolveSensitive = true;
+  Propagator propagator(std::move(stepper), std::move(navigator));
+  CKF trackFinder(std::move(propagator),
+                  Acts::getDefaultLogger("CombinatorialKalmanFilter", lvl));
+
+  // build the track finder functions. owns the track finder object.
+  return TrackFinderFunctionImpl<CKF>(std::move(trackFinder));
+}
 }  // namespace
 
 FW::TrackFindingAlgorithm::TrackFinderFunction
 FW::TrackFindingAlgorithm::makeTrackFinderFunction(
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
     Options::BFieldVariant magneticField, Acts::Logging::Level lvl) {
-  using Updater = Acts::GainMatrixUpdater;
-  using Smoother = Acts::GainMatrixSmoother;
-
   // unpack the magnetic field variant and instantiate the corresponding track
-  // finder.
+  // finder. each entry in the variant is already a shared_ptr.
   return std::visit(
       [trackingGeometry, lvl](auto&& inputField) -> TrackFinderFunction {
-        // each entry in the variant is already a shared_ptr
-        // need ::element_type to get the real magnetic field type
-        using InputMagneticField =
-            typename std::decay_t<decltype(inputField)>::element_type;
-        using MagneticField = Acts::SharedBField<InputMagneticField>;
-        using Stepper = Acts::EigenStepper<MagneticField>;
-        using Navigator = Acts::Navigator;
-        using Propagator = Acts::Propagator<Stepper, Navigator>;
-        using SourceLinkSelector = Acts::CKFSourceLinkSelector;
-        using CKF =
-            Acts::CombinatorialKalmanFilter<Propagator, Updater, Smoother,
-                                            SourceLinkSelector>;
-
-        // construct all components for the track finder
-        MagneticField field(std::move(inputField));
-        Stepper stepper(std::move(field));
-        Navigator navigator(trackingGeometry);
-        navigator.resolvePassive = false;
-        navigator.resolveMaterial = true;
-        navigator.resolveSensitive = true;
-        Propagator propagator(std::move(stepper), std::move(navigator));
-        CKF trackFinder(
-            std::move(propagator),
-            Acts::getDefaultLogger("CombinatorialKalmanFilter", lvl));
+        return makeTrackFinder(trackingGeometry, std::move(inputField), lvl);
+      },
+      std::move(magneticField));
+}
 
-        // build the track finder functions. owns the track finder object.
-        return TrackFinderFunctionImpl<CKF>(std::move(trackFinder));
+FW::TrackFindingAlgorithm::TrackFinderFunction
+FW::TrackFindingAlgorithm::makeTrackFinderFunction(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    Options::BFieldMapVariant magneticField, Acts::Logging::Level lvl) {
+  return std::visit(
+      [trackingGeometry, lvl](auto&& inputField) -> TrackFinderFunction {
+        return makeTrackFinder(trackingGeometry, std::move(inputField), lvl);
       },
       std::move(magneticField));
 }
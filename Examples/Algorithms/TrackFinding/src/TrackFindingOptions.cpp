@@ -23,17 +23,21 @@ void FW::Options::addTrackFindingOptions(FW::Options::Description& desc) {
   opt("ckf-slselection-nmax", value<size_t>()->default_value(10),
       "Global criteria of maximum number of source link candidates on a "
       "surface for CKF source link selection");
+  opt("ckf-seeds-per-task", value<size_t>()->default_value(8),
+      "Maximum number of seeds processed by one parallel track finding task");
 }
 
 FW::TrackFindingAlgorithm::Config FW::Options::readTrackFindingConfig(
     const FW::Options::Variables& variables) {
   auto chi2Max = variables["ckf-slselection-chi2max"].template as<double>();
   auto nMax = variables["ckf-slselection-nmax"].template as<size_t>();
+  auto seedsPerTask = variables["ckf-seeds-per-task"].template as<size_t>();
 
   // config is a GeometryHierarchyMap with just the global default
   TrackFindingAlgorithm::Config cfg;
   cfg.sourcelinkSelectorCfg = {
       {Acts::GeometryID(), {chi2Max, nMax}},
   };
+  cfg.seedsPerTask = seedsPerTask;
   return cfg;
 }
@@ -26,6 +26,8 @@ FW::ParticleSmearing::ParticleSmearing(const Config& cfg,
   if (m_cfg.outputTrackParameters.empty()) {
     throw std::invalid_argument("Missing output tracks parameters collection");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
+  declareOutput(m_outputTrackParameters, m_cfg.outputTrackParameters);
 }
 
 FW::ProcessCode FW::ParticleSmearing::execute(
@@ -33,8 +35,7 @@ FW::ProcessCode FW::ParticleSmearing::execute(
   namespace vh = Acts::VectorHelpers;
 
   // setup input and output containers
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
   TrackParametersContainer parameters;
   parameters.reserve(particles.size());
 
@@ -105,6 +106,6 @@ FW::ProcessCode FW::ParticleSmearing::execute(
                             particle.charge(), time);
   };
 
-  ctx.eventStore.add(m_cfg.outputTrackParameters, std::move(parameters));
+  m_outputTrackParameters(ctx, std::move(parameters));
   return ProcessCode::SUCCESS;
 }
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimParticle.hpp"
+#include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -57,6 +59,8 @@ class ParticleSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
+  WriteHandle<TrackParametersContainer> m_outputTrackParameters;
 };
 
 }  // namespace FW
@@ -25,6 +25,8 @@ FW::TrackSelector::TrackSelector(const Config& cfg, Acts::Logging::Level level)
   if (m_cfg.output.empty()) {
     throw std::invalid_argument("Missing output collection");
   }
+  declareInput(m_input, m_cfg.input);
+  declareOutput(m_output, m_cfg.output);
 }
 
 FW::ProcessCode FW::TrackSelector::execute(
@@ -32,8 +34,7 @@ FW::ProcessCode FW::TrackSelector::execute(
   std::vector<VertexAndTracks> selected;
 
   // get input tracks
-  const auto& input =
-      ctx.eventStore.get<std::vector<VertexAndTracks>>(m_cfg.input);
+  const auto& input = m_input(ctx);
 
   auto within = [](double x, double min, double max) {
     return (min <= x) and (x < max);
@@ -69,7 +70,7 @@ FW::ProcessCode FW::TrackSelector::execute(
                       << " from " << input.size() << " vertices.");
 
   // write selected tracks
-  ctx.eventStore.add(m_cfg.output, std::move(selected));
+  m_output(ctx, std::move(selected));
 
   return ProcessCode::SUCCESS;
 }
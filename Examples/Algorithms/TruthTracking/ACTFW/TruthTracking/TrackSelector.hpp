@@ -9,9 +9,11 @@
 #pragma once
 
 #include "ACTFW/Framework/BareAlgorithm.hpp"
+#include "ACTFW/TruthTracking/VertexAndTracks.hpp"
 
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace FW {
 
@@ -47,6 +49,8 @@ class TrackSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<std::vector<VertexAndTracks>> m_input;
+  WriteHandle<std::vector<VertexAndTracks>> m_output;
 };
 
 }  // namespace FW
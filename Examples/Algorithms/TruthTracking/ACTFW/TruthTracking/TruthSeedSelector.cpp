@@ -32,16 +32,15 @@ TruthSeedSelector::TruthSeedSelector(const Config& cfg,
   if (m_cfg.outputParticles.empty()) {
     throw std::invalid_argument("Missing output truth particles collection");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
+  declareInput(m_inputHitParticlesMap, m_cfg.inputHitParticlesMap);
+  declareOutput(m_outputParticles, m_cfg.outputParticles);
 }
 
 ProcessCode TruthSeedSelector::execute(const AlgorithmContext& ctx) const {
-  using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
-
   // prepare input collections
-  const auto& inputParticles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputHitParticlesMap);
+  const auto& inputParticles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputHitParticlesMap(ctx);
   // compute particle_id -> {hit_id...} map from the
   // hit_id -> {particle_id...} map on the fly.
   const auto& particleHitsMap = invertIndexMultimap(hitParticlesMap);
@@ -78,6 +77,6 @@ ProcessCode TruthSeedSelector::execute(const AlgorithmContext& ctx) const {
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputParticles, std::move(selectedParticles));
+  m_outputParticles(ctx, std::move(selectedParticles));
   return ProcessCode::SUCCESS;
 }
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ACTFW/EventData/IndexContainers.hpp"
+#include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
 namespace FW {
@@ -61,6 +63,9 @@ class TruthSeedSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputHitParticlesMap;
+  WriteHandle<SimParticleContainer> m_outputParticles;
 };
 
 }  // namespace FW
@@ -31,22 +31,21 @@ TruthTrackFinder::TruthTrackFinder(const Config& cfg, Acts::Logging::Level lvl)
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing output proto tracks collection");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
+  declareInput(m_inputHitParticlesMap, m_cfg.inputHitParticlesMap);
+  declareOutput(m_outputProtoTracks, m_cfg.outputProtoTracks);
 }
 
 ProcessCode TruthTrackFinder::execute(const AlgorithmContext& ctx) const {
-  using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
-
   // prepare input collections
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_cfg.inputHitParticlesMap);
+  const auto& particles = m_inputParticles(ctx);
+  const auto& hitParticlesMap = m_inputHitParticlesMap(ctx);
   // compute particle_id -> {hit_id...} map from the
   // hit_id -> {particle_id...} map on the fly.
   const auto& particleHitsMap = invertIndexMultimap(hitParticlesMap);
 
-  // prepare output collection
-  ProtoTrackContainer tracks;
+  // prepare output collection in the event memory
+  pmr::ProtoTrackContainer tracks(ctx.eventStore.memoryResource());
   tracks.reserve(particles.size());
 
   // create prototracks for all input particles
@@ -54,16 +53,15 @@ ProcessCode TruthTrackFinder::execute(const AlgorithmContext& ctx) const {
     // find the corresponding hits for this particle
     const auto& hits =
         makeRange(particleHitsMap.equal_range(particle.particleId()));
-    // fill hit indices to create the proto track
-    ProtoTrack track;
+    // add proto track to the output collection, which passes on its memory
+    // resource, and fill the hit indices
+    auto& track = tracks.emplace_back();
     track.reserve(hits.size());
     for (const auto& hit : hits) {
       track.emplace_back(hit.second);
     }
-    // add proto track to the output collection
-    tracks.emplace_back(std::move(track));
   }
 
-  ctx.eventStore.add(m_cfg.outputProtoTracks, std::move(tracks));
+  m_outputProtoTracks(ctx, std::move(tracks));
   return ProcessCode::SUCCESS;
 }
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "ACTFW/EventData/IndexContainers.hpp"
+#include "ACTFW/EventData/ProtoTrack.hpp"
+#include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
 namespace FW {
@@ -36,6 +39,9 @@ class TruthTrackFinder final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
+  ReadHandle<IndexMultimap<ActsFatras::Barcode>> m_inputHitParticlesMap;
+  WriteHandle<pmr::ProtoTrackContainer> m_outputProtoTracks;
 };
 
 }  // namespace FW
@@ -32,12 +32,13 @@ FW::TruthVerticesToTracksAlgorithm::TruthVerticesToTracksAlgorithm(
   } else if (m_cfg.randomNumberSvc == nullptr) {
     throw std::invalid_argument("Missing random number service");
   }
+  declareInput(m_inputVertices, m_cfg.input);
+  declareOutput(m_outputVertexAndTracks, m_cfg.output);
 }
 
 FW::ProcessCode FW::TruthVerticesToTracksAlgorithm::execute(
     const AlgorithmContext& context) const {
-  const auto& vertexCollection =
-      context.eventStore.get<std::vector<FW::SimVertex>>(m_cfg.input);
+  const auto& vertexCollection = m_inputVertices(context);
 
   std::shared_ptr<Acts::PerigeeSurface> perigeeSurface =
       Acts::Surface::makeShared<Acts::PerigeeSurface>(m_cfg.refPosition);
@@ -145,7 +146,7 @@ FW::ProcessCode FW::TruthVerticesToTracksAlgorithm::execute(
   }  // end iteration over all vertices
 
   // VertexAndTracks objects to the EventStore
-  context.eventStore.add(m_cfg.output, std::move(vertexAndTracksCollection));
+  m_outputVertexAndTracks(context, std::move(vertexAndTracksCollection));
 
   return FW::ProcessCode::SUCCESS;
 }
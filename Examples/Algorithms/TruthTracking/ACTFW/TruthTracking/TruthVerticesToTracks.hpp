@@ -21,6 +21,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -80,6 +81,8 @@ class TruthVerticesToTracksAlgorithm : public BareAlgorithm {
  private:
   /// Config struct
   Config m_cfg;
+  ReadHandle<std::vector<SimVertex>> m_inputVertices;
+  WriteHandle<std::vector<VertexAndTracks>> m_outputVertexAndTracks;
 
   /// @brief Function that corrects phi and theta wraps
   ///
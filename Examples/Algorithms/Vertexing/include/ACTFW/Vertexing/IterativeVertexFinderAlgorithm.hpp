@@ -12,6 +12,7 @@
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/ProcessCode.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/TruthTracking/VertexAndTracks.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
@@ -19,6 +20,7 @@
 #include "Acts/Vertexing/IterativeVertexFinder.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace FWE {
 
@@ -44,6 +46,7 @@ class IterativeVertexFinderAlgorithm : public FW::BareAlgorithm {
  private:
   /// The config class
   Config m_cfg;
+  FW::ReadHandle<std::vector<FW::VertexAndTracks>> m_inputVertexAndTracks;
 };
 
 }  // namespace FWE
\ No newline at end of file
@@ -10,9 +10,11 @@
 
 #include "ACTFW/EventData/SimVertex.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
+#include "ACTFW/TruthTracking/VertexAndTracks.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 #include <memory>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -52,6 +54,7 @@ class VertexFitAlgorithm : public FW::BareAlgorithm {
  private:
   /// The config class
   Config m_cfg;
+  FW::ReadHandle<std::vector<FW::VertexAndTracks>> m_inputVertexAndTracks;
 };
 
 }  // namespace FWE
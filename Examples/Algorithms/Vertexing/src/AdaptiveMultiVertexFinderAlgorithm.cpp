@@ -32,7 +32,9 @@
 
 FWE::AdaptiveMultiVertexFinderAlgorithm::AdaptiveMultiVertexFinderAlgorithm(
     const Config& cfg, Acts::Logging::Level level)
-    : FW::BareAlgorithm("AMVF Algorithm", level), m_cfg(cfg) {}
+    : FW::BareAlgorithm("AMVF Algorithm", level), m_cfg(cfg) {
+  declareInput(m_inputVertexAndTracks, m_cfg.trackCollection);
+}
 
 /// @brief Algorithm that receives all selected tracks from an event
 /// and finds and fits its vertices
@@ -131,8 +133,7 @@ std::vector<Acts::BoundParameters>
 FWE::AdaptiveMultiVertexFinderAlgorithm::getInputTrackCollection(
     const FW::AlgorithmContext& ctx) const {
   // Setup containers
-  const auto& input = ctx.eventStore.get<std::vector<FW::VertexAndTracks>>(
-      m_cfg.trackCollection);
+  const auto& input = m_inputVertexAndTracks(ctx);
   std::vector<Acts::BoundParameters> inputTrackCollection;
 
   for (auto& vertexAndTracks : input) {
@@ -34,7 +34,9 @@
 
 FWE::IterativeVertexFinderAlgorithm::IterativeVertexFinderAlgorithm(
     const Config& cfg, Acts::Logging::Level level)
-    : FW::BareAlgorithm("VertexFinding", level), m_cfg(cfg) {}
+    : FW::BareAlgorithm("VertexFinding", level), m_cfg(cfg) {
+  declareInput(m_inputVertexAndTracks, m_cfg.trackCollection);
+}
 
 /// @brief Algorithm that receives all selected tracks from an event
 /// and finds and fits its vertices
@@ -85,8 +87,7 @@ FW::ProcessCode FWE::IterativeVertexFinderAlgorithm::execute(
   VertexFinderOptions finderOpts(ctx.geoContext, ctx.magFieldContext);
 
   // Setup containers
-  const auto& input = ctx.eventStore.get<std::vector<FW::VertexAndTracks>>(
-      m_cfg.trackCollection);
+  const auto& input = m_inputVertexAndTracks(ctx);
   std::vector<Acts::BoundParameters> inputTrackCollection;
 
   ACTS_INFO("Truth vertices in event: " << input.size());
@@ -32,7 +32,9 @@
 
 FWE::TutorialAMVFAlgorithm::TutorialAMVFAlgorithm(const Config& cfg,
                                                   Acts::Logging::Level level)
-    : FW::BareAlgorithm("Tutorial AMVF Algorithm", level), m_cfg(cfg) {}
+    : FW::BareAlgorithm("Tutorial AMVF Algorithm", level), m_cfg(cfg) {
+  declareInput(m_inputVertexAndTracks, m_cfg.trackCollection);
+}
 
 /// @brief Tutorial algorithm that receives all selected tracks from an event
 /// and finds and fits its vertices using the AMVF
@@ -72,8 +74,7 @@ std::vector<Acts::BoundParameters>
 FWE::TutorialAMVFAlgorithm::getInputTrackCollection(
     const FW::AlgorithmContext& ctx) const {
   // Setup containers
-  const auto& input = ctx.eventStore.get<std::vector<FW::VertexAndTracks>>(
-      m_cfg.trackCollection);
+  const auto& input = m_inputVertexAndTracks(ctx);
   std::vector<Acts::BoundParameters> inputTrackCollection;
 
   for (auto& vertexAndTracks : input) {
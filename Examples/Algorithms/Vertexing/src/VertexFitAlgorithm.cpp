@@ -28,7 +28,9 @@
 
 FWE::VertexFitAlgorithm::VertexFitAlgorithm(const Config& cfg,
                                             Acts::Logging::Level level)
-    : FW::BareAlgorithm("VertexFit", level), m_cfg(cfg) {}
+    : FW::BareAlgorithm("VertexFit", level), m_cfg(cfg) {
+  declareInput(m_inputVertexAndTracks, m_cfg.trackCollection);
+}
 
 /// @brief Algorithm that receives a set of tracks belonging to a common
 /// vertex and fits the associated vertex to it
@@ -57,8 +59,7 @@ FW::ProcessCode FWE::VertexFitAlgorithm::execute(
   Linearizer::Config ltConfig(bField, propagator);
   Linearizer linearizer(ltConfig);
 
-  const auto& input = ctx.eventStore.get<std::vector<FW::VertexAndTracks>>(
-      m_cfg.trackCollection);
+  const auto& input = m_inputVertexAndTracks(ctx);
   for (auto& vertexAndTracks : input) {
     const auto& inputTrackCollection = vertexAndTracks.tracks;
 
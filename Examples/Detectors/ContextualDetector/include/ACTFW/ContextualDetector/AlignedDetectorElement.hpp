@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ACTFW/ContextualDetector/AlignmentStore.hpp"
 #include "ACTFW/GenericDetector/GenericDetectorElement.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
@@ -16,6 +17,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <any>
 #include <memory>
 
 namespace FW {
@@ -32,8 +34,9 @@ namespace Contextual {
 ///
 /// The nominal transform is only used to once create the alignment
 /// store and then in a contextual call the actual detector element
-/// position is taken internal multi component store - the latter
-/// has to be filled though from an external source
+/// position is taken from the transforms of the current interval of
+/// validity in the central alignment store - the latter has to be filled
+/// though from an external source
 class AlignedDetectorElement : public Generic::GenericDetectorElement {
  public:
   /// @class ContextType
@@ -41,6 +44,9 @@ class AlignedDetectorElement : public Generic::GenericDetectorElement {
   struct ContextType {
     /// The current intervall of validity
     unsigned int iov = 0;
+    /// The alignment transforms of the current interval of validity;
+    /// the nominal transforms are used if not set
+    std::shared_ptr<const AlignmentStore::IovTransforms> alignment = nullptr;
   };
 
   /// Constructor for an alignable surface
@@ -64,30 +70,30 @@ class AlignedDetectorElement : public Generic::GenericDetectorElement {
   const Acts::Transform3D& nominalTransform(
       const Acts::GeometryContext& gctx) const;
 
-  /// Return local to global transform associated with this identifier
+  /// Set the dense index of this element in the alignment store
   ///
-  /// @param alignedTransform is a new transform
-  /// @oaram iov is the batch for which it is meant
-  void addAlignedTransform(std::unique_ptr<Acts::Transform3D> alignedTransform,
-                           unsigned int iov);
+  /// @param alignmentIndex is the index into the transforms of an IOV
+  void setAlignmentIndex(size_t alignmentIndex);
 
-  /// Return the set of alignment transforms in flight
-  const std::vector<std::unique_ptr<Acts::Transform3D>>& alignedTransforms()
-      const;
+  /// Return the dense index of this element in the alignment store
+  size_t alignmentIndex() const;
 
  private:
-  std::vector<std::unique_ptr<Acts::Transform3D>> m_alignedTransforms;
+  size_t m_alignmentIndex = 0;
 };
 
 inline const Acts::Transform3D& AlignedDetectorElement::transform(
     const Acts::GeometryContext& gctx) const {
+  // access the right context object without copying it
+  const ContextType* alignContext = gctx.get<ContextType>();
+  if (alignContext == nullptr) {
+    throw std::bad_any_cast();
+  }
   // Check if a different transform than the nominal exists
-  if (m_alignedTransforms.size()) {
-    // cast into the right context object
-    auto alignContext = std::any_cast<ContextType>(gctx);
-    return (*m_alignedTransforms[alignContext.iov].get());
+  if (alignContext->alignment != nullptr) {
+    return alignContext->alignment->transforms[m_alignmentIndex];
   }
-  // Return the standard transform if not found
+  // Return the standard transform if no alignment is attached
   return nominalTransform(gctx);
 }
 
@@ -96,19 +102,12 @@ inline const Acts::Transform3D& AlignedDetectorElement::nominalTransform(
   return GenericDetectorElement::transform(gctx);
 }
 
-inline void AlignedDetectorElement::addAlignedTransform(
-    std::unique_ptr<Acts::Transform3D> alignedTransform, unsigned int iov) {
-  // most standard case, it's just a new one:
-  auto cios = m_alignedTransforms.size();
-  for (unsigned int ic = cios; ic <= iov; ++ic) {
-    m_alignedTransforms.push_back(nullptr);
-  }
-  m_alignedTransforms[iov] = std::move(alignedTransform);
+inline void AlignedDetectorElement::setAlignmentIndex(size_t alignmentIndex) {
+  m_alignmentIndex = alignmentIndex;
 }
 
-inline const std::vector<std::unique_ptr<Acts::Transform3D>>&
-AlignedDetectorElement::alignedTransforms() const {
-  return m_alignedTransforms;
+inline size_t AlignedDetectorElement::alignmentIndex() const {
+  return m_alignmentIndex;
 }
 
 }  // end of namespace Contextual
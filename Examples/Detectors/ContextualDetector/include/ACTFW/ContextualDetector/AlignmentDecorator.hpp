@@ -9,12 +9,14 @@
 #pragma once
 
 #include "ACTFW/ContextualDetector/AlignedDetectorElement.hpp"
+#include "ACTFW/ContextualDetector/AlignmentStore.hpp"
 #include "ACTFW/Framework/AlgorithmContext.hpp"
 #include "ACTFW/Framework/IContextDecorator.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -25,8 +27,10 @@ namespace Contextual {
 /// @brief A mockup service that rotates the modules in a
 /// simple tracking geometry
 ///
-/// It acts on the PayloadDetectorElement, i.e. the
-/// geometry context carries the full transform store (payload)
+/// It acts on the AlignedDetectorElement, i.e. the geometry context
+/// carries the transforms of the current interval of validity (IOV) from
+/// the central alignment store. The transforms of an IOV are emulated once
+/// from the IOV number, independent of the event that requests them first.
 class AlignmentDecorator : public IContextDecorator {
  public:
   using LayerStore = std::vector<std::shared_ptr<AlignedDetectorElement>>;
@@ -40,7 +44,7 @@ class AlignmentDecorator : public IContextDecorator {
     /// Alignment frequency - every X events
     unsigned int iovSize = 100;
 
-    /// Flush store size - garbage collection
+    /// Flush store size - number of IOVs kept in the alignment store
     unsigned int flushSize = 200;
 
     std::shared_ptr<RandomNumbers> randomNumberSvc = nullptr;
@@ -86,9 +90,16 @@ class AlignmentDecorator : public IContextDecorator {
   std::string m_name = "AlignmentDecorator";
 
   ///< protect multiple alignments to be loaded at once
-  std::mutex m_alignmentMutex;
-  std::vector<bool> m_iovStatus;
-  std::vector<bool> m_flushStatus;
+  /// Number of aligned detector elements
+  size_t m_numElements = 0;
+  /// The transforms of the IOVs in flight
+  AlignmentStore m_store;
+  /// Serializes the creation of new IOVs; lookups are lock-free
+  std::mutex m_creationMutex;
+
+  /// Emulate the alignment transforms of a new IOV
+  AlignmentStore::IovTransforms createIov(const AlgorithmContext& context,
+                                          unsigned int iov) const;
 
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_logger; }
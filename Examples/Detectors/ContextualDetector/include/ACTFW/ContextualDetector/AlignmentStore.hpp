@@ -0,0 +1,166 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/AlignedAllocator.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace FW {
+
+namespace Contextual {
+
+/// @class AlignmentStore
+///
+/// Central store of the alignment transforms for several intervals of
+/// validity (IOV) in flight.
+///
+/// The transforms of one IOV are kept in one contiguous, cache line aligned
+/// array that is indexed with the dense alignment index of the detector
+/// elements. Published IOVs are immutable and are reached through atomic
+/// pointers, i.e. lookups never take a lock. Each IOV occupies one of the
+/// slots, starting the search at slot (iov modulo the number of slots). A
+/// new IOV only replaces an IOV that is still used by an event if all slots
+/// are in use. Replaced IOVs are retired and deleted once no event and no
+/// lookup refers to them anymore.
+class AlignmentStore {
+ public:
+  using Transforms =
+      std::vector<Acts::Transform3D,
+                  Acts::AlignedAllocator<Acts::Transform3D, 64>>;
+
+  /// The alignment transforms of all detector elements for one IOV
+  struct IovTransforms {
+    /// The interval of validity
+    unsigned int iov = 0;
+    /// The transforms indexed by the alignment index
+    Transforms transforms;
+  };
+
+  /// Constructor
+  ///
+  /// @param numSlots The maximum number of IOVs kept in the store
+  AlignmentStore(size_t numSlots) : m_slots(numSlots) {
+    if (numSlots == 0) {
+      throw std::invalid_argument("Alignment store needs at least one slot");
+    }
+    for (auto& slot : m_slots) {
+      slot.store(nullptr);
+    }
+  }
+
+  /// Destructor
+  ///
+  /// @note The transforms returned by the store must not be used anymore
+  ~AlignmentStore() {
+    for (auto& slot : m_slots) {
+      delete slot.load();
+    }
+    for (Node* node : m_retired) {
+      delete node;
+    }
+  }
+
+  AlignmentStore(const AlignmentStore&) = delete;
+  AlignmentStore& operator=(const AlignmentStore&) = delete;
+
+  /// Find the transforms of an IOV
+  ///
+  /// @param iov The interval of validity
+  /// @return The transforms or nullptr if the IOV is not (or no longer)
+  ///         present in the store
+  std::shared_ptr<const IovTransforms> find(unsigned int iov) const {
+    // retired IOVs are not deleted while a lookup is in progress
+    m_lookups.fetch_add(1);
+    Node* found = nullptr;
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+      Node* node = m_slots[(iov + i) % m_slots.size()].load();
+      if (node != nullptr and node->transforms.iov == iov) {
+        node->refs.fetch_add(1);
+        found = node;
+        break;
+      }
+    }
+    m_lookups.fetch_sub(1);
+    return acquired(found);
+  }
+
+  /// Publish the transforms of an IOV
+  ///
+  /// @param transforms The transforms of an IOV that is not in the store
+  /// @return The published transforms
+  ///
+  /// @note Calls must be serialized, lookups can run concurrently
+  std::shared_ptr<const IovTransforms> publish(IovTransforms transforms) {
+    const unsigned int iov = transforms.iov;
+    Node* node = new Node{std::move(transforms)};
+    node->refs.store(1);
+    // prefer an empty slot or one with an IOV that is not used anymore
+    size_t index = iov % m_slots.size();
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+      Node* occupant = m_slots[(iov + i) % m_slots.size()].load();
+      if (occupant == nullptr or occupant->refs.load() == 0) {
+        index = (iov + i) % m_slots.size();
+        break;
+      }
+    }
+    Node* replaced = m_slots[index].exchange(node);
+    if (replaced != nullptr) {
+      m_retired.push_back(replaced);
+    }
+    // a lookup in progress might still acquire a retired IOV
+    if (m_lookups.load() == 0) {
+      auto unused = std::partition(
+          m_retired.begin(), m_retired.end(),
+          [](const Node* retired) { return 0 < retired->refs.load(); });
+      for (auto it = unused; it != m_retired.end(); ++it) {
+        delete *it;
+      }
+      m_retired.erase(unused, m_retired.end());
+    }
+    return acquired(node);
+  }
+
+  /// Number of replaced IOVs that are not yet deleted
+  ///
+  /// @note Calls must be serialized with publish
+  size_t numRetired() const { return m_retired.size(); }
+
+ private:
+  struct Node {
+    IovTransforms transforms;
+    /// Number of events that use the transforms
+    std::atomic<size_t> refs{0};
+  };
+
+  /// Wrap an IOV with an acquired reference that is released with it
+  static std::shared_ptr<const IovTransforms> acquired(Node* node) {
+    if (node == nullptr) {
+      return nullptr;
+    }
+    return std::shared_ptr<const IovTransforms>(
+        &node->transforms, [node](const IovTransforms* /*transforms*/) {
+          node->refs.fetch_sub(1);
+        });
+  }
+
+  std::vector<std::atomic<Node*>> m_slots;
+  /// Number of lookups in progress
+  mutable std::atomic<size_t> m_lookups{0};
+  /// Replaced IOVs that might still be in use
+  std::vector<Node*> m_retired;
+};
+
+}  // end of namespace Contextual
+}  // end of namespace FW
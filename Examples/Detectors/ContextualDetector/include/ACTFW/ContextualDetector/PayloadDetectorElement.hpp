@@ -16,6 +16,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <any>
 #include <map>
 
 namespace FW {
@@ -66,13 +67,16 @@ class PayloadDetectorElement : public Generic::GenericDetectorElement {
 
 inline const Acts::Transform3D& PayloadDetectorElement::transform(
     const Acts::GeometryContext& gctx) const {
-  // cast into the right context object
-  auto alignContext = std::any_cast<ContextType>(gctx);
+  // access the right context object without copying the alignment store
+  const ContextType* alignContext = gctx.get<ContextType>();
+  if (alignContext == nullptr) {
+    throw std::bad_any_cast();
+  }
   identifier_type idValue = identifier_type(identifier());
 
   // check if we have the right alignment parameter in hand
-  if (idValue < alignContext.alignmentStore.size()) {
-    return alignContext.alignmentStore[idValue];
+  if (idValue < alignContext->alignmentStore.size()) {
+    return alignContext->alignmentStore[idValue];
   }
   // Return the standard transform if not found
   return GenericDetectorElement::transform(gctx);
@@ -38,7 +38,7 @@ void AlignedDetector::addOptions(
       "Size of a valid IOV.")(
       "align-flushsize",
       boost::program_options::value<size_t>()->default_value(200),
-      "Span until garbage collection is active.")(
+      "Number of IOVs kept in the alignment store.")(
       "align-sigma-iplane",
       boost::program_options::value<double>()->default_value(100.),
       "Sigma of the in-plane misalignment in [um]")(
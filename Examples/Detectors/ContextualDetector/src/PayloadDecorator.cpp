@@ -35,8 +35,7 @@ FW::ProcessCode FW::Contextual::PayloadDecorator::decorate(
     // This creates a full payload context, i.e. the nominal store
     PayloadDetectorElement::ContextType alignableGeoContext;
     alignableGeoContext.alignmentStore = std::move(aStore);
-    context.geoContext =
-        std::make_any<PayloadDetectorElement::ContextType>(alignableGeoContext);
+    context.geoContext = std::move(alignableGeoContext);
   }
   return ProcessCode::SUCCESS;
 }
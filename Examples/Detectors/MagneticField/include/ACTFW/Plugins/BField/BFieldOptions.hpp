@@ -8,23 +8,18 @@
 
 #pragma once
 
+#include "ACTFW/Plugins/BField/BFieldUtils.hpp"
 #include "ACTFW/Utilities/OptionsFwd.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/Utilities//Definitions.hpp"
-#include "Acts/Utilities/detail/AxisFwd.hpp"
-#include "Acts/Utilities/detail/GridFwd.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <variant>
 
 // Forward declarations
 namespace Acts {
-template <typename G>
-struct InterpolatedBFieldMapper;
-
-template <typename M>
-class InterpolatedBFieldMap;
-
 class ConstantBField;
 }  // namespace Acts
 
@@ -34,33 +29,96 @@ class ScalableBField;
 }
 }  // namespace FW
 
-using InterpolatedMapper2D = Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>;
+using InterpolatedMapper2D = Acts::InterpolatedBFieldMapperRZ;
 
-using InterpolatedMapper3D = Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
+using InterpolatedMapper3D = Acts::InterpolatedBFieldMapperXYZ;
 
 using InterpolatedBFieldMap2D =
     Acts::InterpolatedBFieldMap<InterpolatedMapper2D>;
 using InterpolatedBFieldMap3D =
     Acts::InterpolatedBFieldMap<InterpolatedMapper3D>;
 
+using CompactBFieldMap2D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperRZ<float>>;
+using CompactBFieldMap3D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperXYZ<float>>;
+
+using ScaledBFieldMap2D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperRZ<int16_t>>;
+using ScaledBFieldMap3D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperXYZ<int16_t>>;
+
+using MappedBFieldMap2D =
+    Acts::InterpolatedBFieldMap<FW::BField::binary::MappedBFieldMapperRZ>;
+using MappedBFieldMap3D =
+    Acts::InterpolatedBFieldMap<FW::BField::binary::MappedBFieldMapperXYZ>;
+
 namespace FW {
 
 namespace Options {
 
+/// Magnetic fields that can be used by the algorithms.
+///
+/// @note Every visitor instantiates its propagation, fitting or simulation
+///       code once per alternative, i.e. the compact and memory-mapped field
+///       maps are kept in BFieldMapVariant. Jobs that support them read the
+///       field via visitBField.
 using BFieldVariant = std::variant<std::shared_ptr<InterpolatedBFieldMap2D>,
                                    std::shared_ptr<InterpolatedBFieldMap3D>,
                                    std::shared_ptr<Acts::ConstantBField>,
                                    std::shared_ptr<FW::BField::ScalableBField>>;
 
+/// Field maps including the compact and the memory-mapped storage.
+///
+/// The compact field maps store the field values as float or as scaled
+/// int16 and need a half or a quarter of the memory. The field maps read
+/// from a memory-mapped binary file share their values between processes
+/// and need no parsing at startup.
+using BFieldMapVariant =
+    std::variant<std::shared_ptr<InterpolatedBFieldMap2D>,
+                 std::shared_ptr<InterpolatedBFieldMap3D>,
+                 std::shared_ptr<CompactBFieldMap2D>,
+                 std::shared_ptr<CompactBFieldMap3D>,
+                 std::shared_ptr<ScaledBFieldMap2D>,
+                 std::shared_ptr<ScaledBFieldMap3D>,
+                 std::shared_ptr<MappedBFieldMap2D>,
+                 std::shared_ptr<MappedBFieldMap3D>>;
+
 // common bfield options, with a bf prefix
 void addBFieldOptions(boost::program_options::options_description& opt);
 
+// whether the selected field map is only held by BFieldMapVariant, i.e. it
+// uses compact storage or is a memory-mapped '.bfm' field map, and must be
+// read by readBFieldMap
+bool useBFieldMap(const boost::program_options::variables_map& vm);
+
 // create the bfield maps
+//
+// @throws std::invalid_argument if useBFieldMap is true
 BFieldVariant readBField(const boost::program_options::variables_map& vm);
 
+// create the bfield maps with any storage
+//
+// @throws std::invalid_argument if no field map is given
+BFieldMapVariant readBFieldMap(
+    const boost::program_options::variables_map& vm);
+
+// create the bfield and call the visitor with it
+//
+// The field is read by readBFieldMap if useBFieldMap is true and by
+// readBField otherwise, i.e. the visitor is instantiated for the
+// alternatives of both variants.
+template <typename visitor_t>
+void visitBField(const boost::program_options::variables_map& vm,
+                 visitor_t&& visitor) {
+  if (useBFieldMap(vm)) {
+    auto bField = readBFieldMap(vm);
+    std::visit(visitor, bField);
+  } else {
+    auto bField = readBField(vm);
+    std::visit(visitor, bField);
+  }
+}
+
 }  // namespace Options
 }  // namespace FW
@@ -8,11 +8,17 @@
 
 #pragma once
 
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
+#include "Acts/Utilities/detail/GridView.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
 
 namespace FW {
 
@@ -57,16 +63,16 @@ namespace txt {
 /// If the flag is set to true the r-axis grid values will be set to
 /// {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-fieldMapperRZ(std::function<size_t(std::array<size_t, 2> binsRZ,
-                                   std::array<size_t, 2> nBinsRZ)>
-                  localToGlobalBin,
-              std::string fieldMapFile = "",
-              double lengthUnit = Acts::units::_mm,
-              double BFieldUnit = Acts::units::_T, size_t nPoints = 1000,
-              bool firstOctant = false);
+/// @tparam scalar_t Scalar type used to store the field components, @c double,
+/// @c float or @c int16_t, see Acts::fieldMapperRZ
+template <typename scalar_t = double>
+Acts::CompactBFieldMapperRZ<scalar_t> fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2> binsRZ,
+                         std::array<size_t, 2> nBinsRZ)>
+        localToGlobalBin,
+    std::string fieldMapFile = "", double lengthUnit = Acts::units::_mm,
+    double BFieldUnit = Acts::units::_T, size_t nPoints = 1000,
+    bool firstOctant = false);
 
 /// Method to setup the FieldMapper
 /// @param localToGlobalBin Function mapping the local bins of x,y,z to the
@@ -111,16 +117,16 @@ fieldMapperRZ(std::function<size_t(std::array<size_t, 2> binsRZ,
 /// If the flag is set to true the z-axis grid values will be set to
 /// {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-fieldMapperXYZ(std::function<size_t(std::array<size_t, 3> binsXYZ,
-                                    std::array<size_t, 3> nBinsXYZ)>
-                   localToGlobalBin,
-               std::string fieldMapFile = "",
-               double lengthUnit = Acts::units::_mm,
-               double BFieldUnit = Acts::units::_T, size_t nPoints = 1000,
-               bool firstOctant = false);
+/// @tparam scalar_t Scalar type used to store the field components, @c double,
+/// @c float or @c int16_t, see Acts::fieldMapperXYZ
+template <typename scalar_t = double>
+Acts::CompactBFieldMapperXYZ<scalar_t> fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3> binsXYZ,
+                         std::array<size_t, 3> nBinsXYZ)>
+        localToGlobalBin,
+    std::string fieldMapFile = "", double lengthUnit = Acts::units::_mm,
+    double BFieldUnit = Acts::units::_T, size_t nPoints = 1000,
+    bool firstOctant = false);
 }  // namespace txt
 
 namespace root {
@@ -158,15 +164,16 @@ namespace root {
 /// If the flag is set to true the r-axis grid values will be set to
 /// {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-fieldMapperRZ(std::function<size_t(std::array<size_t, 2> binsRZ,
-                                   std::array<size_t, 2> nBinsRZ)>
-                  localToGlobalBin,
-              std::string fieldMapFile = "", std::string treeName = "",
-              double lengthUnit = Acts::units::_mm,
-              double BFieldUnit = Acts::units::_T, bool firstOctant = false);
+/// @tparam scalar_t Scalar type used to store the field components, @c double,
+/// @c float or @c int16_t, see Acts::fieldMapperRZ
+template <typename scalar_t = double>
+Acts::CompactBFieldMapperRZ<scalar_t> fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2> binsRZ,
+                         std::array<size_t, 2> nBinsRZ)>
+        localToGlobalBin,
+    std::string fieldMapFile = "", std::string treeName = "",
+    double lengthUnit = Acts::units::_mm, double BFieldUnit = Acts::units::_T,
+    bool firstOctant = false);
 
 /// Method to setup the FieldMapper
 /// @param localToGlobalBin Function mapping the local bins of x,y,z to the
@@ -207,17 +214,88 @@ fieldMapperRZ(std::function<size_t(std::array<size_t, 2> binsRZ,
 /// If the flag is set to true the z-axis grid values will be set to
 /// {-1,0,1}
 /// and the BFieldValues will be set to {3,2,3}.
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-fieldMapperXYZ(std::function<size_t(std::array<size_t, 3> binsXYZ,
-                                    std::array<size_t, 3> nBinsXYZ)>
-                   localToGlobalBin,
-               std::string fieldMapFile = "", std::string treeName = "",
-               double lengthUnit = Acts::units::_mm,
-               double BFieldUnit = Acts::units::_T, bool firstOctant = false);
+/// @tparam scalar_t Scalar type used to store the field components, @c double,
+/// @c float or @c int16_t, see Acts::fieldMapperXYZ
+template <typename scalar_t = double>
+Acts::CompactBFieldMapperXYZ<scalar_t> fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3> binsXYZ,
+                         std::array<size_t, 3> nBinsXYZ)>
+        localToGlobalBin,
+    std::string fieldMapFile = "", std::string treeName = "",
+    double lengthUnit = Acts::units::_mm, double BFieldUnit = Acts::units::_T,
+    bool firstOctant = false);
 }  // namespace root
 
+namespace binary {
+
+/// @brief Fixed-size header of a binary field map file
+///
+/// The binary layout mirrors the in-memory storage of the field map grid, so
+/// the file can be memory-mapped and used without any parsing. The header is
+/// followed, at @c dataOffset, by the raw field values of the grid including
+/// its under- and overflow bins in the order of the global bins. Lengths and
+/// field values are stored in Acts units and all numbers are stored in the
+/// native byte order, which is checked using @c byteOrder.
+struct Header {
+  /// identifier of binary field map files
+  static constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                                  'B', 'F', 'M', '\0'};
+  /// current version of the layout
+  static constexpr uint32_t s_version = 1;
+  /// marker to detect a mismatching byte order
+  static constexpr uint32_t s_byteOrder = 0x01020304;
+  /// alignment of the field values in the file, i.e. the page size
+  static constexpr uint64_t s_dataAlignment = 4096;
+
+  std::array<char, 8> magic = s_magic;
+  uint32_t version = s_version;
+  uint32_t byteOrder = s_byteOrder;
+  /// number of grid dimensions, 2 for (r,z) and 3 for (x,y,z) maps
+  uint32_t dimensions = 0;
+  /// size of one stored field value in bytes
+  uint32_t valueSize = 0;
+  /// number of bins along each axis, without under- and overflow bins
+  std::array<uint64_t, 3> nBins = {{0, 0, 0}};
+  /// lower edges of the axes
+  std::array<double, 3> min = {{0., 0., 0.}};
+  /// upper edges of the axes
+  std::array<double, 3> max = {{0., 0., 0.}};
+  /// total number of stored values, including under- and overflow bins
+  uint64_t nValues = 0;
+  /// offset of the first field value w.r.t. the beginning of the file
+  uint64_t dataOffset = 0;
+};
+
+/// Field mapper for (r,z) maps referring to the values of a mapped file
+using MappedBFieldMapperRZ = Acts::InterpolatedBFieldMapper<
+    Acts::detail::GridView<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                           Acts::detail::EquidistantAxis>,
+    Acts::RZPositionTransform, Acts::RZFieldTransform>;
+
+/// Field mapper for (x,y,z) maps referring to the values of a mapped file
+using MappedBFieldMapperXYZ = Acts::InterpolatedBFieldMapper<
+    Acts::detail::GridView<Acts::Vector3D, Acts::detail::EquidistantAxis,
+                           Acts::detail::EquidistantAxis,
+                           Acts::detail::EquidistantAxis>,
+    Acts::XYZPositionTransform, Acts::XYZFieldTransform>;
+
+/// Method to setup the FieldMapper from a binary (r,z) field map file
+///
+/// The file is mapped read-only into memory and the grid view refers to the
+/// mapped values directly, i.e. the pages can be shared between all processes
+/// using the same file. The mapping is released once the last copy of the
+/// mapper is destroyed.
+///
+/// @param[in] fieldMapFile Path to the binary field map file, as written by
+///            FW::BinaryBFieldWriter
+MappedBFieldMapperRZ fieldMapperRZ(const std::string& fieldMapFile);
+
+/// Method to setup the FieldMapper from a binary (x,y,z) field map file
+///
+/// @copydetails fieldMapperRZ
+MappedBFieldMapperXYZ fieldMapperXYZ(const std::string& fieldMapFile);
+}  // namespace binary
+
 }  // namespace BField
 
 }  // namespace FW
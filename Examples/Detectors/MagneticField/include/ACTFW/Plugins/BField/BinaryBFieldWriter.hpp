@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ACTFW/Plugins/BField/BFieldUtils.hpp"
+#include <Acts/MagneticField/InterpolatedBFieldMap.hpp>
+#include <Acts/Utilities/Logger.hpp>
+
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace FW {
+
+/// @class BinaryBFieldWriter
+///
+/// Writes out the Acts::InterpolatedBFieldMap in the binary layout described
+/// by FW::BField::binary::Header, which can be memory-mapped by
+/// FW::BField::binary::fieldMapperRZ/fieldMapperXYZ. In contrast to the
+/// RootBFieldWriter the map is written on its own grid, i.e. without any
+/// resampling.
+template <typename bfield_t>
+class BinaryBFieldWriter {
+ public:
+  struct Config {
+    /// The name of the output file
+    std::string fileName = "BField.bfm";
+    /// The magnetic field to be written out
+    std::shared_ptr<const bfield_t> bField = nullptr;
+  };
+
+  /// Write down an interpolated magnetic field map
+  static void run(const Config& cfg,
+                  std::unique_ptr<const Acts::Logger> p_logger =
+                      Acts::getDefaultLogger("BinaryBFieldWriter",
+                                             Acts::Logging::INFO)) {
+    // Set up (local) logging
+    // @todo Remove dangerous using declaration once the logger macro
+    // tolerates it
+    using namespace Acts;
+    ACTS_LOCAL_LOGGER(std::move(p_logger))
+
+    // Check basic configuration
+    if (cfg.fileName.empty()) {
+      throw std::invalid_argument("Missing file name");
+    } else if (!cfg.bField) {
+      throw std::invalid_argument("Missing interpolated magnetic field");
+    }
+
+    // Get the underlying mapper and grid of the InterpolatedBFieldMap
+    const auto& mapper = cfg.bField->getMapper();
+    const auto& grid = mapper.getGrid();
+    using Grid_t = std::decay_t<decltype(grid)>;
+    using Header = FW::BField::binary::Header;
+    static_assert(
+        std::is_same_v<typename Grid_t::value_type::Scalar, double>,
+        "Binary field maps store double precision values");
+
+    Header header;
+    header.dimensions = Grid_t::DIM;
+    header.valueSize = sizeof(typename Grid_t::value_type);
+    auto nBins = mapper.getNBins();
+    auto minima = mapper.getMin();
+    auto maxima = mapper.getMax();
+    for (size_t i = 0; i < Grid_t::DIM; ++i) {
+      header.nBins[i] = nBins[i];
+      header.min[i] = minima[i];
+      header.max[i] = maxima[i];
+    }
+    header.nValues = grid.size();
+    header.dataOffset = Header::s_dataAlignment;
+
+    ACTS_INFO("Writing binary magnetic field map with "
+              << header.nValues << " values to " << cfg.fileName);
+    std::ofstream outputFile(cfg.fileName, std::ios::out | std::ios::binary |
+                                               std::ios::trunc);
+    if (!outputFile) {
+      throw std::ios_base::failure("Could not open '" + cfg.fileName + "'");
+    }
+    // the values start at the next page boundary behind the header
+    std::vector<char> padding(header.dataOffset - sizeof(Header), '\0');
+    outputFile.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    outputFile.write(padding.data(), padding.size());
+    outputFile.write(reinterpret_cast<const char*>(grid.data()),
+                     header.nValues * header.valueSize);
+    if (!outputFile) {
+      throw std::ios_base::failure("Could not write '" + cfg.fileName + "'");
+    }
+  }
+};
+
+}  // namespace FW
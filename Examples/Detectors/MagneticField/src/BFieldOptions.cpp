@@ -16,135 +16,43 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 #include <boost/program_options.hpp>
 
 namespace po = boost::program_options;
 
-using InterpolatedMapper2D = Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>;
+using InterpolatedMapper2D = Acts::InterpolatedBFieldMapperRZ;
 
-using InterpolatedMapper3D = Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
+using InterpolatedMapper3D = Acts::InterpolatedBFieldMapperXYZ;
 
 using InterpolatedBFieldMap2D =
     Acts::InterpolatedBFieldMap<InterpolatedMapper2D>;
 using InterpolatedBFieldMap3D =
     Acts::InterpolatedBFieldMap<InterpolatedMapper3D>;
 
-namespace FW {
-
-namespace Options {
-
-// common bfield options, with a bf prefix
-void addBFieldOptions(boost::program_options::options_description& opt) {
-  opt.add_options()("bf-map", po::value<std::string>()->default_value(""),
-                    "Set this string to point to the bfield source file."
-                    "That can either be a '.txt', a '.csv' or a '.root' file. "
-                    "Omit for a constant magnetic field.")(
-      "bf-name", po::value<std::string>()->default_value("bField"),
-      "In case your field map file is given in root format, please specify "
-      "the "
-      "name of the TTree.")(
-      "bf-gridpoints", po::value<size_t>()->default_value(100000),
-      "Estimate of number of grid points, "
-      "needed for allocation, only for txt and csv files.")(
-      "bf-lscalor", po::value<double>()->default_value(1.),
-      "The default unit for the grid "
-      "points is mm. In case the grid points of your field map has another "
-      "unit, please set  the scalor to mm.")(
-      "bf-bscalor", po::value<double>()->default_value(1.),
-      "The default unit for the magnetic field values is Tesla. In case the "
-      "grid points of your field map has another unit, please set  the "
-      "scalor "
-      "to [T].")(
-      "bf-rz", po::value<bool>()->default_value(false),
-      "Please set this flag to true, if your grid points and your "
-      "magnetic field values are given in 'rz'. The default is 'xyz'.")(
-      "bf-foctant", po::value<bool>()->default_value(false),
-      "Please set this flag to true, if your field map is only given for the "
-      "first octant/quadrant and should be symmetrically created for all "
-      "other "
-      "octants/quadrants.")(
-      "bf-values",
-      po::value<read_range>()->multitoken()->default_value({0., 0., 0.}),
-      "In case no magnetic field map is handed over. A constant magnetic "
-      "field will be created automatically. The values can be set with this "
-      "options. Please hand over the coordinates in cartesian coordinates: "
-      "{Bx,By,Bz} in Tesla.")(
-      "bf-context-scalable", po::value<bool>()->default_value(false),
-      "This is for testing the event dependent magnetic field scaling.");
-}
-
-// create the bfield maps
-BFieldVariant readBField(const boost::program_options::variables_map& vm) {
-  std::string bfieldmap = "constfield";
-
-  enum BFieldMapType { constant = 0, root = 1, text = 2 };
+namespace {
 
-  std::shared_ptr<InterpolatedBFieldMap2D> map2D = nullptr;
-  std::shared_ptr<InterpolatedBFieldMap3D> map3D = nullptr;
-  std::shared_ptr<Acts::ConstantBField> mapConst = nullptr;
-  std::shared_ptr<FW::BField::ScalableBField> mapScale = nullptr;
+// read a root or text field map storing the field components as scalar_t
+template <typename scalar_t>
+FW::Options::BFieldMapVariant readFieldMap(
+    const boost::program_options::variables_map& vm, bool root,
+    double lengthUnit, double BFieldUnit, double bscalor) {
+  using Map2D =
+      Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperRZ<scalar_t>>;
+  using Map3D =
+      Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperXYZ<scalar_t>>;
 
-  int bfieldmaptype = constant;
-  if (vm.count("bf-map") && vm["bf-map"].template as<std::string>() != "") {
-    bfieldmap = vm["bf-map"].template as<std::string>();
-    std::cout << "- read in magnetic field map: "
-              << vm["bf-map"].template as<std::string>() << std::endl;
-    if (bfieldmap.find(".root") != std::string::npos) {
-      std::cout << "- root format for magnetic field detected" << std::endl;
-      bfieldmaptype = root;
-    } else if (bfieldmap.find(".txt") != std::string::npos ||
-               bfieldmap.find(".csv") != std::string::npos) {
-      std::cout << "- txt format for magnetic field detected" << std::endl;
-      bfieldmaptype = text;
-    } else {
-      std::cout << "- magnetic field format could not be detected";
-      std::cout << " use '.root', '.txt', or '.csv'." << std::endl;
-      throw std::runtime_error("Invalid BField options");
-    }
-  }
-  if (bfieldmaptype == text && vm.count("bf-gridpoints")) {
-    std::cout << "- number of points set to: "
-              << vm["bf-gridpoints"].template as<size_t>() << std::endl;
-  }
-  double lscalor = 1.;
-  if (bfieldmaptype != constant && vm.count("bf-lscalor")) {
-    lscalor = vm["bf-lscalor"].template as<double>();
-    std::cout << "- length scalor to mm set to: " << lscalor << std::endl;
-  }
-  double bscalor = 1.;
-  if (vm.count("bf-bscalor")) {
-    bscalor = vm["bf-bscalor"].template as<double>();
-    std::cout << "- BField (scalor to/in) Tesla set to: " << bscalor
-              << std::endl;
-  }
-  if (bfieldmaptype != constant && vm["bf-rz"].template as<bool>())
-    std::cout << "- BField map is given in 'rz' coordiantes." << std::endl;
-  else if (bfieldmaptype != constant)
-    std::cout << "- BField map is given in 'xyz' coordiantes." << std::endl;
-
-  if (bfieldmaptype != constant && vm["bf-foctant"].template as<bool>()) {
-    std::cout
-        << "- Only the first octant/quadrant is given, bField map will be "
-           "symmetrically created for all other octants/quadrants"
-        << std::endl;
-  }
-
-  // Declare the mapper
-  double lengthUnit = lscalor * Acts::units::_mm;
-  double BFieldUnit = bscalor * Acts::units::_T;
-
-  // set the mapper - foort
-  if (bfieldmaptype == root) {
+  if (root) {
     if (vm["bf-rz"].template as<bool>()) {
-      auto mapper2D = FW::BField::root::fieldMapperRZ(
+      auto mapper2D = FW::BField::root::fieldMapperRZ<scalar_t>(
           [](std::array<size_t, 2> binsRZ, std::array<size_t, 2> nBinsRZ) {
             return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
           },
@@ -153,13 +61,13 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
           vm["bf-foctant"].template as<bool>());
 
       // create field mapping
-      InterpolatedBFieldMap2D::Config config2D(std::move(mapper2D));
+      typename Map2D::Config config2D(std::move(mapper2D));
       config2D.scale = bscalor;
       // create BField service
-      return std::make_shared<InterpolatedBFieldMap2D>(std::move(config2D));
+      return std::make_shared<Map2D>(std::move(config2D));
 
     } else {
-      auto mapper3D = FW::BField::root::fieldMapperXYZ(
+      auto mapper3D = FW::BField::root::fieldMapperXYZ<scalar_t>(
           [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
             return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
                     binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
@@ -169,14 +77,14 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
           vm["bf-foctant"].template as<bool>());
 
       // create field mapping
-      InterpolatedBFieldMap3D::Config config3D(std::move(mapper3D));
+      typename Map3D::Config config3D(std::move(mapper3D));
       config3D.scale = bscalor;
       // create BField service
-      return std::make_shared<InterpolatedBFieldMap3D>(std::move(config3D));
+      return std::make_shared<Map3D>(std::move(config3D));
     }
-  } else if (bfieldmaptype == text) {
+  } else {
     if (vm["bf-rz"].template as<bool>()) {
-      auto mapper2D = FW::BField::txt::fieldMapperRZ(
+      auto mapper2D = FW::BField::txt::fieldMapperRZ<scalar_t>(
           [](std::array<size_t, 2> binsRZ, std::array<size_t, 2> nBinsRZ) {
             return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
           },
@@ -185,13 +93,13 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
           vm["bf-foctant"].template as<bool>());
 
       // create field mapping
-      InterpolatedBFieldMap2D::Config config2D(std::move(mapper2D));
+      typename Map2D::Config config2D(std::move(mapper2D));
       config2D.scale = bscalor;
       // create BField service
-      return std::make_shared<InterpolatedBFieldMap2D>(std::move(config2D));
+      return std::make_shared<Map2D>(std::move(config2D));
 
     } else {
-      auto mapper3D = FW::BField::txt::fieldMapperXYZ(
+      auto mapper3D = FW::BField::txt::fieldMapperXYZ<scalar_t>(
           [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
             return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
                     binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
@@ -201,36 +109,231 @@ BFieldVariant readBField(const boost::program_options::variables_map& vm) {
           vm["bf-foctant"].template as<bool>());
 
       // create field mapping
-      InterpolatedBFieldMap3D::Config config3D(std::move(mapper3D));
+      typename Map3D::Config config3D(std::move(mapper3D));
       config3D.scale = bscalor;
       // create BField service
-      return std::make_shared<InterpolatedBFieldMap3D>(std::move(config3D));
+      return std::make_shared<Map3D>(std::move(config3D));
     }
-  } else {  // constant
-    // No bfield map is handed over
-    // get the constant bField values
-    auto bFieldValues = vm["bf-values"].template as<read_range>();
-    if (bFieldValues.size() != 3) {
-      throw std::invalid_argument(
-          "- The values handed over for the constant magnetic field "
-          "have wrong dimension. Needs to have 3 dimension. Please "
-          "hand over the coordinates in cartesian coordinates: "
-          "{Bx,By,Bz} in Tesla.");
+  }
+}
+
+// read a field map file with any storage
+FW::Options::BFieldMapVariant readFieldMapFile(
+    const boost::program_options::variables_map& vm) {
+  enum BFieldMapType { root = 1, text = 2, binary = 3 };
+
+  std::string bfieldmap = vm["bf-map"].template as<std::string>();
+  std::cout << "- read in magnetic field map: " << bfieldmap << std::endl;
+  int bfieldmaptype = root;
+  if (bfieldmap.find(".root") != std::string::npos) {
+    std::cout << "- root format for magnetic field detected" << std::endl;
+    bfieldmaptype = root;
+  } else if (bfieldmap.find(".txt") != std::string::npos ||
+             bfieldmap.find(".csv") != std::string::npos) {
+    std::cout << "- txt format for magnetic field detected" << std::endl;
+    bfieldmaptype = text;
+  } else if (bfieldmap.find(".bfm") != std::string::npos) {
+    std::cout << "- binary format for magnetic field detected" << std::endl;
+    bfieldmaptype = binary;
+  } else {
+    std::cout << "- magnetic field format could not be detected";
+    std::cout << " use '.root', '.txt', '.csv' or '.bfm'." << std::endl;
+    throw std::runtime_error("Invalid BField options");
+  }
+  if (bfieldmaptype == text && vm.count("bf-gridpoints")) {
+    std::cout << "- number of points set to: "
+              << vm["bf-gridpoints"].template as<size_t>() << std::endl;
+  }
+  double lscalor = 1.;
+  if (vm.count("bf-lscalor")) {
+    lscalor = vm["bf-lscalor"].template as<double>();
+    std::cout << "- length scalor to mm set to: " << lscalor << std::endl;
+  }
+  double bscalor = 1.;
+  if (vm.count("bf-bscalor")) {
+    bscalor = vm["bf-bscalor"].template as<double>();
+    std::cout << "- BField (scalor to/in) Tesla set to: " << bscalor
+              << std::endl;
+  }
+  if (vm["bf-rz"].template as<bool>())
+    std::cout << "- BField map is given in 'rz' coordiantes." << std::endl;
+  else
+    std::cout << "- BField map is given in 'xyz' coordiantes." << std::endl;
+
+  if (vm["bf-foctant"].template as<bool>()) {
+    std::cout
+        << "- Only the first octant/quadrant is given, bField map will be "
+           "symmetrically created for all other octants/quadrants"
+        << std::endl;
+  }
+
+  std::string storage = vm["bf-storage"].template as<std::string>();
+  if (storage != "double" && storage != "float" && storage != "int16") {
+    throw std::invalid_argument("Unknown field map storage '" + storage +
+                                "', use 'double', 'float' or 'int16'.");
+  }
+  if (bfieldmaptype == root || bfieldmaptype == text) {
+    std::cout << "- BField values are stored as " << storage << std::endl;
+  }
+
+  // Declare the mapper
+  double lengthUnit = lscalor * Acts::units::_mm;
+  double BFieldUnit = bscalor * Acts::units::_T;
+
+  // set the mapper - foort
+  if (bfieldmaptype == root || bfieldmaptype == text) {
+    const bool fromRoot = (bfieldmaptype == root);
+    if (storage == "float") {
+      return readFieldMap<float>(vm, fromRoot, lengthUnit, BFieldUnit,
+                                 bscalor);
     }
-    if (vm["bf-context-scalable"].template as<bool>()) {
-      // Create the scalable magnetic field
-      return std::make_shared<FW::BField::ScalableBField>(
-          bFieldValues.at(0) * Acts::units::_T,
-          bFieldValues.at(1) * Acts::units::_T,
-          bFieldValues.at(2) * Acts::units::_T);
-    } else {
-      // Create the constant magnetic field
-      return std::make_shared<Acts::ConstantBField>(
-          bFieldValues.at(0) * Acts::units::_T,
-          bFieldValues.at(1) * Acts::units::_T,
-          bFieldValues.at(2) * Acts::units::_T);
+    if (storage == "int16") {
+      return readFieldMap<int16_t>(vm, fromRoot, lengthUnit, BFieldUnit,
+                                   bscalor);
     }
+    return readFieldMap<double>(vm, fromRoot, lengthUnit, BFieldUnit, bscalor);
+  }
+  // the binary map is stored in Acts units and on its final grid, i.e.
+  // the unit and octant options do not apply
+  if (vm["bf-rz"].template as<bool>()) {
+    auto mapper2D = FW::BField::binary::fieldMapperRZ(
+        vm["bf-map"].template as<std::string>());
+
+    // create field mapping
+    MappedBFieldMap2D::Config config2D(std::move(mapper2D));
+    config2D.scale = bscalor;
+    // create BField service
+    return std::make_shared<MappedBFieldMap2D>(std::move(config2D));
+
+  } else {
+    auto mapper3D = FW::BField::binary::fieldMapperXYZ(
+        vm["bf-map"].template as<std::string>());
+
+    // create field mapping
+    MappedBFieldMap3D::Config config3D(std::move(mapper3D));
+    config3D.scale = bscalor;
+    // create BField service
+    return std::make_shared<MappedBFieldMap3D>(std::move(config3D));
+  }
+}
+
+}  // namespace
+
+namespace FW {
+
+namespace Options {
+
+// common bfield options, with a bf prefix
+void addBFieldOptions(boost::program_options::options_description& opt) {
+  opt.add_options()("bf-map", po::value<std::string>()->default_value(""),
+                    "Set this string to point to the bfield source file."
+                    "That can either be a '.txt', a '.csv', a '.root' or a "
+                    "binary '.bfm' file. "
+                    "Omit for a constant magnetic field.")(
+      "bf-name", po::value<std::string>()->default_value("bField"),
+      "In case your field map file is given in root format, please specify "
+      "the "
+      "name of the TTree.")(
+      "bf-gridpoints", po::value<size_t>()->default_value(100000),
+      "Estimate of number of grid points, "
+      "needed for allocation, only for txt and csv files.")(
+      "bf-lscalor", po::value<double>()->default_value(1.),
+      "The default unit for the grid "
+      "points is mm. In case the grid points of your field map has another "
+      "unit, please set  the scalor to mm.")(
+      "bf-bscalor", po::value<double>()->default_value(1.),
+      "The default unit for the magnetic field values is Tesla. In case the "
+      "grid points of your field map has another unit, please set  the "
+      "scalor "
+      "to [T].")(
+      "bf-rz", po::value<bool>()->default_value(false),
+      "Please set this flag to true, if your grid points and your "
+      "magnetic field values are given in 'rz'. The default is 'xyz'.")(
+      "bf-foctant", po::value<bool>()->default_value(false),
+      "Please set this flag to true, if your field map is only given for the "
+      "first octant/quadrant and should be symmetrically created for all "
+      "other "
+      "octants/quadrants.")(
+      "bf-values",
+      po::value<read_range>()->multitoken()->default_value({0., 0., 0.}),
+      "In case no magnetic field map is handed over. A constant magnetic "
+      "field will be created automatically. The values can be set with this "
+      "options. Please hand over the coordinates in cartesian coordinates: "
+      "{Bx,By,Bz} in Tesla.")(
+      "bf-storage", po::value<std::string>()->default_value("double"),
+      "Precision of the field values stored in a '.root', '.txt' or '.csv' "
+      "field map, either 'double', 'float' or 'int16'. The compact values "
+      "are filled directly; 'float' halves and 'int16', scaled to the "
+      "largest field component, quarters the memory needed by the map.")(
+      "bf-context-scalable", po::value<bool>()->default_value(false),
+      "This is for testing the event dependent magnetic field scaling.");
+}
+
+// whether the field map is only held by the field map variant
+bool useBFieldMap(const boost::program_options::variables_map& vm) {
+  if (not vm.count("bf-map")) {
+    return false;
+  }
+  const auto& bfieldmap = vm["bf-map"].template as<std::string>();
+  if (bfieldmap.empty()) {
+    return false;
+  }
+  return (bfieldmap.find(".bfm") != std::string::npos) or
+         (vm["bf-storage"].template as<std::string>() != "double");
+}
+
+// create the bfield maps
+BFieldVariant readBField(const boost::program_options::variables_map& vm) {
+  if (vm.count("bf-map") && vm["bf-map"].template as<std::string>() != "") {
+    if (useBFieldMap(vm)) {
+      throw std::invalid_argument(
+          "Compact or memory-mapped field maps must be read with "
+          "readBFieldMap or visitBField.");
+    }
+    return std::visit(
+        [](auto&& bField) -> BFieldVariant {
+          using field_type = std::decay_t<decltype(bField)>;
+          if constexpr (std::is_constructible_v<BFieldVariant, field_type>) {
+            return bField;
+          } else {
+            throw std::logic_error("Unexpected field map storage");
+          }
+        },
+        readFieldMapFile(vm));
+  }
+
+  // No bfield map is handed over
+  // get the constant bField values
+  auto bFieldValues = vm["bf-values"].template as<read_range>();
+  if (bFieldValues.size() != 3) {
+    throw std::invalid_argument(
+        "- The values handed over for the constant magnetic field "
+        "have wrong dimension. Needs to have 3 dimension. Please "
+        "hand over the coordinates in cartesian coordinates: "
+        "{Bx,By,Bz} in Tesla.");
+  }
+  if (vm["bf-context-scalable"].template as<bool>()) {
+    // Create the scalable magnetic field
+    return std::make_shared<FW::BField::ScalableBField>(
+        bFieldValues.at(0) * Acts::units::_T,
+        bFieldValues.at(1) * Acts::units::_T,
+        bFieldValues.at(2) * Acts::units::_T);
+  } else {
+    // Create the constant magnetic field
+    return std::make_shared<Acts::ConstantBField>(
+        bFieldValues.at(0) * Acts::units::_T,
+        bFieldValues.at(1) * Acts::units::_T,
+        bFieldValues.at(2) * Acts::units::_T);
+  }
+}
+
+// create the bfield maps with any storage
+BFieldMapVariant readBFieldMap(
+    const boost::program_options::variables_map& vm) {
+  if (not vm.count("bf-map") || vm["bf-map"].template as<std::string>() == "") {
+    throw std::invalid_argument("No magnetic field map given, use --bf-map.");
   }
+  return readFieldMapFile(vm);
 }
 }  // namespace Options
 }  // namespace FW
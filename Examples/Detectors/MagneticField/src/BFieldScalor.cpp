@@ -20,7 +20,7 @@ FW::BField::BFieldScalor::BFieldScalor(
 FW::ProcessCode FW::BField::BFieldScalor::decorate(AlgorithmContext& context) {
   ScalableBFieldContext bFieldContext{
       std::pow(m_cfg.scalor, context.eventNumber)};
-  context.magFieldContext = std::make_any<ScalableBFieldContext>(bFieldContext);
+  context.magFieldContext = bFieldContext;
 
   return ProcessCode::SUCCESS;
 }
@@ -11,17 +11,121 @@
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
+#include "Acts/Utilities/detail/GridView.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "TFile.h"
 #include "TROOT.h"
 #include "TTree.h"
 
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-FW::BField::txt::fieldMapperRZ(
+namespace {
+
+/// Map a binary field map file read-only into memory and check its header.
+///
+/// @return the header and the owner of the mapping
+std::pair<const FW::BField::binary::Header*, std::shared_ptr<const void>>
+mapBinaryFieldMap(const std::string& fieldMapFile, uint32_t dimensions,
+                  uint32_t valueSize) {
+  using FW::BField::binary::Header;
+
+  int fd = ::open(fieldMapFile.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::ios_base::failure("Could not open '" + fieldMapFile + "'");
+  }
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0) {
+    ::close(fd);
+    throw std::ios_base::failure("Could not stat '" + fieldMapFile + "'");
+  }
+  const size_t fileSize = fileStat.st_size;
+  if (fileSize < sizeof(Header)) {
+    ::close(fd);
+    throw std::runtime_error("'" + fieldMapFile +
+                             "' is too small for a binary field map");
+  }
+  // shared, read-only pages can be used by all processes mapping the file
+  void* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    throw std::ios_base::failure("Could not map '" + fieldMapFile + "'");
+  }
+  std::shared_ptr<const void> mapping(address, [fileSize](const void* ptr) {
+    ::munmap(const_cast<void*>(ptr), fileSize);
+  });
+
+  const auto* header = static_cast<const Header*>(address);
+  if (std::memcmp(header->magic.data(), Header::s_magic.data(),
+                  Header::s_magic.size()) != 0) {
+    throw std::runtime_error("'" + fieldMapFile +
+                             "' is not a binary field map");
+  }
+  if (header->version != Header::s_version) {
+    throw std::runtime_error("Unsupported binary field map version " +
+                             std::to_string(header->version));
+  }
+  if (header->byteOrder != Header::s_byteOrder) {
+    throw std::runtime_error("Binary field map '" + fieldMapFile +
+                             "' has a different byte order");
+  }
+  if (header->dimensions != dimensions or header->valueSize != valueSize) {
+    throw std::runtime_error("'" + fieldMapFile + "' does not contain a " +
+                             std::to_string(dimensions) + "D field map");
+  }
+  // avoid overflows for corrupted sizes in the header
+  if (header->dataOffset % Header::s_dataAlignment != 0 or
+      header->dataOffset > fileSize or
+      header->nValues > (fileSize - header->dataOffset) / header->valueSize) {
+    throw std::runtime_error("Binary field map '" + fieldMapFile +
+                             "' is corrupted");
+  }
+  // empty or inverted axes would give a non-finite bin width
+  for (uint32_t i = 0; i < dimensions; ++i) {
+    if (header->nBins[i] == 0 or not std::isfinite(header->min[i]) or
+        not std::isfinite(header->max[i]) or
+        not(header->min[i] < header->max[i])) {
+      throw std::runtime_error("Binary field map '" + fieldMapFile +
+                               "' is corrupted");
+    }
+  }
+  return {header, std::move(mapping)};
+}
+
+/// Create the grid view referring to the mapped field values
+template <typename grid_t, size_t... I>
+grid_t mappedGrid(const FW::BField::binary::Header& header,
+                  std::shared_ptr<const void> mapping,
+                  std::index_sequence<I...> /*indices*/) {
+  using value_t = typename grid_t::value_type;
+  const auto* values = reinterpret_cast<const value_t*>(
+      static_cast<const char*>(mapping.get()) + header.dataOffset);
+  grid_t grid(std::make_tuple(Acts::detail::EquidistantAxis(
+                  header.min[I], header.max[I], header.nBins[I])...),
+              values, std::move(mapping));
+  if (grid.size() != header.nValues) {
+    throw std::runtime_error("Binary field map grid size mismatch");
+  }
+  return grid;
+}
+
+}  // namespace
+
+template <typename scalar_t>
+Acts::CompactBFieldMapperRZ<scalar_t> FW::BField::txt::fieldMapperRZ(
     std::function<size_t(std::array<size_t, 2> binsRZ,
                          std::array<size_t, 2> nBinsRZ)>
         localToGlobalBin,
@@ -55,14 +159,13 @@ FW::BField::txt::fieldMapperRZ(
   }
   map_file.close();
   /// [2] use helper function in core
-  return Acts::fieldMapperRZ(localToGlobalBin, rPos, zPos, bField, lengthUnit,
-                             BFieldUnit, firstQuadrant);
+  return Acts::fieldMapperRZ<scalar_t>(localToGlobalBin, std::move(rPos),
+                                       std::move(zPos), std::move(bField),
+                                       lengthUnit, BFieldUnit, firstQuadrant);
 }
 
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-FW::BField::txt::fieldMapperXYZ(
+template <typename scalar_t>
+Acts::CompactBFieldMapperXYZ<scalar_t> FW::BField::txt::fieldMapperXYZ(
     std::function<size_t(std::array<size_t, 3> binsXYZ,
                          std::array<size_t, 3> nBinsXYZ)>
         localToGlobalBin,
@@ -99,14 +202,13 @@ FW::BField::txt::fieldMapperXYZ(
   }
   map_file.close();
 
-  return Acts::fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bField,
-                              lengthUnit, BFieldUnit, firstOctant);
+  return Acts::fieldMapperXYZ<scalar_t>(
+      localToGlobalBin, std::move(xPos), std::move(yPos), std::move(zPos),
+      std::move(bField), lengthUnit, BFieldUnit, firstOctant);
 }
 
-Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                       Acts::detail::EquidistantAxis>>
-FW::BField::root::fieldMapperRZ(
+template <typename scalar_t>
+Acts::CompactBFieldMapperRZ<scalar_t> FW::BField::root::fieldMapperRZ(
     std::function<size_t(std::array<size_t, 2> binsRZ,
                          std::array<size_t, 2> nBinsRZ)>
         localToGlobalBin,
@@ -145,14 +247,13 @@ FW::BField::root::fieldMapperRZ(
   }
   inputFile->Close();
   /// [2] use helper function in core
-  return Acts::fieldMapperRZ(localToGlobalBin, rPos, zPos, bField, lengthUnit,
-                             BFieldUnit, firstQuadrant);
+  return Acts::fieldMapperRZ<scalar_t>(localToGlobalBin, std::move(rPos),
+                                       std::move(zPos), std::move(bField),
+                                       lengthUnit, BFieldUnit, firstQuadrant);
 }
 
-Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-FW::BField::root::fieldMapperXYZ(
+template <typename scalar_t>
+Acts::CompactBFieldMapperXYZ<scalar_t> FW::BField::root::fieldMapperXYZ(
     std::function<size_t(std::array<size_t, 3> binsXYZ,
                          std::array<size_t, 3> nBinsXYZ)>
         localToGlobalBin,
@@ -196,6 +297,67 @@ FW::BField::root::fieldMapperXYZ(
   }
   inputFile->Close();
 
-  return Acts::fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bField,
-                              lengthUnit, BFieldUnit, firstOctant);
+  return Acts::fieldMapperXYZ<scalar_t>(
+      localToGlobalBin, std::move(xPos), std::move(yPos), std::move(zPos),
+      std::move(bField), lengthUnit, BFieldUnit, firstOctant);
+}
+
+// the storage types supported by the examples
+template Acts::CompactBFieldMapperRZ<double> FW::BField::txt::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperRZ<float> FW::BField::txt::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperRZ<int16_t> FW::BField::txt::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperXYZ<double> FW::BField::txt::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperXYZ<float> FW::BField::txt::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperXYZ<int16_t> FW::BField::txt::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, double, double, size_t, bool);
+template Acts::CompactBFieldMapperRZ<double> FW::BField::root::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, std::string, double, double, bool);
+template Acts::CompactBFieldMapperRZ<float> FW::BField::root::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, std::string, double, double, bool);
+template Acts::CompactBFieldMapperRZ<int16_t> FW::BField::root::fieldMapperRZ(
+    std::function<size_t(std::array<size_t, 2>, std::array<size_t, 2>)>,
+    std::string, std::string, double, double, bool);
+template Acts::CompactBFieldMapperXYZ<double> FW::BField::root::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, std::string, double, double, bool);
+template Acts::CompactBFieldMapperXYZ<float> FW::BField::root::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, std::string, double, double, bool);
+template Acts::CompactBFieldMapperXYZ<int16_t> FW::BField::root::fieldMapperXYZ(
+    std::function<size_t(std::array<size_t, 3>, std::array<size_t, 3>)>,
+    std::string, std::string, double, double, bool);
+
+FW::BField::binary::MappedBFieldMapperRZ FW::BField::binary::fieldMapperRZ(
+    const std::string& fieldMapFile) {
+  using Grid_t = MappedBFieldMapperRZ::Grid_t;
+  auto [header, mapping] =
+      mapBinaryFieldMap(fieldMapFile, 2, sizeof(Grid_t::value_type));
+  auto grid = mappedGrid<Grid_t>(*header, std::move(mapping),
+                                 std::make_index_sequence<2>());
+  return MappedBFieldMapperRZ(Acts::RZPositionTransform(),
+                              Acts::RZFieldTransform(), std::move(grid));
+}
+
+FW::BField::binary::MappedBFieldMapperXYZ FW::BField::binary::fieldMapperXYZ(
+    const std::string& fieldMapFile) {
+  using Grid_t = MappedBFieldMapperXYZ::Grid_t;
+  auto [header, mapping] =
+      mapBinaryFieldMap(fieldMapFile, 3, sizeof(Grid_t::value_type));
+  auto grid = mappedGrid<Grid_t>(*header, std::move(mapping),
+                                 std::make_index_sequence<3>());
+  return MappedBFieldMapperXYZ(Acts::XYZPositionTransform(),
+                               Acts::XYZFieldTransform(), std::move(grid));
 }
@@ -14,10 +14,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <utility>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
 
 namespace FW {
 namespace detail {
@@ -59,6 +61,7 @@ struct CompareGeometryId {
 /// Store elements that know their detector geometry id, e.g. simulation hits.
 ///
 /// @tparam T type to be stored, must be compatible with `CompareGeometryId`
+/// @tparam Allocator allocator of the underlying sorted sequence
 ///
 /// The container stores an arbitrary number of elements for any geometry
 /// id. Elements can be retrieved via the geometry id; elements can be selected
@@ -66,9 +69,9 @@ struct CompareGeometryId {
 /// within the geometry hierachy using the helper functions below. Elements can
 /// also be accessed by index that uniquely identifies each element regardless
 /// of geometry id.
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 using GeometryIdMultiset =
-    boost::container::flat_multiset<T, detail::CompareGeometryId>;
+    boost::container::flat_multiset<T, detail::CompareGeometryId, Allocator>;
 
 /// Store elements indexed by an geometry id.
 ///
@@ -86,10 +89,22 @@ using GeometryIdMultiset =
 template <typename T>
 using GeometryIdMultimap = GeometryIdMultiset<std::pair<Acts::GeometryID, T>>;
 
-/// Select all elements within the given volume.
+namespace pmr {
+/// Geometry id containers using a polymorphic memory resource, e.g. the
+/// memory resource of the event store.
+template <typename T>
+using GeometryIdMultiset =
+    FW::GeometryIdMultiset<T,
+                           boost::container::pmr::polymorphic_allocator<T>>;
 template <typename T>
-inline Range<typename GeometryIdMultiset<T>::const_iterator> selectVolume(
-    const GeometryIdMultiset<T>& container, Acts::GeometryID::Value volume) {
+using GeometryIdMultimap = GeometryIdMultiset<std::pair<Acts::GeometryID, T>>;
+}  // namespace pmr
+
+/// Select all elements within the given volume.
+template <typename T, typename Allocator>
+inline Range<typename GeometryIdMultiset<T, Allocator>::const_iterator>
+selectVolume(const GeometryIdMultiset<T, Allocator>& container,
+             Acts::GeometryID::Value volume) {
   auto cmp = Acts::GeometryID().setVolume(volume);
   auto beg = std::lower_bound(container.begin(), container.end(), cmp,
                               detail::CompareGeometryId{});
@@ -102,17 +117,17 @@ inline Range<typename GeometryIdMultiset<T>::const_iterator> selectVolume(
       std::lower_bound(beg, container.end(), cmp, detail::CompareGeometryId{});
   return makeRange(beg, end);
 }
-template <typename T>
-inline auto selectVolume(const GeometryIdMultiset<T>& container,
+template <typename T, typename Allocator>
+inline auto selectVolume(const GeometryIdMultiset<T, Allocator>& container,
                          Acts::GeometryID id) {
   return selectVolume(container, id.volume());
 }
 
 /// Select all elements within the given layer.
-template <typename T>
-inline Range<typename GeometryIdMultiset<T>::const_iterator> selectLayer(
-    const GeometryIdMultiset<T>& container, Acts::GeometryID::Value volume,
-    Acts::GeometryID::Value layer) {
+template <typename T, typename Allocator>
+inline Range<typename GeometryIdMultiset<T, Allocator>::const_iterator>
+selectLayer(const GeometryIdMultiset<T, Allocator>& container,
+            Acts::GeometryID::Value volume, Acts::GeometryID::Value layer) {
   auto cmp = Acts::GeometryID().setVolume(volume).setLayer(layer);
   auto beg = std::lower_bound(container.begin(), container.end(), cmp,
                               detail::CompareGeometryId{});
@@ -125,21 +140,22 @@ inline Range<typename GeometryIdMultiset<T>::const_iterator> selectLayer(
       std::lower_bound(beg, container.end(), cmp, detail::CompareGeometryId{});
   return makeRange(beg, end);
 }
-template <typename T>
-inline auto selectLayer(const GeometryIdMultiset<T>& container,
+template <typename T, typename Allocator>
+inline auto selectLayer(const GeometryIdMultiset<T, Allocator>& container,
                         Acts::GeometryID id) {
   return selectLayer(container, id.volume(), id.layer());
 }
 
 /// Select all elements for the given module / sensitive surface.
-template <typename T>
-inline Range<typename GeometryIdMultiset<T>::const_iterator> selectModule(
-    const GeometryIdMultiset<T>& container, Acts::GeometryID geoId) {
+template <typename T, typename Allocator>
+inline Range<typename GeometryIdMultiset<T, Allocator>::const_iterator>
+selectModule(const GeometryIdMultiset<T, Allocator>& container,
+             Acts::GeometryID geoId) {
   // module is the lowest level and defines a single geometry id value
   return makeRange(container.equal_range(geoId));
 }
-template <typename T>
-inline auto selectModule(const GeometryIdMultiset<T>& container,
+template <typename T, typename Allocator>
+inline auto selectModule(const GeometryIdMultiset<T, Allocator>& container,
                          Acts::GeometryID::Value volume,
                          Acts::GeometryID::Value layer,
                          Acts::GeometryID::Value module) {
@@ -150,10 +166,10 @@ inline auto selectModule(const GeometryIdMultiset<T>& container,
 }
 
 /// Iterate over groups of elements belonging to each module/ sensitive surface.
-template <typename T>
-inline GroupBy<typename GeometryIdMultiset<T>::const_iterator,
+template <typename T, typename Allocator>
+inline GroupBy<typename GeometryIdMultiset<T, Allocator>::const_iterator,
                detail::GeometryIdGetter>
-groupByModule(const GeometryIdMultiset<T>& container) {
+groupByModule(const GeometryIdMultiset<T, Allocator>& container) {
   return makeGroupBy(container, detail::GeometryIdGetter());
 }
 
@@ -11,6 +11,8 @@
 #include <cstddef>
 #include <vector>
 
+#include <boost/container/pmr/vector.hpp>
+
 namespace FW {
 
 /// A proto track is a collection of hits identified by their indices.
@@ -18,4 +20,12 @@ using ProtoTrack = std::vector<size_t>;
 /// Container of proto tracks. Each proto track is identified by its index.
 using ProtoTrackContainer = std::vector<ProtoTrack>;
 
+namespace pmr {
+/// A proto track using a memory resource.
+using ProtoTrack = boost::container::pmr::vector<size_t>;
+/// Container of proto tracks using a memory resource, which is also used
+/// for the contained proto tracks.
+using ProtoTrackContainer = boost::container::pmr::vector<ProtoTrack>;
+}  // namespace pmr
+
 }  // namespace FW
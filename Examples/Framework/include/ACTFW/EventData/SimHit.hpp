@@ -17,4 +17,9 @@ using SimHit = ::ActsFatras::Hit;
 /// Store hits ordered by geometry identifier.
 using SimHitContainer = GeometryIdMultiset<::ActsFatras::Hit>;
 
+namespace pmr {
+/// Store hits ordered by geometry identifier using a memory resource.
+using SimHitContainer = GeometryIdMultiset<::ActsFatras::Hit>;
+}  // namespace pmr
+
 }  // end of namespace FW
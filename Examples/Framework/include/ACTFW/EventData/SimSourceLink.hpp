@@ -82,4 +82,9 @@ class SimSourceLink {
 /// Store source links ordered by geometry identifier.
 using SimSourceLinkContainer = GeometryIdMultiset<SimSourceLink>;
 
+namespace pmr {
+/// Store source links ordered by geometry identifier using a memory resource.
+using SimSourceLinkContainer = GeometryIdMultiset<SimSourceLink>;
+}  // namespace pmr
+
 }  // end of namespace FW
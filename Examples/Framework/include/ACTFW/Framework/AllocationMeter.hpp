@@ -0,0 +1,60 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+
+namespace FW {
+
+/// Allocations through the global operator new on one thread.
+///
+/// Sizes are the usable sizes of the blocks returned by malloc, i.e. they
+/// can be slightly larger than the requested sizes.
+struct AllocationCount {
+  /// Number of calls to operator new
+  uint64_t allocations = 0;
+  /// Number of allocated bytes
+  uint64_t allocatedBytes = 0;
+  /// Allocated minus freed bytes, negative if more memory was freed
+  int64_t netBytes = 0;
+  /// Maximum of the net bytes at any time
+  int64_t peakBytes = 0;
+};
+
+/// Whether allocations are counted.
+///
+/// The framework library replaces the global operator new and delete to
+/// count allocations only if Acts is configured with ACTS_ENABLE_TRACING.
+/// All counts are zero otherwise.
+bool isAllocationCountingEnabled();
+
+/// @brief Count the allocations of the calling thread during its lifetime
+///
+/// Only allocations and deallocations on the calling thread are counted,
+/// e.g. not the ones of tasks that the measured code runs on other threads.
+/// Meters can be nested on the same thread but must be destroyed in the
+/// reverse order of their construction. The allocations of an inner meter
+/// are also counted by the outer one.
+class AllocationMeter {
+ public:
+  AllocationMeter();
+  AllocationMeter(const AllocationMeter&) = delete;
+  AllocationMeter& operator=(const AllocationMeter&) = delete;
+  ~AllocationMeter();
+
+  /// The allocations since construction
+  AllocationCount count() const;
+
+ private:
+  AllocationCount m_start;
+  /// Peak bytes of the enclosing scope, restored on destruction
+  int64_t m_outerPeakBytes;
+};
+
+}  // namespace FW
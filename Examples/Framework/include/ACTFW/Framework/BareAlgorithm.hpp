@@ -16,10 +16,12 @@
 
 #include "ACTFW/Framework/IAlgorithm.hpp"
 #include "ACTFW/Framework/ProcessCode.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace FW {
 
@@ -46,12 +48,63 @@ class BareAlgorithm : public IAlgorithm {
   virtual ProcessCode execute(
       const AlgorithmContext& context) const override = 0;
 
+  /// The event store objects read by the algorithm.
+  std::vector<std::string> inputs() const override;
+
+  /// The event store objects written by the algorithm.
+  std::vector<std::string> outputs() const override;
+
+  /// Resolve the handles declared as inputs or outputs.
+  void resolveHandles(WhiteBoardRegistry& registry) override;
+
  protected:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Declare an event store object read by the algorithm.
+  ///
+  /// @param key The object name, ignored if empty
+  void declareInput(const std::string& key);
+
+  /// Declare an event store object written by the algorithm.
+  ///
+  /// @param key The object name, ignored if empty
+  void declareOutput(const std::string& key);
+
+  /// Set up a handle and declare its event store object as an input.
+  ///
+  /// The handle is resolved by the sequencer before the event loop.
+  ///
+  /// @param handle The handle, which must be a member of the algorithm
+  /// @param key The object name
+  /// @throws std::invalid_argument on empty key
+  template <typename T>
+  void declareInput(ReadHandle<T>& handle, const std::string& key) {
+    handle = ReadHandle<T>(key);
+    m_handles.push_back(&handle);
+    declareInput(key);
+  }
+
+  /// Set up a handle and declare its event store object as an output.
+  ///
+  /// The handle is resolved by the sequencer before the event loop.
+  ///
+  /// @param handle The handle, which must be a member of the algorithm
+  /// @param key The object name
+  /// @throws std::invalid_argument on empty key
+  template <typename T>
+  void declareOutput(WriteHandle<T>& handle, const std::string& key) {
+    handle = WriteHandle<T>(key);
+    m_handles.push_back(&handle);
+    declareOutput(key);
+  }
+
  private:
   std::string m_name;
   std::unique_ptr<const Acts::Logger> m_logger;
+  std::vector<std::string> m_inputs;
+  std::vector<std::string> m_outputs;
+  // declared handles, members of the derived algorithm
+  std::vector<DataHandleBase*> m_handles;
 };
 
 }  // namespace FW
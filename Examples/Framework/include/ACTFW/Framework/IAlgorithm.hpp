@@ -12,9 +12,12 @@
 #include "ACTFW/Framework/ProcessCode.hpp"
 
 #include <string>
+#include <vector>
 
 namespace FW {
 
+class WhiteBoardRegistry;
+
 /// Event processing algorithm interface.
 ///
 /// An algorithm must have no internal state and can communicate to the
@@ -28,6 +31,26 @@ class IAlgorithm {
 
   /// Execute the algorithm for one event.
   virtual ProcessCode execute(const AlgorithmContext& context) const = 0;
+
+  /// The event store objects read by the algorithm.
+  ///
+  /// The sequencer runs algorithms of the same event in parallel if they do
+  /// not depend on each others outputs. An algorithm that declares neither
+  /// inputs nor outputs runs after all preceding and before all following
+  /// algorithms.
+  virtual std::vector<std::string> inputs() const { return {}; }
+
+  /// The event store objects written by the algorithm.
+  virtual std::vector<std::string> outputs() const { return {}; }
+
+  /// Resolve the data handles of the algorithm.
+  ///
+  /// Called by the sequencer before the event loop, such that objects used
+  /// with different types are detected before any event is processed.
+  ///
+  /// @param registry The object registry of the sequencer
+  /// @throws std::invalid_argument if an object is used with different types
+  virtual void resolveHandles(WhiteBoardRegistry& /*registry*/) {}
 };
 
 }  // namespace FW
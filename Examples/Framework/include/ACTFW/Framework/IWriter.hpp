@@ -16,9 +16,12 @@
 #include "ACTFW/Framework/ProcessCode.hpp"
 
 #include <string>
+#include <vector>
 
 namespace FW {
 
+class WhiteBoardRegistry;
+
 /// Event data writer interface.
 ///
 /// Get data from the event store and write it to disk. The writer can have
@@ -36,6 +39,20 @@ class IWriter {
 
   /// End the run (e.g. aggregate statistics, write down output, close files).
   virtual ProcessCode endRun() = 0;
+
+  /// The event store objects read by the writer.
+  ///
+  /// A writer that declares no inputs runs after all algorithms.
+  virtual std::vector<std::string> inputs() const { return {}; }
+
+  /// Resolve the data handles of the writer.
+  ///
+  /// Called by the sequencer before the event loop, such that objects used
+  /// with different types are detected before any event is processed.
+  ///
+  /// @param registry The object registry of the sequencer
+  /// @throws std::invalid_argument if an object is used with different types
+  virtual void resolveHandles(WhiteBoardRegistry& /*registry*/) {}
 };
 
 }  // namespace FW
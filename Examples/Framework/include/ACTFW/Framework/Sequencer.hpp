@@ -13,6 +13,7 @@
 #include "ACTFW/Framework/IReader.hpp"
 #include "ACTFW/Framework/IService.hpp"
 #include "ACTFW/Framework/IWriter.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <cstddef>
@@ -39,8 +40,16 @@ class Sequencer {
     Acts::Logging::Level logLevel = Acts::Logging::INFO;
     /// number of parallel threads to run, negative for automatic determination
     int numThreads = -1;
+    /// maximum number of events in flight for pipelined processing, where
+    /// events are read and written in order by one thread at a time while
+    /// the algorithms of different events run in parallel. 0 to process
+    /// each event completely within one task instead.
+    size_t eventsInFlight = 0;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// write the spans of all algorithms per event and of the core tracing
+    /// markers to a Chrome trace file in the output directory
+    bool traceEvents = false;
   };
 
   Sequencer(const Config& cfg);
@@ -92,6 +101,21 @@ class Sequencer {
   /// This will run the start-of-run hook for all configured services, run all
   /// configured readers, algorithms, and writers for each event, then invoke
   /// the end-of-run hook for all configured writers.
+  ///
+  /// Within one event, algorithms and writers run as soon as the algorithms
+  /// writing their declared inputs have finished. Independent algorithms
+  /// and writers of the same event can thus run in parallel. If pipelining
+  /// is enabled via `Config::eventsInFlight`, the writers instead run one
+  /// after the other once all algorithms of the event have finished. The run
+  /// fails before any event is processed if a declared input has no
+  /// producer, or if the data handles use an object with different types.
+  ///
+  /// The total and per-event percentile times and allocations of all
+  /// algorithms are written to `timing.tsv`, and with `Config::traceEvents`
+  /// also all individual spans to `timing_trace.json`, which can be opened
+  /// with `chrome://tracing` or Perfetto. Allocations are only counted if
+  /// Acts is configured with ACTS_ENABLE_TRACING, see `AllocationMeter`, and
+  /// only include the ones on the thread executing the algorithm.
   int run();
 
  private:
@@ -99,6 +123,19 @@ class Sequencer {
   std::vector<std::string> listAlgorithmNames() const;
   /// Determine range of (requested) events; [SIZE_MAX, SIZE_MAX) for error.
   std::pair<size_t, size_t> determineEventsRange() const;
+  /// Determine which algorithms and writers must finish before each one runs.
+  ///
+  /// Algorithms and writers are numbered together, algorithms first, both in
+  /// the order they were added.
+  ///
+  /// @throws std::invalid_argument if an input is only written by a
+  ///         following algorithm, or if no reader, service, or preceding
+  ///         algorithm can write it
+  std::vector<std::vector<size_t>> determineDependencies() const;
+  /// Register the declared objects and resolve all data handles.
+  ///
+  /// @throws std::invalid_argument if an object is used with different types
+  void resolveHandles();
 
   Config m_cfg;
   std::vector<std::shared_ptr<IService>> m_services;
@@ -106,6 +143,8 @@ class Sequencer {
   std::vector<std::shared_ptr<IReader>> m_readers;
   std::vector<std::shared_ptr<IAlgorithm>> m_algorithms;
   std::vector<std::shared_ptr<IWriter>> m_writers;
+  /// Object names and types of the event stores of this sequencer
+  WhiteBoardRegistry m_registry;
   std::unique_ptr<const Acts::Logger> m_logger;
 
   const Acts::Logger& logger() const { return *m_logger; }
@@ -8,28 +8,159 @@
 
 #pragma once
 
+#include "ACTFW/Framework/AlgorithmContext.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+
 namespace FW {
 
+/// Mapping of object names to dense white board slots.
+///
+/// Every name is assigned a fixed slot index the first time it is used, either
+/// by a data handle or by the string-based white board access. Data handles
+/// and added objects also register the object type, so that handles and
+/// objects that use the same name with different types are detected.
+///
+/// The sequencer owns one registry, resolves the data handles of its
+/// algorithms and writers against it before the event loop, and passes it to
+/// the white board of each event. Names that are first used during the event
+/// loop, e.g. by readers, are registered on first use.
+class WhiteBoardRegistry {
+ public:
+  WhiteBoardRegistry() = default;
+  WhiteBoardRegistry(const WhiteBoardRegistry&) = delete;
+  WhiteBoardRegistry& operator=(const WhiteBoardRegistry&) = delete;
+
+  /// Get the slot index of an object name, registering it if necessary.
+  ///
+  /// @param name Non-empty identifier of the object
+  /// @param type The object type, nullptr if unknown
+  /// @throws std::invalid_argument on empty name or type mismatch
+  size_t slot(const std::string& name, const std::type_info* type = nullptr);
+
+  /// Get the slot index of an already registered object name.
+  ///
+  /// @param name Identifier of the object
+  /// @return The slot index or SIZE_MAX if the name is not registered
+  /// @note Unknown names are not registered, e.g. to not grow the registry
+  ///       when reading objects that do not exist.
+  size_t find(const std::string& name) const;
+
+  /// Get the type of an object registered for a slot.
+  ///
+  /// @param slot The slot index
+  /// @return The object type or nullptr if no type is registered
+  const std::type_info* type(size_t slot) const;
+
+  /// Register the type of the object stored in a slot.
+  ///
+  /// @param slot The slot index
+  /// @param name Identifier of the object for the error message
+  /// @param type The object type
+  /// @throws std::invalid_argument if another type is registered
+  void requireType(size_t slot, const std::string& name,
+                   const std::type_info& type);
+
+  /// The number of registered names.
+  size_t size() const;
+
+ private:
+  std::unordered_map<std::string, size_t> m_slots;
+  // type registered by the data handles or the added objects for each slot
+  std::vector<const std::type_info*> m_types;
+  mutable std::shared_mutex m_mutex;
+};
+
+/// Name, type, and white board slot of an object accessed by a data handle.
+class DataHandleBase {
+ public:
+  const std::string& name() const { return m_name; }
+  /// The slot index, SIZE_MAX if the handle is not resolved.
+  size_t slot() const { return m_slot; }
+
+  /// Resolve the white board slot of the object.
+  ///
+  /// @param registry The registry of the white boards the handle is used with
+  /// @throws std::invalid_argument on empty name or if the name is used with
+  ///         a different type
+  void resolve(WhiteBoardRegistry& registry) {
+    m_slot = registry.slot(m_name, m_type);
+  }
+
+ protected:
+  DataHandleBase() = default;
+  /// @param name Non-empty identifier of the object
+  /// @param type The object type
+  /// @throws std::invalid_argument on empty name
+  DataHandleBase(const std::string& name, const std::type_info& type)
+      : m_name(name), m_type(&type) {
+    if (m_name.empty()) {
+      throw std::invalid_argument("Object can not have an empty name");
+    }
+  }
+
+ private:
+  std::string m_name;
+  const std::type_info* m_type = nullptr;
+  size_t m_slot = SIZE_MAX;
+};
+
+template <typename T>
+class ReadHandle;
+template <typename T>
+class WriteHandle;
+
 /// A container to store arbitrary objects with ownership transfer.
 ///
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
-/// Its lifetime is bound to the liftime of the white board.
+/// Its lifetime is bound to the liftime of the white board. Objects can be
+/// added and read concurrently by the algorithms of one event.
+///
+/// Objects are stored in a flat array indexed by the slots of the
+/// `WhiteBoardRegistry`, sized for all names registered when the white board
+/// is created. Access via `ReadHandle`/`WriteHandle` uses the slot index
+/// resolved by the sequencer before the event loop directly and reads it
+/// without a lock, while access by name or via unresolved handles needs to
+/// look up the slot first. The object type is
+/// checked against the type registered for the slot once when the object is
+/// added, such that reads via handles need no type check.
+///
+/// The white board owns a monotonic memory arena for the event. It holds the
+/// stored values and can be used by algorithms for the memory of the objects
+/// they store, e.g. via the `pmr` container variants. The arena memory is
+/// released all at once when the white board is destroyed at the end of the
+/// event, i.e. every event allocates its memory anew.
 class WhiteBoard {
  public:
+  /// Construct a white board with its own registry, e.g. for tests.
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                  Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO));
+  /// Construct a white board using the slots of a registry.
+  ///
+  /// @param registry The registry, e.g. of the sequencer, which must outlive
+  ///                 the white board
+  WhiteBoard(WhiteBoardRegistry& registry,
+             std::unique_ptr<const Acts::Logger> logger =
+                 Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO));
+  ~WhiteBoard();
 
   // A WhiteBoard holds unique elements and can not be copied
   WhiteBoard(const WhiteBoard& other) = delete;
@@ -39,10 +170,20 @@ class WhiteBoard {
   ///
   /// @param name Non-empty identifier to store it under
   /// @param object Movable reference to the transferable object
-  /// @throws std::invalid_argument on empty or duplicate name
+  /// @throws std::invalid_argument on empty or duplicate name or if the name
+  ///         is registered with a different type
   template <typename T>
   void add(const std::string& name, T&& object);
 
+  /// Store an object on the white board and transfer ownership.
+  ///
+  /// @param handle Handle of the object, resolved with the registry of the
+  ///               white board or unresolved
+  /// @param object Movable reference to the transferable object
+  /// @throws std::invalid_argument on empty handle or duplicate object
+  template <typename T>
+  void add(const WriteHandle<T>& handle, T&& object);
+
   /// Get access to a stored object.
   ///
   /// @param[in] name Identifier for the object
@@ -51,11 +192,56 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Get access to a stored object.
+  ///
+  /// @param[in] handle Handle of the object, resolved with the registry of
+  ///                   the white board or unresolved
+  /// @return reference to the stored object
+  /// @throws std::out_of_range if no object is stored for the handle
+  template <typename T>
+  const T& get(const ReadHandle<T>& handle) const;
+
+  /// The memory resource of the event.
+  ///
+  /// It can be used concurrently and must only be used for objects that do
+  /// not outlive the white board, e.g. objects stored on it. Deallocation
+  /// does not free any memory, containers should thus be reserved upfront
+  /// where possible instead of growing repeatedly.
+  boost::container::pmr::memory_resource* memoryResource() { return &m_arena; }
+
  private:
-  // type-erased value holder for move-constructible types
+  // monotonic memory resource that can be used concurrently
+  //
+  // Each thread allocates from its own monotonic buffer, so allocations only
+  // need to be synchronized when a thread uses the arena for the first time.
+  class Arena final : public boost::container::pmr::memory_resource {
+   public:
+    Arena();
+
+   private:
+    // unique identifier, arenas can reuse the address of destroyed ones
+    uint64_t m_id;
+    // guards the buffers only
+    std::mutex m_mutex;
+    std::unordered_map<
+        std::thread::id,
+        std::unique_ptr<boost::container::pmr::monotonic_buffer_resource>>
+        m_buffers;
+
+    boost::container::pmr::memory_resource& buffer();
+    void* do_allocate(size_t bytes, size_t alignment) final override;
+    void do_deallocate(void* /*p*/, size_t /*bytes*/,
+                       size_t /*alignment*/) final override {}
+    bool do_is_equal(const boost::container::pmr::memory_resource& other) const
+        noexcept final override {
+      return this == &other;
+    }
+  };
+
+  // type-erased value holder for move-constructible types, the type is
+  // given by the registry
   struct IHolder {
     virtual ~IHolder() = default;
-    virtual const std::type_info& type() const = 0;
   };
   template <typename T,
             typename =
@@ -64,42 +250,186 @@ class WhiteBoard {
     T value;
 
     HolderT(T&& v) : value(std::move(v)) {}
-    const std::type_info& type() const { return typeid(T); }
   };
 
+  template <typename T>
+  void addToSlot(size_t slot, const std::string& name, T&& object);
+  template <typename T>
+  const T& getFromSlot(size_t slot, const std::string& name) const;
+  const IHolder* findHolder(size_t slot) const;
+
   std::unique_ptr<const Acts::Logger> m_logger;
-  std::unordered_map<std::string, std::unique_ptr<IHolder>> m_store;
+  // registry of a white board that is used on its own
+  std::unique_ptr<WhiteBoardRegistry> m_ownRegistry;
+  WhiteBoardRegistry* m_registry;
+  // memory of the holders and the event objects, released with the board
+  Arena m_arena;
+  // holder for each slot registered at construction, nullptr if empty
+  std::vector<std::atomic<IHolder*>> m_slots;
+  // holders for slots registered after construction
+  std::unordered_map<size_t, IHolder*> m_lateSlots;
+  // serializes adding objects and guards the late slots
+  mutable std::mutex m_storeMutex;
 
   const Acts::Logger& logger() const { return *m_logger; }
 };
 
+/// Typed access to an object read from the white board.
+///
+/// The sequencer resolves the object name to its white board slot once
+/// before the event loop instead of for every event. A resolved handle must
+/// only be used with the white boards of the same registry.
+template <typename T>
+class ReadHandle : public DataHandleBase {
+ public:
+  /// Construct an empty handle.
+  ReadHandle() = default;
+  /// @param name Non-empty identifier of the object
+  /// @throws std::invalid_argument on empty name
+  explicit ReadHandle(const std::string& name)
+      : DataHandleBase(name, typeid(T)) {}
+
+  /// Get the object from the event store of the context.
+  const T& operator()(const AlgorithmContext& context) const {
+    return context.eventStore.get(*this);
+  }
+};
+
+/// Typed access to an object written to the white board.
+///
+/// The sequencer resolves the object name to its white board slot once
+/// before the event loop instead of for every event. A resolved handle must
+/// only be used with the white boards of the same registry.
+template <typename T>
+class WriteHandle : public DataHandleBase {
+ public:
+  /// Construct an empty handle.
+  WriteHandle() = default;
+  /// @param name Non-empty identifier of the object
+  /// @throws std::invalid_argument on empty name
+  explicit WriteHandle(const std::string& name)
+      : DataHandleBase(name, typeid(T)) {}
+
+  /// Add the object to the event store of the context.
+  void operator()(const AlgorithmContext& context, T&& object) const {
+    context.eventStore.add(*this, std::move(object));
+  }
+};
+
 }  // namespace FW
 
 inline FW::WhiteBoard::WhiteBoard(std::unique_ptr<const Acts::Logger> logger)
-    : m_logger(std::move(logger)) {}
+    : m_logger(std::move(logger)),
+      m_ownRegistry(std::make_unique<WhiteBoardRegistry>()),
+      m_registry(m_ownRegistry.get()) {}
+
+inline FW::WhiteBoard::WhiteBoard(WhiteBoardRegistry& registry,
+                                  std::unique_ptr<const Acts::Logger> logger)
+    : m_logger(std::move(logger)),
+      m_registry(&registry),
+      m_slots(registry.size()) {
+  for (auto& slot : m_slots) {
+    slot.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+inline FW::WhiteBoard::~WhiteBoard() {
+  // the arena only releases the memory
+  for (auto& slot : m_slots) {
+    IHolder* holder = slot.load(std::memory_order_relaxed);
+    if (holder != nullptr) {
+      holder->~IHolder();
+    }
+  }
+  for (auto& [slot, holder] : m_lateSlots) {
+    holder->~IHolder();
+  }
+}
 
 template <typename T>
 inline void FW::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (0 < m_store.count(name)) {
+  addToSlot(m_registry->slot(name), name, std::forward<T>(object));
+}
+
+template <typename T>
+inline void FW::WhiteBoard::add(const WriteHandle<T>& handle, T&& object) {
+  if (handle.name().empty()) {
+    throw std::invalid_argument("Object can not be added by an empty handle");
+  }
+  // unresolved handles, e.g. outside of a sequencer, look up the slot
+  const size_t slot = (handle.slot() != SIZE_MAX)
+                          ? handle.slot()
+                          : m_registry->slot(handle.name(), &typeid(T));
+  addToSlot(slot, handle.name(), std::move(object));
+}
+
+template <typename T>
+inline void FW::WhiteBoard::addToSlot(size_t slot, const std::string& name,
+                                      T&& object) {
+  // the only type check, all reads rely on the registered type
+  m_registry->requireType(slot, name, typeid(T));
+  std::lock_guard<std::mutex> lock(m_storeMutex);
+  const bool exists = (slot < m_slots.size())
+                          ? (m_slots[slot].load(std::memory_order_relaxed) !=
+                             nullptr)
+                          : (m_lateSlots.count(slot) != 0u);
+  if (exists) {
     throw std::invalid_argument("Object '" + name + "' already exists");
   }
-  m_store.emplace(name, std::make_unique<HolderT<T>>(std::forward<T>(object)));
+  using Holder = HolderT<T>;
+  boost::container::pmr::polymorphic_allocator<Holder> allocator(&m_arena);
+  Holder* holder = allocator.allocate(1);
+  new (holder) Holder(std::forward<T>(object));
+  if (slot < m_slots.size()) {
+    // publish the constructed object to lock-free readers
+    m_slots[slot].store(holder, std::memory_order_release);
+  } else {
+    m_lateSlots.emplace(slot, holder);
+  }
   ACTS_VERBOSE("Added object '" << name << "'");
 }
 
 template <typename T>
 inline const T& FW::WhiteBoard::get(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
-    throw std::out_of_range("Object '" + name + "' does not exists");
-  }
-  const IHolder* holder = it->second.get();
-  if (typeid(T) != holder->type()) {
+  size_t slot = m_registry->find(name);
+  // unlike handles, names do not guarantee the type
+  if (slot != SIZE_MAX and findHolder(slot) != nullptr and
+      typeid(T) != *m_registry->type(slot)) {
     throw std::out_of_range("Type missmatch for object '" + name + "'");
   }
+  return getFromSlot<T>(slot, name);
+}
+
+template <typename T>
+inline const T& FW::WhiteBoard::get(const ReadHandle<T>& handle) const {
+  if (handle.slot() == SIZE_MAX) {
+    // unresolved handles, e.g. outside of a sequencer, behave like names
+    return get<T>(handle.name());
+  }
+  return getFromSlot<T>(handle.slot(), handle.name());
+}
+
+template <typename T>
+inline const T& FW::WhiteBoard::getFromSlot(size_t slot,
+                                            const std::string& name) const {
+  const IHolder* found = findHolder(slot);
+  if (found == nullptr) {
+    throw std::out_of_range("Object '" + name + "' does not exists");
+  }
   ACTS_VERBOSE("Retrieved object '" << name << "'");
-  return reinterpret_cast<const HolderT<T>*>(holder)->value;
+  return static_cast<const HolderT<T>*>(found)->value;
+}
+
+inline const FW::WhiteBoard::IHolder* FW::WhiteBoard::findHolder(
+    size_t slot) const {
+  if (slot < m_slots.size()) {
+    return m_slots[slot].load(std::memory_order_acquire);
+  }
+  // only names registered during the event end up here
+  std::lock_guard<std::mutex> lock(m_storeMutex);
+  auto it = m_lateSlots.find(slot);
+  return (it != m_lateSlots.end()) ? it->second : nullptr;
 }
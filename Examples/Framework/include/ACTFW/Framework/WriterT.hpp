@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace FW {
 
@@ -54,6 +55,12 @@ class WriterT : public IWriter {
   /// No-op default implementation.
   ProcessCode endRun() override;
 
+  /// The written object and any other declared inputs.
+  std::vector<std::string> inputs() const override;
+
+  /// Resolve the handles of the written object and the declared inputs.
+  void resolveHandles(WhiteBoardRegistry& registry) override;
+
  protected:
   /// Type-specific write function implementation
   /// this method is implemented in the user implementation
@@ -65,10 +72,33 @@ class WriterT : public IWriter {
 
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Declare an additional event store object read by the writer.
+  ///
+  /// @param key The object name, ignored if empty
+  void declareInput(const std::string& key);
+
+  /// Set up a handle and declare its event store object as an input.
+  ///
+  /// The handle is resolved by the sequencer before the event loop.
+  ///
+  /// @param handle The handle, which must be a member of the writer
+  /// @param key The object name
+  /// @throws std::invalid_argument on empty key
+  template <typename T>
+  void declareInput(ReadHandle<T>& handle, const std::string& key) {
+    handle = ReadHandle<T>(key);
+    m_handles.push_back(&handle);
+    declareInput(key);
+  }
+
  private:
   std::string m_objectName;
+  ReadHandle<write_data_t> m_objectHandle;
   std::string m_writerName;
   std::unique_ptr<const Acts::Logger> m_logger;
+  std::vector<std::string> m_inputs;
+  // declared handles, members of the derived writer
+  std::vector<DataHandleBase*> m_handles;
 };
 
 }  // namespace FW
@@ -85,6 +115,8 @@ FW::WriterT<write_data_t>::WriterT(std::string objectName,
   } else if (m_writerName.empty()) {
     throw std::invalid_argument("Missing writer name");
   }
+  m_objectHandle = ReadHandle<write_data_t>(m_objectName);
+  m_inputs.push_back(m_objectName);
 }
 
 template <typename write_data_t>
@@ -97,8 +129,29 @@ inline FW::ProcessCode FW::WriterT<write_data_t>::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+template <typename write_data_t>
+inline std::vector<std::string> FW::WriterT<write_data_t>::inputs() const {
+  return m_inputs;
+}
+
+template <typename write_data_t>
+inline void FW::WriterT<write_data_t>::resolveHandles(
+    WhiteBoardRegistry& registry) {
+  m_objectHandle.resolve(registry);
+  for (auto* handle : m_handles) {
+    handle->resolve(registry);
+  }
+}
+
+template <typename write_data_t>
+inline void FW::WriterT<write_data_t>::declareInput(const std::string& key) {
+  if (not key.empty()) {
+    m_inputs.push_back(key);
+  }
+}
+
 template <typename write_data_t>
 inline FW::ProcessCode FW::WriterT<write_data_t>::write(
     const AlgorithmContext& context) {
-  return writeT(context, context.eventStore.get<write_data_t>(m_objectName));
+  return writeT(context, m_objectHandle(context));
 }
@@ -29,5 +29,10 @@ void identifyContributingParticles(
     const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap,
     const ProtoTrack& protoTrack,
     std::vector<ParticleHitCount>& particleHitCount);
+/// Identify all particles that contribute to the proto track and count hits.
+void identifyContributingParticles(
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap,
+    const pmr::ProtoTrack& protoTrack,
+    std::vector<ParticleHitCount>& particleHitCount);
 
 }  // namespace FW
@@ -0,0 +1,192 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Framework/AllocationMeter.hpp"
+
+#include <algorithm>
+
+#ifdef ACTS_ENABLE_TRACING
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+#endif
+
+namespace {
+// allocations of the calling thread since it was started. the counters are
+// constant-initialized and can thus be used within operator new.
+thread_local FW::AllocationCount threadCount;
+}  // namespace
+
+bool FW::isAllocationCountingEnabled() {
+#ifdef ACTS_ENABLE_TRACING
+  return true;
+#else
+  return false;
+#endif
+}
+
+FW::AllocationMeter::AllocationMeter()
+    : m_start(threadCount), m_outerPeakBytes(threadCount.peakBytes) {
+  // the peak of this scope starts at the current net bytes
+  threadCount.peakBytes = threadCount.netBytes;
+}
+
+FW::AllocationMeter::~AllocationMeter() {
+  threadCount.peakBytes = std::max(threadCount.peakBytes, m_outerPeakBytes);
+}
+
+FW::AllocationCount FW::AllocationMeter::count() const {
+  AllocationCount count;
+  count.allocations = threadCount.allocations - m_start.allocations;
+  count.allocatedBytes = threadCount.allocatedBytes - m_start.allocatedBytes;
+  count.netBytes = threadCount.netBytes - m_start.netBytes;
+  count.peakBytes = threadCount.peakBytes - m_start.netBytes;
+  return count;
+}
+
+#ifdef ACTS_ENABLE_TRACING
+// The global operator new and delete are replaced by versions that forward
+// to malloc and free and count the allocations of the calling thread. Since
+// they are defined in the shared framework library, they are used by the
+// whole program.
+namespace {
+int64_t usableSize(void* ptr) {
+#if defined(__APPLE__)
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+// Allocate and count a block, nullptr if the memory is exhausted.
+void* tryAllocate(std::size_t size, std::size_t alignment) {
+  // zero-size allocations must still return unique pointers
+  size = std::max<std::size_t>(size, 1);
+  void* ptr = nullptr;
+  if (alignment <= alignof(std::max_align_t)) {
+    ptr = std::malloc(size);
+  } else if (posix_memalign(&ptr, alignment, size) != 0) {
+    ptr = nullptr;
+  }
+  if (ptr != nullptr) {
+    const int64_t bytes = usableSize(ptr);
+    threadCount.allocations += 1;
+    threadCount.allocatedBytes += bytes;
+    threadCount.netBytes += bytes;
+    threadCount.peakBytes =
+        std::max(threadCount.peakBytes, threadCount.netBytes);
+  }
+  return ptr;
+}
+
+// Call the new handler until the allocation succeeds as required for
+// operator new.
+void* allocate(std::size_t size, std::size_t alignment) {
+  while (true) {
+    void* ptr = tryAllocate(size, alignment);
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void* allocateNoThrow(std::size_t size, std::size_t alignment) noexcept {
+  try {
+    return allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void deallocate(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  threadCount.netBytes -= usableSize(ptr);
+  std::free(ptr);
+}
+
+constexpr std::size_t kDefaultAlignment = alignof(std::max_align_t);
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return allocate(size, kDefaultAlignment);
+}
+void* operator new[](std::size_t size) {
+  return allocate(size, kDefaultAlignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return allocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return allocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+#endif
@@ -15,3 +15,29 @@ FW::BareAlgorithm::BareAlgorithm(std::string name, Acts::Logging::Level level)
 std::string FW::BareAlgorithm::name() const {
   return m_name;
 }
+
+std::vector<std::string> FW::BareAlgorithm::inputs() const {
+  return m_inputs;
+}
+
+std::vector<std::string> FW::BareAlgorithm::outputs() const {
+  return m_outputs;
+}
+
+void FW::BareAlgorithm::resolveHandles(WhiteBoardRegistry& registry) {
+  for (auto* handle : m_handles) {
+    handle->resolve(registry);
+  }
+}
+
+void FW::BareAlgorithm::declareInput(const std::string& key) {
+  if (not key.empty()) {
+    m_inputs.push_back(key);
+  }
+}
+
+void FW::BareAlgorithm::declareOutput(const std::string& key) {
+  if (not key.empty()) {
+    m_outputs.push_back(key);
+  }
+}
@@ -8,18 +8,27 @@
 
 #include "ACTFW/Framework/Sequencer.hpp"
 
+#include "ACTFW/Framework/AllocationMeter.hpp"
 #include "ACTFW/Framework/ProcessCode.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
 #include "ACTFW/Utilities/Paths.hpp"
+#include "Acts/Utilities/Tracing.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <exception>
+#include <fstream>
+#include <memory>
 #include <numeric>
+#include <stdexcept>
+#include <unordered_map>
 
 #include <TROOT.h>
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
+#include <tbb/concurrent_queue.h>
+#include <tbb/flow_graph.h>
 #include <tbb/tbb.h>
 
 FW::Sequencer::Sequencer(const Sequencer::Config& cfg)
@@ -162,6 +171,111 @@ std::pair<std::size_t, std::size_t> FW::Sequencer::determineEventsRange()
   return {begSelected, endSelected};
 }
 
+std::vector<std::vector<size_t>> FW::Sequencer::determineDependencies()
+    const {
+  std::vector<std::vector<size_t>> dependencies(m_algorithms.size() +
+                                                m_writers.size());
+  // the algorithm writing each object
+  std::unordered_map<std::string, size_t> producers;
+  // the first algorithm writing each object, including following ones
+  std::unordered_map<std::string, size_t> allProducers;
+  for (size_t ialg = m_algorithms.size(); 0 < ialg--;) {
+    for (const auto& output : m_algorithms[ialg]->outputs()) {
+      allProducers[output] = ialg;
+    }
+  }
+  // readers and services do not declare their outputs and might write any
+  // object
+  const bool undeclaredSources = not(m_readers.empty() and m_services.empty());
+  // the last algorithm without declared inputs and outputs, which runs after
+  // all preceding algorithms
+  size_t barrier = SIZE_MAX;
+  // all algorithms since the last barrier, including the barrier
+  std::vector<size_t> sinceBarrier;
+
+  // the producers of the inputs and the barrier, all other inputs must come
+  // from readers, services, or algorithms without declared outputs
+  auto inputDependencies = [&](const std::vector<std::string>& inputs,
+                               const std::string& name) {
+    std::vector<size_t> deps;
+    if (barrier != SIZE_MAX) {
+      deps.push_back(barrier);
+    }
+    for (const auto& input : inputs) {
+      auto it = producers.find(input);
+      if (it != producers.end()) {
+        deps.push_back(it->second);
+        continue;
+      }
+      auto later = allProducers.find(input);
+      if (later != allProducers.end()) {
+        throw std::invalid_argument(
+            "Input '" + input + "' of '" + name +
+            "' is written by the following algorithm '" +
+            m_algorithms[later->second]->name() + "'");
+      }
+      if (not undeclaredSources and barrier == SIZE_MAX) {
+        throw std::invalid_argument("Input '" + input + "' of '" + name +
+                                    "' is not written by any reader, "
+                                    "service, or preceding algorithm");
+      }
+    }
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    return deps;
+  };
+
+  for (size_t ialg = 0; ialg < m_algorithms.size(); ++ialg) {
+    const auto inputs = m_algorithms[ialg]->inputs();
+    const auto outputs = m_algorithms[ialg]->outputs();
+    if (inputs.empty() and outputs.empty()) {
+      dependencies[ialg] = sinceBarrier;
+      barrier = ialg;
+      sinceBarrier = {ialg};
+      continue;
+    }
+    dependencies[ialg] =
+        inputDependencies(inputs, "Algorithm:" + m_algorithms[ialg]->name());
+    sinceBarrier.push_back(ialg);
+    for (const auto& output : outputs) {
+      producers[output] = ialg;
+    }
+  }
+  for (size_t iwrt = 0; iwrt < m_writers.size(); ++iwrt) {
+    const auto inputs = m_writers[iwrt]->inputs();
+    // writers without declared inputs run after all algorithms
+    dependencies[m_algorithms.size() + iwrt] =
+        inputs.empty()
+            ? sinceBarrier
+            : inputDependencies(inputs, "Writer:" + m_writers[iwrt]->name());
+  }
+  return dependencies;
+}
+
+void FW::Sequencer::resolveHandles() {
+  // declared objects get their slots before the first event store is created
+  for (const auto& algorithm : m_algorithms) {
+    for (const auto& name : algorithm->inputs()) {
+      m_registry.slot(name);
+    }
+    for (const auto& name : algorithm->outputs()) {
+      m_registry.slot(name);
+    }
+  }
+  for (const auto& writer : m_writers) {
+    for (const auto& name : writer->inputs()) {
+      m_registry.slot(name);
+    }
+  }
+  // the handles also register the object types
+  for (auto& algorithm : m_algorithms) {
+    algorithm->resolveHandles(m_registry);
+  }
+  for (auto& writer : m_writers) {
+    writer->resolveHandles(m_registry);
+  }
+}
+
 // helpers for per-algorithm timing information
 namespace {
 using Clock = std::chrono::high_resolution_clock;
@@ -170,13 +284,28 @@ using Timepoint = Clock::time_point;
 using Seconds = std::chrono::duration<double>;
 using NanoSeconds = std::chrono::duration<double, std::nano>;
 
-// RAII-based stopwatch to time execution within a block
+// Add the allocations of another block; the peak is the largest one.
+void accumulate(FW::AllocationCount& total, const FW::AllocationCount& count) {
+  total.allocations += count.allocations;
+  total.allocatedBytes += count.allocatedBytes;
+  total.netBytes += count.netBytes;
+  total.peakBytes = std::max(total.peakBytes, count.peakBytes);
+}
+
+// RAII-based stopwatch to time execution and to count the allocations of the
+// executing thread within a block
 struct StopWatch {
   Timepoint start;
+  FW::AllocationMeter meter;
   Duration& store;
+  FW::AllocationCount& allocations;
 
-  StopWatch(Duration& s) : start(Clock::now()), store(s) {}
-  ~StopWatch() { store += Clock::now() - start; }
+  StopWatch(Duration& s, FW::AllocationCount& a)
+      : start(Clock::now()), store(s), allocations(a) {}
+  ~StopWatch() {
+    store += Clock::now() - start;
+    accumulate(allocations, meter.count());
+  }
 };
 
 // Convert duration to a printable string w/ reasonable unit.
@@ -200,28 +329,292 @@ inline std::string perEvent(D duration, size_t numEvents) {
   return asString(duration / numEvents) + "/event";
 }
 
+// Per-event value at the given quantile of sorted per-event values.
+template <typename T>
+T quantile(const std::vector<T>& sorted, double q) {
+  // nearest rank
+  size_t rank = std::ceil(q * sorted.size());
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+// Per-event values of one identifier sorted in ascending order.
+//
+// Identifiers without per-event values, i.e. the start- and end-of-run
+// hooks, use the total value instead.
+template <typename T, typename Value>
+std::vector<T> sortedPerEvent(const std::vector<std::vector<Value>>& events,
+                              size_t i, const Value& total,
+                              T (*get)(const Value&)) {
+  std::vector<T> sorted;
+  for (const auto& event : events) {
+    if (i < event.size()) {
+      sorted.push_back(get(event[i]));
+    }
+  }
+  if (sorted.empty()) {
+    sorted.push_back(get(total));
+  }
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
 // Store timing data
+//
+// The allocation columns are only filled if allocations are counted, i.e.
+// if Acts is configured with ACTS_ENABLE_TRACING, and are zero otherwise.
 struct TimingInfo {
   std::string identifier;
   double time_total_s;
   double time_perevent_s;
-
-  DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s);
+  double time_p50_s;
+  double time_p95_s;
+  double time_p99_s;
+  uint64_t allocs_total;
+  uint64_t allocs_p50;
+  uint64_t allocs_p95;
+  uint64_t allocs_p99;
+  uint64_t alloc_bytes_total;
+  uint64_t alloc_bytes_p50;
+  uint64_t alloc_bytes_p95;
+  uint64_t alloc_bytes_p99;
+  int64_t peak_bytes_p50;
+  int64_t peak_bytes_p95;
+  int64_t peak_bytes_p99;
+
+  DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s,
+                 time_p50_s, time_p95_s, time_p99_s, allocs_total,
+                 allocs_p50, allocs_p95, allocs_p99, alloc_bytes_total,
+                 alloc_bytes_p50, alloc_bytes_p95, alloc_bytes_p99,
+                 peak_bytes_p50, peak_bytes_p95, peak_bytes_p99);
 };
 
-void storeTiming(const std::vector<std::string>& identifiers,
-                 const std::vector<Duration>& durations, std::size_t numEvents,
-                 std::string path) {
+double seconds(const Duration& duration) {
+  return std::chrono::duration_cast<Seconds>(duration).count();
+}
+uint64_t allocations(const FW::AllocationCount& count) {
+  return count.allocations;
+}
+uint64_t allocatedBytes(const FW::AllocationCount& count) {
+  return count.allocatedBytes;
+}
+int64_t peakBytes(const FW::AllocationCount& count) {
+  return count.peakBytes;
+}
+
+void storeTiming(
+    const std::vector<std::string>& identifiers,
+    const std::vector<Duration>& durations,
+    const std::vector<std::vector<Duration>>& eventDurations,
+    const std::vector<FW::AllocationCount>& counts,
+    const std::vector<std::vector<FW::AllocationCount>>& eventCounts,
+    std::size_t numEvents, std::string path) {
   dfe::NamedTupleTsvWriter<TimingInfo> writer(std::move(path), 4);
   for (size_t i = 0; i < identifiers.size(); ++i) {
     TimingInfo info;
     info.identifier = identifiers[i];
-    info.time_total_s =
-        std::chrono::duration_cast<Seconds>(durations[i]).count();
+    info.time_total_s = seconds(durations[i]);
     info.time_perevent_s = info.time_total_s / numEvents;
+    auto times = sortedPerEvent(eventDurations, i, durations[i], &seconds);
+    info.time_p50_s = quantile(times, 0.50);
+    info.time_p95_s = quantile(times, 0.95);
+    info.time_p99_s = quantile(times, 0.99);
+    info.allocs_total = counts[i].allocations;
+    auto allocs = sortedPerEvent(eventCounts, i, counts[i], &allocations);
+    info.allocs_p50 = quantile(allocs, 0.50);
+    info.allocs_p95 = quantile(allocs, 0.95);
+    info.allocs_p99 = quantile(allocs, 0.99);
+    info.alloc_bytes_total = counts[i].allocatedBytes;
+    auto bytes = sortedPerEvent(eventCounts, i, counts[i], &allocatedBytes);
+    info.alloc_bytes_p50 = quantile(bytes, 0.50);
+    info.alloc_bytes_p95 = quantile(bytes, 0.95);
+    info.alloc_bytes_p99 = quantile(bytes, 0.99);
+    auto peaks = sortedPerEvent(eventCounts, i, counts[i], &peakBytes);
+    info.peak_bytes_p50 = quantile(peaks, 0.50);
+    info.peak_bytes_p95 = quantile(peaks, 0.95);
+    info.peak_bytes_p99 = quantile(peaks, 0.99);
     writer.append(info);
   }
 }
+
+// Index of the executing thread within the thread pool.
+int threadIndex() {
+  return tbb::this_task_arena::current_thread_index();
+}
+
+// A time span of an algorithm for one event or of a marked core scope.
+struct Span {
+  std::string name;
+  // SIZE_MAX for core scopes
+  size_t event;
+  int thread;
+  Timepoint start;
+  Timepoint end;
+  // allocations of the executing thread during the span
+  FW::AllocationCount allocations;
+};
+
+// Collects the spans of all threads, including the core tracing markers.
+class EventTrace : public Acts::Tracing::Tracer {
+ public:
+  ~EventTrace() override {
+    if (Acts::Tracing::tracer() == this) {
+      Acts::Tracing::setTracer(nullptr);
+    }
+  }
+
+  void record(Span span) { m_spans.push_back(std::move(span)); }
+
+  void begin(const char* /*name*/) override {
+    openScopes().push_back(Clock::now());
+  }
+  void end(const char* name) override {
+    Timepoint start = openScopes().back();
+    openScopes().pop_back();
+    record({name, SIZE_MAX, threadIndex(), start, Clock::now(), {}});
+  }
+
+  // Write all spans in the Chrome trace event format.
+  void write(const std::string& path, Timepoint origin) const {
+    using MicroSeconds = std::chrono::duration<double, std::micro>;
+    auto escaped = [](const std::string& str) {
+      std::string result;
+      for (char c : str) {
+        if (c == '"' or c == '\\') {
+          result.push_back('\\');
+        }
+        result.push_back(c);
+      }
+      return result;
+    };
+
+    std::ofstream os(path);
+    if (not os) {
+      throw std::ios_base::failure("Could not open '" + path + "' to write");
+    }
+    const bool countAllocations = FW::isAllocationCountingEnabled();
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < m_spans.size(); ++i) {
+      const auto& span = m_spans[i];
+      const bool isCore = (span.event == SIZE_MAX);
+      os << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << escaped(span.name)
+         << "\",\"cat\":\"" << (isCore ? "core" : "sequencer")
+         << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << span.thread
+         << ",\"ts\":" << MicroSeconds(span.start - origin).count()
+         << ",\"dur\":" << MicroSeconds(span.end - span.start).count();
+      if (not isCore) {
+        os << ",\"args\":{\"event\":" << span.event;
+        if (countAllocations) {
+          os << ",\"allocations\":" << span.allocations.allocations
+             << ",\"allocatedBytes\":" << span.allocations.allocatedBytes
+             << ",\"netBytes\":" << span.allocations.netBytes
+             << ",\"peakBytes\":" << span.allocations.peakBytes;
+        }
+        os << "}";
+      }
+      os << "}";
+    }
+    os << "\n]}\n";
+  }
+
+ private:
+  tbb::concurrent_vector<Span> m_spans;
+
+  // start times of the open core scopes of the executing thread
+  static std::vector<Timepoint>& openScopes() {
+    thread_local std::vector<Timepoint> scopes;
+    return scopes;
+  }
+};
+
+// Record a span of an algorithm during its lifetime if tracing is enabled.
+//
+// The allocations are taken from the per-event counts of the algorithm, which
+// are filled by a StopWatch within the same scope that is destroyed first.
+class ScopedSpan {
+ public:
+  ScopedSpan(EventTrace* trace, const std::string& name, size_t event,
+             const FW::AllocationCount& allocations)
+      : m_trace(trace), m_allocations(allocations) {
+    if (m_trace != nullptr) {
+      m_span = {name, event, threadIndex(), Clock::now(), {}, {}};
+    }
+  }
+  ~ScopedSpan() {
+    if (m_trace != nullptr) {
+      m_span.end = Clock::now();
+      m_span.allocations = m_allocations;
+      m_trace->record(std::move(m_span));
+    }
+  }
+
+ private:
+  EventTrace* m_trace;
+  const FW::AllocationCount& m_allocations;
+  Span m_span;
+};
+}  // namespace
+
+namespace {
+/// The data of one event while it is being processed.
+struct EventData {
+  FW::WhiteBoard store;
+  /// Algorithms and writers run on copies of the decorated context
+  FW::AlgorithmContext context;
+  std::vector<Duration> clocks;
+  std::vector<FW::AllocationCount> allocations;
+
+  EventData(size_t event, size_t numClocks, Acts::Logging::Level level,
+            FW::WhiteBoardRegistry& registry)
+      : store(registry, Acts::getDefaultLogger(
+                            "EventStore#" + std::to_string(event), level)),
+        context(0, event, store),
+        clocks(numClocks, Duration::zero()),
+        allocations(numClocks) {}
+};
+
+/// Flow graph that runs the algorithms and writers of one event at a time.
+///
+/// The dependencies are fixed for the whole run. The nodes and edges are
+/// therefore only built once and the graph is reused for subsequent events.
+class EventGraph {
+ public:
+  template <typename run_node_t>
+  EventGraph(const std::vector<std::vector<size_t>>& dependencies,
+             size_t numNodes, run_node_t runNode)
+      : m_start(m_graph) {
+    for (size_t inode = 0; inode < numNodes; ++inode) {
+      m_nodes.push_back(std::make_unique<Node>(
+          m_graph, [this, runNode, inode](const tbb::flow::continue_msg&) {
+            runNode(*m_data, inode);
+            return tbb::flow::continue_msg();
+          }));
+    }
+    for (size_t inode = 0; inode < numNodes; ++inode) {
+      if (dependencies[inode].empty()) {
+        tbb::flow::make_edge(m_start, *m_nodes[inode]);
+      }
+      for (auto idep : dependencies[inode]) {
+        tbb::flow::make_edge(*m_nodes[idep], *m_nodes[inode]);
+      }
+    }
+  }
+
+  /// Run all nodes on the given event and wait until they have finished.
+  void process(EventData& data) {
+    m_data = &data;
+    m_start.try_put(tbb::flow::continue_msg());
+    m_graph.wait_for_all();
+    m_data = nullptr;
+  }
+
+ private:
+  using Node = tbb::flow::continue_node<tbb::flow::continue_msg>;
+
+  tbb::flow::graph m_graph;
+  tbb::flow::broadcast_node<tbb::flow::continue_msg> m_start;
+  std::vector<std::unique_ptr<Node>> m_nodes;
+  EventData* m_data = nullptr;
+};
 }  // namespace
 
 int FW::Sequencer::run() {
@@ -230,7 +623,20 @@ int FW::Sequencer::run() {
   // per-algorithm time measures
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
+  // per-event time measures, for the percentiles. the start- and end-of-run
+  // hooks are added to the names later on but never run per event.
+  const size_t numEventClocks = names.size();
+  std::vector<std::vector<Duration>> eventClocks;
+  // per-algorithm and per-event allocations, in the same order
+  std::vector<AllocationCount> allocationsAlgorithms(names.size());
+  std::vector<std::vector<AllocationCount>> eventAllocations;
   tbb::queuing_mutex clocksAlgorithmsMutex;
+  // individual time spans, only if requested
+  std::unique_ptr<EventTrace> trace;
+  if (m_cfg.traceEvents) {
+    trace = std::make_unique<EventTrace>();
+    Acts::Tracing::setTracer(trace.get());
+  }
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
@@ -248,81 +654,197 @@ int FW::Sequencer::run() {
   ACTS_INFO("  " << m_algorithms.size() << " algorithms");
   ACTS_INFO("  " << m_writers.size() << " writers");
 
+  // algorithms and writers can run once their dependencies have finished
+  std::vector<std::vector<size_t>> dependencies;
+  try {
+    dependencies = determineDependencies();
+    resolveHandles();
+  } catch (const std::invalid_argument& e) {
+    ACTS_ERROR(e.what());
+    return EXIT_FAILURE;
+  }
+
   // run start-of-run hooks
   for (auto& service : m_services) {
     names.push_back("Service:" + service->name() + ":startRun");
     clocksAlgorithms.push_back(Duration::zero());
-    StopWatch sw(clocksAlgorithms.back());
+    allocationsAlgorithms.emplace_back();
+    StopWatch sw(clocksAlgorithms.back(), allocationsAlgorithms.back());
     service->startRun();
   }
 
-  // execute the parallel event loop
+  const size_t ifirstNode =
+      m_services.size() + m_decorators.size() + m_readers.size();
+  for (size_t inode = 0; inode < dependencies.size(); ++inode) {
+    std::string deps;
+    for (auto idep : dependencies[inode]) {
+      deps += " " + names[ifirstNode + idep];
+    }
+    ACTS_DEBUG(names[ifirstNode + inode] << " runs after:"
+                                         << (deps.empty() ? " readers" : deps));
+  }
+
+  // read an event, i.e. run all services, decorators, and readers
+  auto readEvent = [&](EventData& data) {
+    auto& context = data.context;
+    size_t ialgo = 0;
+    // Prepare event store w/ service information
+    for (auto& service : m_services) {
+      ScopedSpan span(trace.get(), names[ialgo], context.eventNumber,
+                      data.allocations[ialgo]);
+      StopWatch sw(data.clocks[ialgo], data.allocations[ialgo]);
+      ++ialgo;
+      service->prepare(++context);
+    }
+    /// Decorate the context
+    for (auto& cdr : m_decorators) {
+      ScopedSpan span(trace.get(), names[ialgo], context.eventNumber,
+                      data.allocations[ialgo]);
+      StopWatch sw(data.clocks[ialgo], data.allocations[ialgo]);
+      ++ialgo;
+      if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to decorate event context");
+      }
+    }
+    // Read everything in
+    for (auto& rdr : m_readers) {
+      ScopedSpan span(trace.get(), names[ialgo], context.eventNumber,
+                      data.allocations[ialgo]);
+      StopWatch sw(data.clocks[ialgo], data.allocations[ialgo]);
+      ++ialgo;
+      if (rdr->read(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to read input data");
+      }
+    }
+  };
+  // run an algorithm or a writer of an event on its own context copy
+  auto runNode = [&](EventData& data, size_t inode) {
+    // same algorithm number as in sequential processing
+    AlgorithmContext nodeContext = data.context;
+    nodeContext.algorithmNumber += inode + 1;
+    const size_t iclock = ifirstNode + inode;
+    ScopedSpan span(trace.get(), names[iclock], nodeContext.eventNumber,
+                    data.allocations[iclock]);
+    StopWatch sw(data.clocks[iclock], data.allocations[iclock]);
+    if (inode < m_algorithms.size()) {
+      if (m_algorithms[inode]->execute(nodeContext) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    } else if (m_writers[inode - m_algorithms.size()]->write(nodeContext) !=
+               ProcessCode::SUCCESS) {
+      throw std::runtime_error("Failed to write output data");
+    }
+  };
+
   tbb::task_scheduler_init init(m_cfg.numThreads);
-  tbb::parallel_for(
-      tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-      [&](const tbb::blocked_range<size_t>& r) {
-        std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                    Duration::zero());
-
-        for (size_t event = r.begin(); event != r.end(); ++event) {
-          // Use per-event store
-          WhiteBoard eventStore(Acts::getDefaultLogger(
-              "EventStore#" + std::to_string(event), m_cfg.logLevel));
-          // If we ever wanted to run algorithms in parallel, this needs to be
-          // changed to Algorithm context copies
-          AlgorithmContext context(0, event, eventStore);
-          size_t ialgo = 0;
-
-          // Prepare event store w/ service information
-          for (auto& service : m_services) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            service->prepare(++context);
-          }
-          /// Decorate the context
-          for (auto& cdr : m_decorators) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to decorate event context");
+  // one graph per event being processed concurrently. graphs are built on
+  // first use and returned to the pool once their event has finished. a
+  // graph that failed is dropped since the run is aborted anyways.
+  tbb::concurrent_queue<std::unique_ptr<EventGraph>> eventGraphs;
+  // run the first numNodes algorithms and writers of an event, each one as
+  // soon as its dependencies have finished
+  auto processEvent = [&](EventData& data, size_t numNodes) {
+    std::unique_ptr<EventGraph> graph;
+    if (not eventGraphs.try_pop(graph)) {
+      graph = std::make_unique<EventGraph>(dependencies, numNodes, runNode);
+    }
+    graph->process(data);
+    eventGraphs.push(std::move(graph));
+  };
+
+  if (0 < m_cfg.eventsInFlight) {
+    // execute the pipelined event loop. events are read and written one at
+    // a time in order while the algorithms of up to eventsInFlight events
+    // run in parallel.
+    ACTS_INFO("Pipelining up to " << m_cfg.eventsInFlight << " events");
+    size_t nextEvent = eventsRange.first;
+    // shared pointers since the pipeline stages copy their in- and outputs
+    using EventPtr = std::shared_ptr<EventData>;
+    tbb::parallel_pipeline(
+        m_cfg.eventsInFlight,
+        tbb::make_filter<void, EventPtr>(
+            tbb::filter::serial_in_order,
+            [&](tbb::flow_control& fc) -> EventPtr {
+              if (nextEvent == eventsRange.second) {
+                fc.stop();
+                return nullptr;
+              }
+              auto data = std::make_shared<EventData>(
+                  nextEvent++, numEventClocks, m_cfg.logLevel, m_registry);
+              readEvent(*data);
+              return data;
+            }) &
+            tbb::make_filter<EventPtr, EventPtr>(
+                tbb::filter::parallel,
+                [&](EventPtr data) {
+                  processEvent(*data, m_algorithms.size());
+                  return data;
+                }) &
+            tbb::make_filter<EventPtr, void>(
+                tbb::filter::serial_in_order, [&](EventPtr data) {
+                  for (size_t iwrt = 0; iwrt < m_writers.size(); ++iwrt) {
+                    runNode(*data, m_algorithms.size() + iwrt);
+                  }
+                  ACTS_INFO("finished event " << data->context.eventNumber);
+                  // only one event at a time is in the serial stage
+                  for (size_t i = 0; i < numEventClocks; ++i) {
+                    clocksAlgorithms[i] += data->clocks[i];
+                    accumulate(allocationsAlgorithms[i],
+                               data->allocations[i]);
+                  }
+                  eventClocks.push_back(std::move(data->clocks));
+                  eventAllocations.push_back(std::move(data->allocations));
+                }));
+  } else {
+    // execute the parallel event loop
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
+        [&](const tbb::blocked_range<size_t>& r) {
+          std::vector<Duration> localClocksAlgorithms(numEventClocks,
+                                                      Duration::zero());
+          std::vector<std::vector<Duration>> localEventClocks;
+          std::vector<AllocationCount> localAllocationsAlgorithms(
+              numEventClocks);
+          std::vector<std::vector<AllocationCount>> localEventAllocations;
+
+          for (size_t event = r.begin(); event != r.end(); ++event) {
+            EventData data(event, numEventClocks, m_cfg.logLevel,
+                           m_registry);
+            readEvent(data);
+            processEvent(data, dependencies.size());
+            for (size_t i = 0; i < localClocksAlgorithms.size(); ++i) {
+              localClocksAlgorithms[i] += data.clocks[i];
+              accumulate(localAllocationsAlgorithms[i], data.allocations[i]);
             }
+            localEventClocks.push_back(std::move(data.clocks));
+            localEventAllocations.push_back(std::move(data.allocations));
+            ACTS_INFO("finished event " << event);
           }
-          // Read everything in
-          for (auto& rdr : m_readers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (rdr->read(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to read input data");
+
+          // add timing info to global information
+          {
+            tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+            for (size_t i = 0; i < numEventClocks; ++i) {
+              clocksAlgorithms[i] += localClocksAlgorithms[i];
+              accumulate(allocationsAlgorithms[i],
+                         localAllocationsAlgorithms[i]);
             }
-          }
-          // Execute all algorithms
-          for (auto& alg : m_algorithms) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (alg->execute(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to process event data");
+            for (auto& clocks : localEventClocks) {
+              eventClocks.push_back(std::move(clocks));
             }
-          }
-          // Write out results
-          for (auto& wrt : m_writers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (wrt->write(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to write output data");
+            for (auto& allocations : localEventAllocations) {
+              eventAllocations.push_back(std::move(allocations));
             }
           }
-          ACTS_INFO("finished event " << event);
-        }
-
-        // add timing info to global information
-        {
-          tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-          for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-            clocksAlgorithms[i] += localClocksAlgorithms[i];
-          }
-        }
-      });
+        });
+  }
 
   // run end-of-run hooks
   for (auto& wrt : m_writers) {
     names.push_back("Writer:" + wrt->name() + ":endRun");
     clocksAlgorithms.push_back(Duration::zero());
-    StopWatch sw(clocksAlgorithms.back());
+    allocationsAlgorithms.emplace_back();
+    StopWatch sw(clocksAlgorithms.back(), allocationsAlgorithms.back());
     if (wrt->endRun() != ProcessCode::SUCCESS) {
       return EXIT_FAILURE;
     }
@@ -341,8 +863,14 @@ int FW::Sequencer::run() {
     ACTS_DEBUG("  " << names[i] << ": "
                     << perEvent(clocksAlgorithms[i], numEvents));
   }
-  storeTiming(names, clocksAlgorithms, numEvents,
+  storeTiming(names, clocksAlgorithms, eventClocks, allocationsAlgorithms,
+              eventAllocations, numEvents,
               joinPaths(m_cfg.outputDir, "timing.tsv"));
+  if (trace) {
+    Acts::Tracing::setTracer(nullptr);
+    trace->write(joinPaths(m_cfg.outputDir, "timing_trace.json"),
+                 clockWallStart);
+  }
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Framework/WhiteBoard.hpp"
+
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <boost/core/demangle.hpp>
+
+namespace {
+// set the type of a slot if none is registered yet, requires the unique lock
+void registerType(const std::string& name, const std::type_info*& registered,
+                  const std::type_info& type) {
+  if (registered == nullptr) {
+    registered = &type;
+  } else if (*registered != type) {
+    throw std::invalid_argument(
+        "Object '" + name + "' is used as both '" +
+        boost::core::demangle(registered->name()) + "' and '" +
+        boost::core::demangle(type.name()) + "'");
+  }
+}
+}  // namespace
+
+size_t FW::WhiteBoardRegistry::slot(const std::string& name,
+                                    const std::type_info* type) {
+  if (name.empty()) {
+    throw std::invalid_argument("Object can not have an empty name");
+  }
+  {
+    // names are usually registered already, e.g. for every event
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_slots.find(name);
+    if (it != m_slots.end() and
+        (type == nullptr or m_types[it->second] == type)) {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  auto it = m_slots.find(name);
+  if (it == m_slots.end()) {
+    it = m_slots.emplace(name, m_types.size()).first;
+    m_types.push_back(nullptr);
+  }
+  if (type != nullptr) {
+    registerType(name, m_types[it->second], *type);
+  }
+  return it->second;
+}
+
+size_t FW::WhiteBoardRegistry::find(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  auto it = m_slots.find(name);
+  return (it != m_slots.end()) ? it->second : SIZE_MAX;
+}
+
+const std::type_info* FW::WhiteBoardRegistry::type(size_t slot) const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  return (slot < m_types.size()) ? m_types[slot] : nullptr;
+}
+
+void FW::WhiteBoardRegistry::requireType(size_t slot, const std::string& name,
+                                         const std::type_info& type) {
+  {
+    // the type is usually registered already, e.g. by the handles
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    const std::type_info* registered = m_types.at(slot);
+    if (registered != nullptr and *registered == type) {
+      return;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  registerType(name, m_types.at(slot), type);
+}
+
+size_t FW::WhiteBoardRegistry::size() const {
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  return m_types.size();
+}
+
+FW::WhiteBoard::Arena::Arena() {
+  static std::atomic<uint64_t> s_nextId{1};
+  m_id = s_nextId++;
+}
+
+boost::container::pmr::memory_resource& FW::WhiteBoard::Arena::buffer() {
+  // the buffer of the arena used last by this thread
+  thread_local uint64_t t_id = 0;
+  thread_local boost::container::pmr::memory_resource* t_buffer = nullptr;
+  if (t_id != m_id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& buffer = m_buffers[std::this_thread::get_id()];
+    if (not buffer) {
+      buffer =
+          std::make_unique<boost::container::pmr::monotonic_buffer_resource>();
+    }
+    t_id = m_id;
+    t_buffer = buffer.get();
+  }
+  return *t_buffer;
+}
+
+void* FW::WhiteBoard::Arena::do_allocate(size_t bytes, size_t alignment) {
+  return buffer().allocate(bytes, alignment);
+}
@@ -12,10 +12,13 @@
 
 #include <algorithm>
 
-void FW::identifyContributingParticles(
+namespace FW {
+namespace {
+template <typename proto_track_t>
+void identifyContributingParticlesImpl(
     const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap,
-    const ProtoTrack& protoTrack,
-    std::vector<FW::ParticleHitCount>& particleHitCount) {
+    const proto_track_t& protoTrack,
+    std::vector<ParticleHitCount>& particleHitCount) {
   particleHitCount.clear();
 
   for (auto hitIndex : protoTrack) {
@@ -44,3 +47,21 @@ void FW::identifyContributingParticles(
   };
   std::sort(particleHitCount.begin(), particleHitCount.end(), compareHitCount);
 }
+}  // namespace
+}  // namespace FW
+
+void FW::identifyContributingParticles(
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap,
+    const ProtoTrack& protoTrack,
+    std::vector<FW::ParticleHitCount>& particleHitCount) {
+  identifyContributingParticlesImpl(hitParticlesMap, protoTrack,
+                                    particleHitCount);
+}
+
+void FW::identifyContributingParticles(
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap,
+    const pmr::ProtoTrack& protoTrack,
+    std::vector<FW::ParticleHitCount>& particleHitCount) {
+  identifyContributingParticlesImpl(hitParticlesMap, protoTrack,
+                                    particleHitCount);
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 
@@ -34,7 +35,7 @@ namespace FW {
 ///
 /// and each line in the file corresponds to one hit/cluster.
 class CsvPlanarClusterWriter final
-    : public WriterT<GeometryIdMultimap<Acts::PlanarModuleCluster>> {
+    : public WriterT<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>> {
  public:
   struct Config {
     /// Which cluster collection to write.
@@ -59,11 +60,12 @@ class CsvPlanarClusterWriter final
   /// @param[in] ctx is the algorithm context
   /// @param[in] particles are the particle to be written
   ProcessCode writeT(const AlgorithmContext& ctx,
-                     const GeometryIdMultimap<Acts::PlanarModuleCluster>&
+                     const pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>&
                          clusters) final override;
 
  private:
   Config m_cfg;
+  ReadHandle<pmr::SimHitContainer> m_inputSimulatedHits;
 };
 
 }  // namespace FW
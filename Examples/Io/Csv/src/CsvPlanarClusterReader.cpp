@@ -164,10 +164,11 @@ FW::ProcessCode FW::CsvPlanarClusterReader::read(
   auto truths = readTruthHitsByHitId(m_cfg.inputDir, ctx.eventNumber);
 
   // prepare containers for the hit data using the framework event data types
-  GeometryIdMultimap<Acts::PlanarModuleCluster> clusters;
+  pmr::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters(
+      ctx.eventStore.memoryResource());
   std::vector<uint64_t> hitIds;
   IndexMultimap<ActsFatras::Barcode> hitParticlesMap;
-  SimHitContainer simHits;
+  pmr::SimHitContainer simHits(ctx.eventStore.memoryResource());
   clusters.reserve(hits.size());
   hitIds.reserve(hits.size());
   hitParticlesMap.reserve(truths.size());
@@ -30,14 +30,14 @@ FW::CsvPlanarClusterWriter::CsvPlanarClusterWriter(
   if (m_cfg.inputSimulatedHits.empty()) {
     throw std::invalid_argument("Missing simulated hits input collection");
   }
+  declareInput(m_inputSimulatedHits, m_cfg.inputSimulatedHits);
 }
 
 FW::ProcessCode FW::CsvPlanarClusterWriter::writeT(
     const AlgorithmContext& ctx,
-    const FW::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
+    const FW::pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
   // retrieve simulated hits
-  const auto& simHits =
-      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
+  const auto& simHits = m_inputSimulatedHits(ctx);
 
   // open per-event file for all components
   std::string pathHits =
@@ -34,6 +34,7 @@ FW::CKFPerformanceWriter::CKFPerformanceWriter(
   if (m_cfg.inputParticles.empty()) {
     throw std::invalid_argument("Missing input particles collection");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
   if (m_cfg.outputFilename.empty()) {
     throw std::invalid_argument("Missing output filename");
   }
@@ -82,8 +83,7 @@ FW::ProcessCode FW::CKFPerformanceWriter::writeT(
   using RecoTrackInfo = std::pair<size_t, Acts::BoundParameters>;
 
   // Read truth particles from input collection
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
 
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
 #include "ACTFW/Validation/DuplicationPlotTool.hpp"
@@ -69,6 +70,7 @@ class CKFPerformanceWriter final : public WriterT<TrajectoryContainer> {
                      const TrajectoryContainer& trajectories) final override;
 
   Config m_cfg;
+  ReadHandle<SimParticleContainer> m_inputParticles;
   /// Mutex used to protect multi-threaded writes.
   std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
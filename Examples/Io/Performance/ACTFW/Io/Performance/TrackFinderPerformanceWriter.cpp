@@ -29,11 +29,12 @@
 namespace {
 using SimParticleContainer = FW::SimParticleContainer;
 using HitParticlesMap = FW::IndexMultimap<ActsFatras::Barcode>;
-using ProtoTrackContainer = FW::ProtoTrackContainer;
 }  // namespace
 
 struct FW::TrackFinderPerformanceWriter::Impl {
   Config cfg;
+  ReadHandle<SimParticleContainer> inputParticles;
+  ReadHandle<HitParticlesMap> inputHitParticlesMap;
   TFile* file = nullptr;
 
   // per-track tree
@@ -135,7 +136,7 @@ struct FW::TrackFinderPerformanceWriter::Impl {
 
   void write(uint64_t eventId, const SimParticleContainer& particles,
              const HitParticlesMap& hitParticlesMap,
-             const ProtoTrackContainer& tracks) {
+             const pmr::ProtoTrackContainer& tracks) {
     // compute the inverse mapping on-the-fly
     const auto& particleHitsMap = invertIndexMultimap(hitParticlesMap);
     // How often a particle was reconstructed.
@@ -238,18 +239,20 @@ struct FW::TrackFinderPerformanceWriter::Impl {
 FW::TrackFinderPerformanceWriter::TrackFinderPerformanceWriter(
     FW::TrackFinderPerformanceWriter::Config cfg, Acts::Logging::Level lvl)
     : WriterT(cfg.inputProtoTracks, "TrackFinderPerformanceWriter", lvl),
-      m_impl(std::make_unique<Impl>(std::move(cfg), logger())) {}
+      m_impl(std::make_unique<Impl>(std::move(cfg), logger())) {
+  declareInput(m_impl->inputParticles, m_impl->cfg.inputParticles);
+  declareInput(m_impl->inputHitParticlesMap, m_impl->cfg.inputHitParticlesMap);
+}
 
 FW::TrackFinderPerformanceWriter::~TrackFinderPerformanceWriter() {
   // explicit destructor needed for pimpl idiom to work
 }
 
 FW::ProcessCode FW::TrackFinderPerformanceWriter::writeT(
-    const FW::AlgorithmContext& ctx, const FW::ProtoTrackContainer& tracks) {
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_impl->cfg.inputParticles);
-  const auto& hitParticlesMap =
-      ctx.eventStore.get<HitParticlesMap>(m_impl->cfg.inputHitParticlesMap);
+    const FW::AlgorithmContext& ctx,
+    const FW::pmr::ProtoTrackContainer& tracks) {
+  const auto& particles = m_impl->inputParticles(ctx);
+  const auto& hitParticlesMap = m_impl->inputHitParticlesMap(ctx);
   m_impl->write(ctx.eventNumber, particles, hitParticlesMap, tracks);
   return ProcessCode::SUCCESS;
 }
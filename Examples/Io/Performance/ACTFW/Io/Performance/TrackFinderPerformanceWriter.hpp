@@ -20,7 +20,8 @@ namespace FW {
 ///
 /// Only considers the track finding itself, i.e. grouping of hits into tracks,
 /// and computes relevant per-track and per-particles statistics.
-class TrackFinderPerformanceWriter final : public WriterT<ProtoTrackContainer> {
+class TrackFinderPerformanceWriter final
+    : public WriterT<pmr::ProtoTrackContainer> {
  public:
   struct Config {
     /// True set of input particles.
@@ -42,7 +43,7 @@ class TrackFinderPerformanceWriter final : public WriterT<ProtoTrackContainer> {
 
  private:
   ProcessCode writeT(const AlgorithmContext& ctx,
-                     const ProtoTrackContainer& tracks) final override;
+                     const pmr::ProtoTrackContainer& tracks) final override;
 
   struct Impl;
   std::unique_ptr<Impl> m_impl;
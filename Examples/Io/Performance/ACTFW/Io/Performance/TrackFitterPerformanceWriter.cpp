@@ -36,6 +36,7 @@ FW::TrackFitterPerformanceWriter::TrackFitterPerformanceWriter(
   if (m_cfg.inputParticles.empty()) {
     throw std::invalid_argument("Missing input particles collection");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
   if (m_cfg.outputFilename.empty()) {
     throw std::invalid_argument("Missing output filename");
   }
@@ -83,8 +84,7 @@ FW::ProcessCode FW::TrackFitterPerformanceWriter::endRun() {
 FW::ProcessCode FW::TrackFitterPerformanceWriter::writeT(
     const AlgorithmContext& ctx, const TrajectoryContainer& trajectories) {
   // Read truth particles from input collection
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
 
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 
@@ -31,7 +32,7 @@ namespace FW {
 ///
 /// Safe to use from multiple writer threads - uses a std::mutex lock.
 class RootPlanarClusterWriter
-    : public WriterT<GeometryIdMultimap<Acts::PlanarModuleCluster>> {
+    : public WriterT<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>> {
  public:
   struct Config {
     /// Which cluster collection to write.
@@ -62,11 +63,12 @@ class RootPlanarClusterWriter
   /// @param ctx The Algorithm context with per event information
   /// @param clusters is the data to be written out
   ProcessCode writeT(const AlgorithmContext& ctx,
-                     const GeometryIdMultimap<Acts::PlanarModuleCluster>&
+                     const pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>&
                          clusters) final override;
 
  private:
   Config m_cfg;                    ///< the configuration object
+  ReadHandle<pmr::SimHitContainer> m_inputSimulatedHits;
   std::mutex m_writeMutex;         ///< protect multi-threaded writes
   TFile* m_outputFile;             ///< the output file
   TTree* m_outputTree;             ///< the output tree
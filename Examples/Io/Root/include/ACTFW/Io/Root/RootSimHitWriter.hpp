@@ -28,7 +28,7 @@ namespace FW {
 /// Safe to use from multiple writer threads. To avoid thread-saftey issues,
 /// the writer must be the sole owner of the underlying file. Thus, the
 /// output file pointer can not be given from the outside.
-class RootSimHitWriter final : public WriterT<SimHitContainer> {
+class RootSimHitWriter final : public WriterT<pmr::SimHitContainer> {
  public:
   struct Config {
     /// Input particle collection to write.
@@ -59,7 +59,7 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
   /// @param[in] ctx is the algorithm context
   /// @param[in] hits are the hits to be written
   ProcessCode writeT(const AlgorithmContext& ctx,
-                     const SimHitContainer& hits) final override;
+                     const pmr::SimHitContainer& hits) final override;
 
  private:
   Config m_cfg;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
@@ -69,6 +70,7 @@ class RootTrajectoryWriter final : public WriterT<TrajectoryContainer> {
 
  private:
   Config m_cfg;             ///< The config class
+  ReadHandle<SimParticleContainer> m_inputParticles;
   std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
   TFile* m_outputFile{nullptr};  ///< The output file
   TTree* m_outputTree{nullptr};  ///< The output tree
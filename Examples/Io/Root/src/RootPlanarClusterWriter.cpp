@@ -34,6 +34,7 @@ FW::RootPlanarClusterWriter::RootPlanarClusterWriter(
   if (m_cfg.inputSimulatedHits.empty()) {
     throw std::invalid_argument("Missing simulated hits input collection");
   }
+  declareInput(m_inputSimulatedHits, m_cfg.inputSimulatedHits);
   if (m_cfg.treeName.empty()) {
     throw std::invalid_argument("Missing tree name");
   }
@@ -95,10 +96,9 @@ FW::ProcessCode FW::RootPlanarClusterWriter::endRun() {
 
 FW::ProcessCode FW::RootPlanarClusterWriter::writeT(
     const AlgorithmContext& ctx,
-    const FW::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
+    const FW::pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
   // retrieve simulated hits
-  const auto& simHits =
-      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
+  const auto& simHits = m_inputSimulatedHits(ctx);
 
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
@@ -78,8 +78,8 @@ FW::ProcessCode FW::RootSimHitWriter::endRun() {
   return ProcessCode::SUCCESS;
 }
 
-FW::ProcessCode FW::RootSimHitWriter::writeT(const AlgorithmContext& ctx,
-                                             const FW::SimHitContainer& hits) {
+FW::ProcessCode FW::RootSimHitWriter::writeT(
+    const AlgorithmContext& ctx, const FW::pmr::SimHitContainer& hits) {
   if (not m_outputFile) {
     ACTS_ERROR("Missing output file");
     return ProcessCode::ABORT;
@@ -46,6 +46,7 @@ FW::RootTrajectoryWriter::RootTrajectoryWriter(
   } else if (m_cfg.outputTreename.empty()) {
     throw std::invalid_argument("Missing tree name");
   }
+  declareInput(m_inputParticles, m_cfg.inputParticles);
 
   // Setup ROOT I/O
   if (m_outputFile == nullptr) {
@@ -257,8 +258,7 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
   auto& gctx = ctx.geoContext;
 
   // read truth particles from input collection
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = m_inputParticles(ctx);
 
   // Exclusive access to the tree while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
@@ -42,7 +42,12 @@ void FW::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")(
       "jobs,j", value<int>()->default_value(-1),
-      "Number of parallel jobs, negative for automatic.");
+      "Number of parallel jobs, negative for automatic.")(
+      "events-in-flight", value<size_t>()->default_value(0),
+      "Maximum number of events processed at the same time with in-order "
+      "reading and writing, 0 to process each event within one job.")(
+      "trace-events", value<bool>()->default_value(false),
+      "Write the time spans of all algorithms per event to a trace file.");
 }
 
 void FW::Options::addRandomNumbersOptions(
@@ -179,6 +184,8 @@ FW::Sequencer::Config FW::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.eventsInFlight = vm["events-in-flight"].as<size_t>();
+  cfg.traceEvents = vm["trace-events"].as<bool>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
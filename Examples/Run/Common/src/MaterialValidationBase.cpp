@@ -156,21 +156,16 @@ int materialValidationExample(int argc, char* argv[],
   auto randomNumberSvc =
       std::make_shared<FW::RandomNumbers>(randomNumberSvcCfg);
 
-  // Create BField service
-  auto bFieldVar = FW::Options::readBField(vm);
-
   if (vm["prop-stepper"].template as<int>() == 0) {
     // Straight line stepper was chosen
     setupStraightLinePropagation(sequencer, vm, randomNumberSvc, tGeometry);
   } else {
-    std::visit(
-        [&](auto& bField) {
-          using field_type =
-              typename std::decay_t<decltype(bField)>::element_type;
-          Acts::SharedBField<field_type> fieldMap(bField);
-          setupPropagation(sequencer, fieldMap, vm, randomNumberSvc, tGeometry);
-        },
-        bFieldVar);
+    // Create BField service
+    FW::Options::visitBField(vm, [&](auto& bField) {
+      using field_type = typename std::decay_t<decltype(bField)>::element_type;
+      Acts::SharedBField<field_type> fieldMap(bField);
+      setupPropagation(sequencer, fieldMap, vm, randomNumberSvc, tGeometry);
+    });
   }
 
   // ---------------------------------------------------------------------------------
@@ -68,55 +68,47 @@ int propagationExample(int argc, char* argv[], FW::IBaseDetector& detector) {
   auto randomNumberSvc =
       std::make_shared<FW::RandomNumbers>(randomNumberSvcCfg);
 
-  // Create BField service
-  auto bFieldVar = FW::Options::readBField(vm);
-  // auto field2D = std::get<std::shared_ptr<InterpolatedBFieldMap2D>>(bField);
-  // auto field3D = std::get<std::shared_ptr<InterpolatedBFieldMap3D>>(bField);
-
   // Get a Navigator
   Acts::Navigator navigator(tGeometry);
 
-  std::visit(
-      [&](auto& bField) {
-        // Resolve the bfield map and create the propgator
-        using field_type =
-            typename std::decay_t<decltype(bField)>::element_type;
-        Acts::SharedBField<field_type> fieldMap(bField);
-
-        using field_map_type = decltype(fieldMap);
-
-        std::optional<std::variant<Acts::EigenStepper<field_map_type>,
-                                   Acts::AtlasStepper<field_map_type>,
-                                   Acts::StraightLineStepper>>
-            var_stepper;
-
-        // translate option to variant
-        if (vm["prop-stepper"].template as<int>() == 0) {
-          var_stepper = Acts::StraightLineStepper{};
-        } else if (vm["prop-stepper"].template as<int>() == 1) {
-          var_stepper = Acts::EigenStepper<field_map_type>{std::move(fieldMap)};
-        } else if (vm["prop-stepper"].template as<int>() == 2) {
-          var_stepper = Acts::AtlasStepper<field_map_type>{std::move(fieldMap)};
-        }
-
-        // resolve stepper, setup propagator
-        std::visit(
-            [&](auto& stepper) {
-              using Stepper = std::decay_t<decltype(stepper)>;
-              using Propagator = Acts::Propagator<Stepper, Acts::Navigator>;
-              Propagator propagator(std::move(stepper), std::move(navigator));
-
-              // Read the propagation config and create the algorithms
-              auto pAlgConfig =
-                  FW::Options::readPropagationConfig(vm, propagator);
-              pAlgConfig.randomNumberSvc = randomNumberSvc;
-              sequencer.addAlgorithm(
-                  std::make_shared<FW::PropagationAlgorithm<Propagator>>(
-                      pAlgConfig, logLevel));
-            },
-            *var_stepper);
-      },
-      bFieldVar);
+  // Create BField service
+  FW::Options::visitBField(vm, [&](auto& bField) {
+    // Resolve the bfield map and create the propgator
+    using field_type = typename std::decay_t<decltype(bField)>::element_type;
+    Acts::SharedBField<field_type> fieldMap(bField);
+
+    using field_map_type = decltype(fieldMap);
+
+    std::optional<std::variant<Acts::EigenStepper<field_map_type>,
+                               Acts::AtlasStepper<field_map_type>,
+                               Acts::StraightLineStepper>>
+        var_stepper;
+
+    // translate option to variant
+    if (vm["prop-stepper"].template as<int>() == 0) {
+      var_stepper = Acts::StraightLineStepper{};
+    } else if (vm["prop-stepper"].template as<int>() == 1) {
+      var_stepper = Acts::EigenStepper<field_map_type>{std::move(fieldMap)};
+    } else if (vm["prop-stepper"].template as<int>() == 2) {
+      var_stepper = Acts::AtlasStepper<field_map_type>{std::move(fieldMap)};
+    }
+
+    // resolve stepper, setup propagator
+    std::visit(
+        [&](auto& stepper) {
+          using Stepper = std::decay_t<decltype(stepper)>;
+          using Propagator = Acts::Propagator<Stepper, Acts::Navigator>;
+          Propagator propagator(std::move(stepper), std::move(navigator));
+
+          // Read the propagation config and create the algorithms
+          auto pAlgConfig = FW::Options::readPropagationConfig(vm, propagator);
+          pAlgConfig.randomNumberSvc = randomNumberSvc;
+          sequencer.addAlgorithm(
+              std::make_shared<FW::PropagationAlgorithm<Propagator>>(
+                  pAlgConfig, logLevel));
+        },
+        *var_stepper);
+  });
 
   // ---------------------------------------------------------------------------------
   // Output directory
@@ -204,14 +204,11 @@ void FW::setupSimulation(
     const FW::Options::Variables& variables, FW::Sequencer& sequencer,
     std::shared_ptr<const RandomNumbers> randomNumbers,
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry) {
-  auto magneticFieldVariant = FW::Options::readBField(variables);
-  std::visit(
-      [&](auto&& inputField) {
-        using magnetic_field_t =
-            typename std::decay_t<decltype(inputField)>::element_type;
-        Acts::SharedBField<magnetic_field_t> magneticField(inputField);
-        setupSimulationAlgorithms(variables, sequencer, randomNumbers,
-                                  trackingGeometry, std::move(magneticField));
-      },
-      magneticFieldVariant);
+  FW::Options::visitBField(variables, [&](auto&& inputField) {
+    using magnetic_field_t =
+        typename std::decay_t<decltype(inputField)>::element_type;
+    Acts::SharedBField<magnetic_field_t> magneticField(inputField);
+    setupSimulationAlgorithms(variables, sequencer, randomNumbers,
+                              trackingGeometry, std::move(magneticField));
+  });
 }
@@ -13,12 +13,14 @@
 #include <cstddef>
 
 FW::HelloLoggerAlgorithm::HelloLoggerAlgorithm(Acts::Logging::Level level)
-    : FW::BareAlgorithm("HelloLogger", level) {}
+    : FW::BareAlgorithm("HelloLogger", level) {
+  // using hard-coded data name should be avoided, but i'm a bit lazy tonight.
+  declareInput(m_eventBlock, "eventBlock");
+}
 
 FW::ProcessCode FW::HelloLoggerAlgorithm::execute(
     const AlgorithmContext& ctx) const {
-  // using hard-coded data name should be avoided, but i'm a bit lazy tonight.
-  auto block = ctx.eventStore.get<std::size_t>("eventBlock");
+  auto block = m_eventBlock(ctx);
 
   ACTS_INFO(" Hello World! (from event=" << ctx.eventNumber
                                          << ", block=" << block << ")");
@@ -10,6 +10,7 @@
 
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace FW {
@@ -21,6 +22,9 @@ class HelloLoggerAlgorithm : public FW::BareAlgorithm {
 
   // Log a few messages.
   FW::ProcessCode execute(const AlgorithmContext& ctx) const final override;
+
+ private:
+  ReadHandle<std::size_t> m_eventBlock;
 };
 
 }  // namespace FW
@@ -24,6 +24,7 @@ FW::HelloRandomAlgorithm::HelloRandomAlgorithm(
   if (m_cfg.output.empty()) {
     throw std::invalid_argument("Missing output collection");
   }
+  declareOutput(m_output, m_cfg.output);
 }
 
 FW::ProcessCode FW::HelloRandomAlgorithm::execute(
@@ -66,7 +67,7 @@ FW::ProcessCode FW::HelloRandomAlgorithm::execute(
   }
 
   // transfer generated data to the event store.
-  ctx.eventStore.add(m_cfg.output, std::move(collection));
+  m_output(ctx, std::move(collection));
 
   return FW::ProcessCode::SUCCESS;
 }
@@ -15,6 +15,8 @@
 #include <memory>
 #include <string>
 
+#include "HelloData.hpp"
+
 namespace FW {
 
 /// An example algorithm that uses the random number generator to generate data.
@@ -40,6 +42,7 @@ class HelloRandomAlgorithm : public FW::BareAlgorithm {
 
  private:
   Config m_cfg;
+  WriteHandle<HelloDataCollection> m_output;
 };
 
 }  // namespace FW
@@ -22,13 +22,16 @@ FW::HelloWhiteBoardAlgorithm::HelloWhiteBoardAlgorithm(
   if (m_cfg.output.empty()) {
     throw std::invalid_argument("Missing output collection");
   }
+  // the handles are resolved once by the sequencer before the event loop
+  declareInput(m_input, m_cfg.input);
+  declareOutput(m_output, m_cfg.output);
 }
 
 FW::ProcessCode FW::HelloWhiteBoardAlgorithm::execute(
     const FW::AlgorithmContext& ctx) const {
   // event-store is append-only and always returns a const reference.
   ACTS_INFO("Reading HelloDataCollection " << m_cfg.input);
-  const auto& in = ctx.eventStore.get<HelloDataCollection>(m_cfg.input);
+  const auto& in = m_input(ctx);
   ACTS_VERBOSE("Read HelloDataCollection with size " << in.size());
 
   // create a copy
@@ -37,7 +40,7 @@ FW::ProcessCode FW::HelloWhiteBoardAlgorithm::execute(
   // transfer the copy to the event store. this always transfers ownership
   // via r-value reference/ move construction.
   ACTS_INFO("Writing HelloDataCollection " << m_cfg.output);
-  ctx.eventStore.add(m_cfg.output, std::move(copy));
+  m_output(ctx, std::move(copy));
 
   return FW::ProcessCode::SUCCESS;
 }
@@ -13,6 +13,8 @@
 
 #include <memory>
 
+#include "HelloData.hpp"
+
 namespace FW {
 
 /// Example algorithm that reads/writes data from/to the event store.
@@ -33,6 +35,8 @@ class HelloWhiteBoardAlgorithm : public FW::BareAlgorithm {
 
  private:
   Config m_cfg;
+  ReadHandle<HelloDataCollection> m_input;
+  WriteHandle<HelloDataCollection> m_output;
 };
 
 }  // namespace FW
@@ -149,7 +149,7 @@ int main(int argc, char* argv[]) {
   // per-event access patterns this should be switched to a proper
   // Sequencer-based tool. Otherwise it should be removed.
   auto nEvents = FW::Options::readSequencerConfig(vm).events;
-  auto bFieldVar = FW::Options::readBField(vm);
+  auto bFieldVar = FW::Options::readBFieldMap(vm);
 
   // Get the phi and eta range
   auto phir = vm["bf-phi-range"].as<read_range>();
@@ -171,23 +171,15 @@ int main(int argc, char* argv[]) {
 
   return std::visit(
       [&](auto& bField) -> int {
-        using field_type =
-            typename std::decay_t<decltype(bField)>::element_type;
-        if constexpr (!std::is_same_v<field_type, InterpolatedBFieldMap2D> &&
-                      !std::is_same_v<field_type, InterpolatedBFieldMap3D>) {
-          std::cout << "Bfield map could not be read. Exiting." << std::endl;
-          return EXIT_FAILURE;
-        } else {
-          // Step-wise access pattern
-          accessStepWise(*bField, magFieldContext, nEvents, theta_steps,
-                         thetar[0], theta_step, phi_steps, phir[0], phi_step,
-                         access_steps, access_step);
-          // Random access pattern
-          accessRandom(*bField, magFieldContext,
-                       nEvents * theta_steps * phi_steps * access_steps,
-                       track_length);
-          return EXIT_SUCCESS;
-        }
+        // Step-wise access pattern
+        accessStepWise(*bField, magFieldContext, nEvents, theta_steps,
+                       thetar[0], theta_step, phi_steps, phir[0], phi_step,
+                       access_steps, access_step);
+        // Random access pattern
+        accessRandom(*bField, magFieldContext,
+                     nEvents * theta_steps * phi_steps * access_steps,
+                     track_length);
+        return EXIT_SUCCESS;
       },
       bFieldVar);
 }
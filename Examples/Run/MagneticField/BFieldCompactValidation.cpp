@@ -0,0 +1,148 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Options/CommonOptions.hpp"
+#include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <boost/program_options.hpp>
+
+/// The main executable
+///
+/// Reads an InterpolatedBFieldMap from a txt or root file, converts it to
+/// the compact single precision and 16 bit fixed-point storage and reports
+/// the memory footprint and the maximum deviation of the compact maps from
+/// the double precision map at the grid points and at random positions.
+
+namespace po = boost::program_options;
+
+using UniformDist = std::uniform_real_distribution<double>;
+using RandomEngine = std::mt19937;
+
+/// Generate a random global position inside the range of the field map
+template <typename mapper_t>
+Acts::Vector3D randomPosition(const mapper_t& mapper, RandomEngine& rng) {
+  const auto min = mapper.getMin();
+  const auto max = mapper.getMax();
+  if constexpr (mapper_t::DIM_POS == 2) {
+    // (r,z) map, with r possibly extended to negative values
+    const double r = UniformDist(std::max(min[0], 0.), max[0])(rng);
+    const double phi = UniformDist(-M_PI, M_PI)(rng);
+    const double z = UniformDist(min[1], max[1])(rng);
+    return Acts::Vector3D(r * std::cos(phi), r * std::sin(phi), z);
+  } else {
+    return Acts::Vector3D(UniformDist(min[0], max[0])(rng),
+                          UniformDist(min[1], max[1])(rng),
+                          UniformDist(min[2], max[2])(rng));
+  }
+}
+
+/// Compare the compact version of the field map with the original one
+template <typename scalar_t, typename mapper_t>
+void validate(const mapper_t& mapper, const std::string& name,
+              size_t nPoints) {
+  const auto compact = Acts::compactFieldMapper<scalar_t>(mapper);
+  using Compact = std::decay_t<decltype(compact)>;
+
+  const auto& grid = mapper.getGrid();
+  const auto& compactGrid = compact.getGrid();
+  const double sizeMB =
+      grid.size() * sizeof(typename mapper_t::StoredType) / 1.e6;
+  const double compactSizeMB =
+      compactGrid.size() * sizeof(typename Compact::StoredType) / 1.e6;
+
+  // deviation of the stored values at the grid points
+  double maxNodeDeviation = 0.;
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    const auto original = mapper.getStorage().decode(grid.at(bin));
+    const auto stored = compact.getStorage().decode(compactGrid.at(bin));
+    maxNodeDeviation =
+        std::max(maxNodeDeviation, (stored - original).cwiseAbs().maxCoeff());
+  }
+
+  // deviation of the interpolated field at random positions
+  RandomEngine rng;
+  double maxDeviation = 0.;
+  double maxRelDeviation = 0.;
+  size_t nChecked = 0;
+  for (size_t i = 0; i < nPoints; ++i) {
+    const Acts::Vector3D position = randomPosition(mapper, rng);
+    if (not mapper.isInside(position)) {
+      continue;
+    }
+    const Acts::Vector3D field = mapper.getField(position);
+    const double deviation = (compact.getField(position) - field).norm();
+    maxDeviation = std::max(maxDeviation, deviation);
+    if (field.norm() > 0.) {
+      maxRelDeviation = std::max(maxRelDeviation, deviation / field.norm());
+    }
+    ++nChecked;
+  }
+
+  std::cout << "[" << name << "] grid values: " << sizeMB << " MB -> "
+            << compactSizeMB << " MB" << std::endl;
+  std::cout << "[" << name << "] max. deviation at grid points: "
+            << maxNodeDeviation / Acts::UnitConstants::T << " T" << std::endl;
+  std::cout << "[" << name << "] max. deviation at " << nChecked
+            << " random positions: " << maxDeviation / Acts::UnitConstants::T
+            << " T (relative: " << maxRelDeviation << ")" << std::endl;
+}
+
+/// @brief main executable
+///
+/// @param argc The argument count
+/// @param argv The argument list
+int main(int argc, char* argv[]) {
+  // Declare the supported program options.
+  auto desc = FW::Options::makeDefaultOptions();
+  FW::Options::addBFieldOptions(desc);
+  desc.add_options()("bf-validation-points",
+                     po::value<size_t>()->default_value(1000000),
+                     "number of random positions at which the compact field "
+                     "maps are compared to the original one.");
+  auto vm = FW::Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  auto bFieldVar = FW::Options::readBFieldMap(vm);
+  size_t nPoints = vm["bf-validation-points"].as<size_t>();
+
+  return std::visit(
+      [&](auto& bField) -> int {
+        using field_type =
+            typename std::decay_t<decltype(bField)>::element_type;
+        if constexpr (!std::is_same_v<field_type, InterpolatedBFieldMap2D> &&
+                      !std::is_same_v<field_type, InterpolatedBFieldMap3D>) {
+          // only maps holding their own double precision values can be
+          // converted into compact maps
+          std::cout << "Bfield map with double precision values could not "
+                       "be read from a '.root', '.txt' or '.csv' file. "
+                       "Exiting."
+                    << std::endl;
+          return EXIT_FAILURE;
+        } else {
+          const auto mapper = bField->getMapper();
+          validate<float>(mapper, "float32", nPoints);
+          validate<int16_t>(mapper, "int16", nPoints);
+          return EXIT_SUCCESS;
+        }
+      },
+      bFieldVar);
+}
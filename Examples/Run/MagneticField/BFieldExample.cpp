@@ -36,7 +36,8 @@ int main(int argc, char* argv[]) {
   FW::Options::addBFieldOptions(desc);
   desc.add_options()("bf-file-out",
                      value<std::string>()->default_value("BFieldOut.root"),
-                     "Set this name for an output root file.")(
+                     "Set this name for an output root file, or use a '.bfm' "
+                     "extension to write a binary map for memory mapping.")(
       "bf-map-out", value<std::string>()->default_value("bField"),
       "Set this name for the tree in the out file.")(
       "bf-out-rz", value<bool>()->default_value(false),
@@ -69,20 +70,14 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  auto bFieldVar = FW::Options::readBField(vm);
+  auto bFieldVar = FW::Options::readBFieldMap(vm);
 
   return std::visit(
       [&](auto& bField) -> int {
         using field_type =
             typename std::decay_t<decltype(bField)>::element_type;
-        if constexpr (!std::is_same_v<field_type, InterpolatedBFieldMap2D> &&
-                      !std::is_same_v<field_type, InterpolatedBFieldMap3D>) {
-          std::cout << "Bfield map could not be read. Exiting." << std::endl;
-          return EXIT_FAILURE;
-        } else {
-          FW::BField::writeField<field_type>(vm, bField);
-          return EXIT_SUCCESS;
-        }
+        FW::BField::writeField<field_type>(vm, bField);
+        return EXIT_SUCCESS;
       },
       bFieldVar);
 }
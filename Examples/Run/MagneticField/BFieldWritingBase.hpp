@@ -9,8 +9,13 @@
 #pragma once
 
 #include "ACTFW/Io/Root/RootBFieldWriter.hpp"
+#include "ACTFW/Plugins/BField/BinaryBFieldWriter.hpp"
 #include "ACTFW/Utilities/Options.hpp"
 
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
 #include <boost/program_options.hpp>
 
 namespace FW {
@@ -19,6 +24,23 @@ namespace BField {
 template <typename bfield_t>
 void writeField(boost::program_options::variables_map vm,
                 std::shared_ptr<const bfield_t> bField) {
+  // binary maps are written on their own grid without resampling
+  const auto fileName = vm["bf-file-out"].template as<std::string>();
+  if (fileName.find(".bfm") != std::string::npos) {
+    using Grid_t = std::decay_t<decltype(bField->getMapper().getGrid())>;
+    if constexpr (std::is_same_v<typename Grid_t::value_type::Scalar,
+                                 double>) {
+      typename FW::BinaryBFieldWriter<bfield_t>::Config binaryConfig;
+      binaryConfig.fileName = fileName;
+      binaryConfig.bField = bField;
+      FW::BinaryBFieldWriter<bfield_t>::run(binaryConfig);
+      return;
+    } else {
+      throw std::invalid_argument(
+          "Binary field maps store double precision values");
+    }
+  }
+
   using Writer = FW::RootBFieldWriter<bfield_t>;
   using Config = typename Writer::Config;
   using GridType = typename Writer::GridType;
@@ -17,6 +17,8 @@
 #include "ACTFW/Io/Performance/CKFPerformanceWriter.hpp"
 #include "ACTFW/Options/CommonOptions.hpp"
 #include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "ACTFW/Seeding/SeedingAlgorithm.hpp"
+#include "ACTFW/Seeding/SeedingOptions.hpp"
 #include "ACTFW/TrackFinding/TrackFindingAlgorithm.hpp"
 #include "ACTFW/TrackFinding/TrackFindingOptions.hpp"
 #include "ACTFW/TruthTracking/ParticleSmearing.hpp"
@@ -26,11 +28,16 @@
 #include <Acts/Utilities/Units.hpp>
 
 #include <memory>
+#include <string>
+
+#include <boost/program_options.hpp>
 
 using namespace Acts::UnitLiterals;
 using namespace FW;
 
 int main(int argc, char* argv[]) {
+  using boost::program_options::value;
+
   GenericDetector detector;
 
   // setup and parse options
@@ -44,6 +51,11 @@ int main(int argc, char* argv[]) {
   detector.addOptions(desc);
   Options::addBFieldOptions(desc);
   Options::addTrackFindingOptions(desc);
+  Options::addSeedingOptions(desc);
+  desc.add_options()(
+      "ckf-truth-seeds", value<bool>()->default_value(true),
+      "Start the track finding from the smeared truth particles; otherwise "
+      "from the track parameters estimated by the triplet seeding.");
 
   auto vm = Options::parse(desc, argc, argv);
   if (vm.empty()) {
@@ -66,9 +78,6 @@ int main(int argc, char* argv[]) {
   for (auto cdr : geometry.second) {
     sequencer.addContextDecorator(cdr);
   }
-  // Setup the magnetic field
-  auto magneticField = Options::readBField(vm);
-
   // Read particles (initial states) and clusters from CSV files
   auto particleReader = Options::readCsvParticleReaderConfig(vm);
   particleReader.inputStem = "particles_initial";
@@ -112,35 +121,55 @@ int main(int argc, char* argv[]) {
       std::make_shared<HitSmearing>(hitSmearingCfg, logLevel));
 
   const auto& inputParticles = particleSelectorCfg.outputParticles;
-  // Create smeared particles states
-  ParticleSmearing::Config particleSmearingCfg;
-  particleSmearingCfg.inputParticles = inputParticles;
-  particleSmearingCfg.outputTrackParameters = "smearedparameters";
-  particleSmearingCfg.randomNumbers = rnd;
-  // Gaussian sigmas to smear particle parameters
-  particleSmearingCfg.sigmaD0 = 20_um;
-  particleSmearingCfg.sigmaD0PtA = 30_um;
-  particleSmearingCfg.sigmaD0PtB = 0.3 / 1_GeV;
-  particleSmearingCfg.sigmaZ0 = 20_um;
-  particleSmearingCfg.sigmaZ0PtA = 30_um;
-  particleSmearingCfg.sigmaZ0PtB = 0.3 / 1_GeV;
-  particleSmearingCfg.sigmaPhi = 1_degree;
-  particleSmearingCfg.sigmaTheta = 1_degree;
-  particleSmearingCfg.sigmaPRel = 0.01;
-  particleSmearingCfg.sigmaT0 = 1_ns;
-  sequencer.addAlgorithm(
-      std::make_shared<ParticleSmearing>(particleSmearingCfg, logLevel));
+  std::string initialTrackParameters;
+  if (vm["ckf-truth-seeds"].as<bool>()) {
+    // Create smeared particles states
+    ParticleSmearing::Config particleSmearingCfg;
+    particleSmearingCfg.inputParticles = inputParticles;
+    particleSmearingCfg.outputTrackParameters = "smearedparameters";
+    particleSmearingCfg.randomNumbers = rnd;
+    // Gaussian sigmas to smear particle parameters
+    particleSmearingCfg.sigmaD0 = 20_um;
+    particleSmearingCfg.sigmaD0PtA = 30_um;
+    particleSmearingCfg.sigmaD0PtB = 0.3 / 1_GeV;
+    particleSmearingCfg.sigmaZ0 = 20_um;
+    particleSmearingCfg.sigmaZ0PtA = 30_um;
+    particleSmearingCfg.sigmaZ0PtB = 0.3 / 1_GeV;
+    particleSmearingCfg.sigmaPhi = 1_degree;
+    particleSmearingCfg.sigmaTheta = 1_degree;
+    particleSmearingCfg.sigmaPRel = 0.01;
+    particleSmearingCfg.sigmaT0 = 1_ns;
+    sequencer.addAlgorithm(
+        std::make_shared<ParticleSmearing>(particleSmearingCfg, logLevel));
+    initialTrackParameters = particleSmearingCfg.outputTrackParameters;
+  } else {
+    // Find seeds from the smeared measurements and estimate their parameters
+    auto seedingCfg = Options::readSeedingConfig(vm);
+    seedingCfg.inputSourceLinks = hitSmearingCfg.outputSourceLinks;
+    seedingCfg.outputProtoTracks = "seeds";
+    seedingCfg.outputTrackParameters = "estimatedparameters";
+    sequencer.addAlgorithm(
+        std::make_shared<SeedingAlgorithm>(seedingCfg, logLevel));
+    initialTrackParameters = seedingCfg.outputTrackParameters;
+  }
 
   // Setup the track finding algorithm with CKF
   // It takes all the source links created from truth hit smearing, seeds from
-  // truth particle smearing and source link selection config
+  // truth particle smearing or the seeding and source link selection config
   auto trackFindingCfg = Options::readTrackFindingConfig(vm);
   trackFindingCfg.inputSourceLinks = hitSmearingCfg.outputSourceLinks;
-  trackFindingCfg.inputInitialTrackParameters =
-      particleSmearingCfg.outputTrackParameters;
+  trackFindingCfg.inputInitialTrackParameters = initialTrackParameters;
   trackFindingCfg.outputTrajectories = "trajectories";
-  trackFindingCfg.findTracks = TrackFindingAlgorithm::makeTrackFinderFunction(
-      trackingGeometry, magneticField, logLevel);
+  // field maps that are not in the job field variant are read separately
+  if (Options::useBFieldMap(vm)) {
+    trackFindingCfg.findTracks =
+        TrackFindingAlgorithm::makeTrackFinderFunction(
+            trackingGeometry, Options::readBFieldMap(vm), logLevel);
+  } else {
+    trackFindingCfg.findTracks =
+        TrackFindingAlgorithm::makeTrackFinderFunction(
+            trackingGeometry, Options::readBField(vm), logLevel);
+  }
   sequencer.addAlgorithm(
       std::make_shared<TrackFindingAlgorithm>(trackFindingCfg, logLevel));
 
@@ -66,9 +66,6 @@ int main(int argc, char* argv[]) {
   for (auto cdr : geometry.second) {
     sequencer.addContextDecorator(cdr);
   }
-  // Setup the magnetic field
-  auto magneticField = Options::readBField(vm);
-
   // Read particles (initial states) and clusters from CSV files
   auto particleReader = Options::readCsvParticleReaderConfig(vm);
   particleReader.inputStem = "particles_initial";
@@ -135,8 +132,14 @@ int main(int argc, char* argv[]) {
   fitter.inputInitialTrackParameters =
       particleSmearingCfg.outputTrackParameters;
   fitter.outputTrajectories = "trajectories";
-  fitter.fit = FittingAlgorithm::makeFitterFunction(trackingGeometry,
-                                                    magneticField, logLevel);
+  // field maps that are not in the job field variant are read separately
+  if (Options::useBFieldMap(vm)) {
+    fitter.fit = FittingAlgorithm::makeFitterFunction(
+        trackingGeometry, Options::readBFieldMap(vm), logLevel);
+  } else {
+    fitter.fit = FittingAlgorithm::makeFitterFunction(
+        trackingGeometry, Options::readBField(vm), logLevel);
+  }
   sequencer.addAlgorithm(std::make_shared<FittingAlgorithm>(fitter, logLevel));
 
   // write tracks from fitting
@@ -0,0 +1,190 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// End-to-end benchmark of the seeding on the generic detector: the events
+// are generated, simulated with Fatras and digitized, and the clusters are
+// passed to the SeedingAlgorithm. Only the SeedingAlgorithm is timed, i.e.
+// the space point creation, the grouping and the seed finding.
+
+#include "ACTFW/EventData/ProtoTrack.hpp"
+#include "ACTFW/Fatras/FatrasOptions.hpp"
+#include "ACTFW/Framework/IAlgorithm.hpp"
+#include "ACTFW/Framework/RandomNumbers.hpp"
+#include "ACTFW/Framework/Sequencer.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/GenericDetector/GenericDetector.hpp"
+#include "ACTFW/Generators/ParticleSelector.hpp"
+#include "ACTFW/Geometry/CommonGeometry.hpp"
+#include "ACTFW/Options/CommonOptions.hpp"
+#include "ACTFW/Options/ParticleGunOptions.hpp"
+#include "ACTFW/Options/Pythia8Options.hpp"
+#include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "ACTFW/Seeding/SeedingAlgorithm.hpp"
+#include "ACTFW/Seeding/SeedingOptions.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "FatrasDigitizationBase.hpp"
+#include "FatrasEvgenBase.hpp"
+#include "FatrasSimulationBase.hpp"
+
+namespace {
+
+/// Accumulated seeding time and number of seeds of all events.
+struct SeedingStatistics {
+  std::atomic<uint64_t> nEvents{0};
+  std::atomic<uint64_t> nSeeds{0};
+  std::atomic<uint64_t> nanoseconds{0};
+};
+
+/// Run the seeding algorithm and record its time and number of seeds.
+class TimedSeeding final : public FW::IAlgorithm {
+ public:
+  TimedSeeding(std::shared_ptr<FW::SeedingAlgorithm> seeding,
+               std::string outputProtoTracks,
+               std::shared_ptr<SeedingStatistics> statistics)
+      : m_seeding(std::move(seeding)),
+        m_outputProtoTracks(std::move(outputProtoTracks)),
+        m_statistics(std::move(statistics)) {}
+
+  std::string name() const final override { return m_seeding->name(); }
+
+  FW::ProcessCode execute(
+      const FW::AlgorithmContext& ctx) const final override {
+    const auto start = std::chrono::steady_clock::now();
+    const auto code = m_seeding->execute(ctx);
+    const auto stop = std::chrono::steady_clock::now();
+    if (code != FW::ProcessCode::SUCCESS) {
+      return code;
+    }
+    const auto& seeds = ctx.eventStore.get<FW::pmr::ProtoTrackContainer>(
+        m_outputProtoTracks);
+    m_statistics->nEvents += 1;
+    m_statistics->nSeeds += seeds.size();
+    m_statistics->nanoseconds +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+            .count();
+    return code;
+  }
+
+  std::vector<std::string> inputs() const final override {
+    return m_seeding->inputs();
+  }
+
+  std::vector<std::string> outputs() const final override {
+    return m_seeding->outputs();
+  }
+
+  void resolveHandles(FW::WhiteBoardRegistry& registry) final override {
+    m_seeding->resolveHandles(registry);
+  }
+
+ private:
+  std::shared_ptr<FW::SeedingAlgorithm> m_seeding;
+  std::string m_outputProtoTracks;
+  std::shared_ptr<SeedingStatistics> m_statistics;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  using boost::program_options::value;
+
+  auto detector = std::make_shared<GenericDetector>();
+
+  // setup and parse options
+  auto desc = FW::Options::makeDefaultOptions();
+  FW::Options::addSequencerOptions(desc);
+  FW::Options::addGeometryOptions(desc);
+  FW::Options::addMaterialOptions(desc);
+  FW::Options::addParticleGunOptions(desc);
+  FW::Options::addPythia8Options(desc);
+  FW::Options::addRandomNumbersOptions(desc);
+  FW::Options::addBFieldOptions(desc);
+  FW::ParticleSelector::addOptions(desc);
+  FW::Options::addFatrasOptions(desc);
+  FW::Options::addOutputOptions(desc);
+  FW::Options::addSeedingOptions(desc);
+  desc.add_options()("evg-input-type",
+                     value<std::string>()->default_value("pythia8"),
+                     "Type of evgen input 'gun', 'pythia8'");
+  detector->addOptions(desc);
+  auto vm = FW::Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  FW::Sequencer sequencer(FW::Options::readSequencerConfig(vm));
+
+  auto logLevel = FW::Options::readLogLevel(vm);
+  auto randomNumbers = std::make_shared<FW::RandomNumbers>(
+      FW::Options::readRandomNumbersConfig(vm));
+
+  // The geometry, material and decoration
+  auto geometry = FW::Geometry::build(vm, *detector);
+  auto trackingGeometry = geometry.first;
+  for (auto cdr : geometry.second) {
+    sequencer.addContextDecorator(cdr);
+  }
+
+  // the digitization writers need the output directory
+  FW::ensureWritableDirectory(vm["output-dir"].as<std::string>());
+
+  // Generate, simulate and digitize the events; the clusters are stored
+  // as "clusters" on the event store.
+  FW::setupEvgenInput(vm, sequencer, randomNumbers);
+  FW::setupSimulation(vm, sequencer, randomNumbers, trackingGeometry);
+  FW::setupDigitization(vm, sequencer, randomNumbers, trackingGeometry);
+
+  // Find the seeds from the digitized clusters
+  auto seedingCfg = FW::Options::readSeedingConfig(vm);
+  seedingCfg.inputClusters = "clusters";
+  seedingCfg.outputProtoTracks = "seeds";
+  auto statistics = std::make_shared<SeedingStatistics>();
+  sequencer.addAlgorithm(std::make_shared<TimedSeeding>(
+      std::make_shared<FW::SeedingAlgorithm>(seedingCfg, logLevel),
+      seedingCfg.outputProtoTracks, statistics));
+
+  const auto start = std::chrono::steady_clock::now();
+  const int status = sequencer.run();
+  const std::chrono::duration<double> wallTime =
+      std::chrono::steady_clock::now() - start;
+  if (status != EXIT_SUCCESS) {
+    return status;
+  }
+
+  const uint64_t nEvents = statistics->nEvents;
+  if (nEvents == 0) {
+    std::cerr << "No events were processed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const uint64_t nSeeds = statistics->nSeeds;
+  const double seedingTime = 1e-9 * statistics->nanoseconds;
+  std::cout << "Seeding benchmark on the generic detector\n"
+            << "  events:                   " << nEvents << '\n'
+            << "  seeds per event:          "
+            << static_cast<double>(nSeeds) / nEvents << '\n'
+            << "  seeding time per event:   " << 1000 * seedingTime / nEvents
+            << " ms\n"
+            << "  seeding throughput:       " << nSeeds / seedingTime
+            << " seeds/s\n"
+            << "  wall time per event:      "
+            << 1000 * wallTime.count() / nEvents
+            << " ms (incl. simulation and digitization)" << std::endl;
+  return EXIT_SUCCESS;
+}
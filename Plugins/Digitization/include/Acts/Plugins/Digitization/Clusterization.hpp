@@ -23,9 +23,13 @@ namespace Acts {
 /// cut (excluding cells which fall below threshold) can be applied. The
 /// function is templated on the digitization cell type to allow users to use
 /// their own implementation of Acts::DigitizationCell.
+/// The cells which are not used yet are sorted and clustered with the
+/// union-find labelling of the sorted cells below, they are flagged as used
+/// if they pass the energy cut.
 /// @tparam Cell the digitization cell
 /// @param [in] cellMap map of all cells per cell ID on module
-/// @param [in] nBins0 number of bins in direction 0
+/// @param [in] nBins0 number of bins in direction 0, not needed as the cells
+/// know their channels
 /// @param [in] commonCorner flag indicating if also cells sharing a common
 /// corner should be merged into one cluster
 /// @param [in] energyCut possible energy cut to be applied
@@ -36,8 +40,46 @@ std::vector<std::vector<cell_t>> createClusters(
     std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
     bool commonCorner = true, double energyCut = 0.);
 
+/// @brief create clusters from sorted cells
+/// This function bundles neighbouring cells of a module into clusters using a
+/// two-pass union-find (Hoshen-Kopelman) connected component labelling. The
+/// first pass joins each cell with its neighbours among the cells before it,
+/// i.e. in the same and in the previous column, the second pass collects the
+/// cells of each cluster. It needs neither hashing nor recursion and runs in
+/// (almost) linear time in the number of cells.
+/// @tparam cell_t the digitization cell
+/// @param [in] cells all cells of the module, each channel only once, sorted
+/// by channel0 (the column) and then by channel1 (the row)
+/// @param [in] commonCorner flag indicating if also cells sharing a common
+/// corner should be merged into one cluster
+/// @param [in] energyCut possible energy cut to be applied
+/// @return vector (the different clusters) of vector of digitization cells (the
+/// cells which belong to each cluster), ordered by their first cell
+template <typename cell_t>
+std::vector<std::vector<cell_t>> createClusters(
+    const std::vector<cell_t>& cells, bool commonCorner = true,
+    double energyCut = 0.);
+
+/// @brief create clusters from sorted cells of many modules
+/// This function clusters the cells of many modules at once, like the single
+/// module version above, and reuses the labelling memory between them.
+/// @tparam cell_t the digitization cell
+/// @param [in] cells the cells of all modules, sorted within each module as
+/// for the single module version
+/// @param [in] moduleOffsets the cells of module i are at the indices from
+/// moduleOffsets[i] to moduleOffsets[i + 1], i.e. there is one more offset
+/// than modules
+/// @param [in] commonCorner flag indicating if also cells sharing a common
+/// corner should be merged into one cluster
+/// @param [in] energyCut possible energy cut to be applied
+/// @return the clusters of each module
+template <typename cell_t>
+std::vector<std::vector<std::vector<cell_t>>> createClusters(
+    const std::vector<cell_t>& cells, const std::vector<size_t>& moduleOffsets,
+    bool commonCorner = true, double energyCut = 0.);
+
 /// @brief fillCluster
-/// This function is a helper function internally used by Acts::createClusters.
+/// This function is a helper function for clustering the cells of a hash map.
 /// It does connected component labelling using a hash map in order to find out
 /// which cells are neighbours. This function is called recursively by all
 /// neighbours of the current cell. The function is templated on the
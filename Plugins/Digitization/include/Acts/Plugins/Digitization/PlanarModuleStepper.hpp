@@ -39,6 +39,10 @@ class PlanarModuleStepper {
 
   /// Calculate the steps caused by this track - full simulation interface
   ///
+  /// The crossed cells are walked through along the track in the bins of
+  /// the segmentation, the cell boundaries in x are tilted by the lorentz
+  /// angle like the segmentation surfaces of the module.
+  ///
   /// @param gctx The current geometry context object, e.g. alignment
   /// @param dmodule is the digitization module
   /// @param startPoint is the starting position of the stepping
@@ -7,34 +7,156 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <algorithm>
+#include <limits>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+namespace Acts {
+namespace detail {
+
+/// Cluster the sorted cells of one module with union-find labelling and add
+/// the clusters to the output, the label vectors are reused between modules.
+template <typename cell_t>
+void clusterSortedCells(const cell_t* cells, size_t nCells, bool commonCorner,
+                        double energyCut, std::vector<size_t>& parents,
+                        std::vector<size_t>& clusterIndices,
+                        std::vector<std::vector<cell_t>>& clusters) {
+  // cells below the energy cut are not labelled
+  constexpr size_t unlabelled = std::numeric_limits<size_t>::max();
+  parents.assign(nCells, unlabelled);
+  clusterIndices.resize(nCells);
+
+  // the root of the cluster of a cell, halving the path on the way. The
+  // parent of a cell always comes first, the root is the first cell.
+  auto findRoot = [&](size_t i) {
+    while (parents[i] != i) {
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  };
+  auto join = [&](size_t i, size_t j) {
+    const size_t rootI = findRoot(i);
+    const size_t rootJ = findRoot(j);
+    if (rootI < rootJ) {
+      parents[rootJ] = rootI;
+    } else {
+      parents[rootI] = rootJ;
+    }
+  };
+
+  // first pass: label the cells and join them with their neighbours before
+  // them, the ones in the previous column are looked up from a running
+  // position in its cells as the rows increase within each column
+  size_t columnBegin = 0;
+  size_t previousBegin = 0;
+  size_t previousEnd = 0;
+  for (size_t i = 0; i < nCells; ++i) {
+    const cell_t& cell = cells[i];
+    if (i > 0 and cells[i - 1].channel0 != cell.channel0) {
+      // a new column, the previous one is only kept if it is adjacent
+      const bool adjacent = cells[i - 1].channel0 + 1 == cell.channel0;
+      previousBegin = adjacent ? columnBegin : i;
+      previousEnd = i;
+      columnBegin = i;
+    }
+    if (cell.depositedEnergy() < energyCut) {
+      continue;
+    }
+    parents[i] = i;
+    // the previous cell in the same column
+    if (i > columnBegin and cells[i - 1].channel1 + 1 == cell.channel1 and
+        parents[i - 1] != unlabelled) {
+      join(i, i - 1);
+    }
+    // the cells in the previous column
+    const size_t rowMin = (commonCorner and cell.channel1 > 0)
+                              ? cell.channel1 - 1
+                              : cell.channel1;
+    const size_t rowMax = commonCorner ? cell.channel1 + 1 : cell.channel1;
+    while (previousBegin < previousEnd and
+           cells[previousBegin].channel1 < rowMin) {
+      ++previousBegin;
+    }
+    for (size_t j = previousBegin;
+         j < previousEnd and cells[j].channel1 <= rowMax; ++j) {
+      if (parents[j] != unlabelled) {
+        join(i, j);
+      }
+    }
+  }
+
+  // second pass: collect the cells, the cluster of a root is created when
+  // the root is reached as it is the first cell of the cluster
+  for (size_t i = 0; i < nCells; ++i) {
+    if (parents[i] == unlabelled) {
+      continue;
+    }
+    const size_t root = findRoot(i);
+    if (root == i) {
+      clusterIndices[i] = clusters.size();
+      clusters.emplace_back();
+    }
+    clusters[clusterIndices[root]].push_back(cells[i]);
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
+
 template <typename cell_t>
 std::vector<std::vector<cell_t>> Acts::createClusters(
-    std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
-    bool commonCorner, double energyCut) {
-  // the output
-  std::vector<std::vector<cell_t>> mergedCells;
-  // now go through cells and label
+    std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap,
+    size_t /*nBins0*/, bool commonCorner, double energyCut) {
+  // collect the cells which are not used yet
+  std::vector<cell_t> cells;
+  cells.reserve(cellMap.size());
   for (auto& cell : cellMap) {
-    // check if the cell was already used
-    if (!(cell.second.second) &&
-        (cell.second.first.depositedEnergy() >= energyCut)) {
-      // create new cluster
-      mergedCells.push_back(std::vector<cell_t>());
-      // add current cell to current cluster
-      mergedCells.back().push_back(cell.second.first);
-      // set cell to be used already
-      cell.second.second = true;
-      // fill all cells belonging to that cluster
-      fillCluster(mergedCells, cellMap, cell.first, nBins0, commonCorner,
-                  energyCut);
+    if (!(cell.second.second)) {
+      cells.push_back(cell.second.first);
+      // set cell to be used already if it is added to a cluster
+      cell.second.second = (cell.second.first.depositedEnergy() >= energyCut);
     }
   }
+  std::sort(cells.begin(), cells.end(),
+            [](const cell_t& lhs, const cell_t& rhs) {
+              return std::tie(lhs.channel0, lhs.channel1) <
+                     std::tie(rhs.channel0, rhs.channel1);
+            });
   // return the grouped together cells
-  return mergedCells;
+  return createClusters(cells, commonCorner, energyCut);
+}
+
+template <typename cell_t>
+std::vector<std::vector<cell_t>> Acts::createClusters(
+    const std::vector<cell_t>& cells, bool commonCorner, double energyCut) {
+  std::vector<std::vector<cell_t>> clusters;
+  std::vector<size_t> parents;
+  std::vector<size_t> clusterIndices;
+  detail::clusterSortedCells(cells.data(), cells.size(), commonCorner,
+                             energyCut, parents, clusterIndices, clusters);
+  return clusters;
+}
+
+template <typename cell_t>
+std::vector<std::vector<std::vector<cell_t>>> Acts::createClusters(
+    const std::vector<cell_t>& cells, const std::vector<size_t>& moduleOffsets,
+    bool commonCorner, double energyCut) {
+  std::vector<std::vector<std::vector<cell_t>>> moduleClusters;
+  moduleClusters.reserve(moduleOffsets.size());
+  // the label memory is shared by all modules
+  std::vector<size_t> parents;
+  std::vector<size_t> clusterIndices;
+  for (size_t im = 0; im + 1 < moduleOffsets.size(); ++im) {
+    auto& clusters = moduleClusters.emplace_back();
+    detail::clusterSortedCells(cells.data() + moduleOffsets[im],
+                               moduleOffsets[im + 1] - moduleOffsets[im],
+                               commonCorner, energyCut, parents,
+                               clusterIndices, clusters);
+  }
+  return moduleClusters;
 }
 
 template <typename cell_t>
@@ -17,55 +17,96 @@
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 Acts::PlanarModuleStepper::PlanarModuleStepper(
     std::unique_ptr<const Logger> mlogger)
     : m_logger(std::move(mlogger)) {}
 
 std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
-    const GeometryContext& gctx, const DigitizationModule& dmodule,
+    const GeometryContext& /*gctx*/, const DigitizationModule& dmodule,
     const Vector3D& startPoint, const Vector3D& endPoint) const {
   // create the return vector
   std::vector<DigitizationStep> cSteps;
 
-  // get the test surfaces for bin intersections
-  auto& stepSurfaces = dmodule.stepSurfaces(startPoint, endPoint);
-
-  // the track direction
-  Vector3D trackDirection((endPoint - startPoint).normalized());
+  // The cell boundaries in x are tilted by the lorentz angle, they are
+  // straight lines in the position projected along the drift onto the readout
+  // surface. Along the track the projected x and the y position are linear in
+  // the fraction of the step, the crossed boundaries are thus walked through
+  // cell by cell in both directions without any surface intersections.
+  const auto& binningData = dmodule.segmentation().binUtility().binningData();
+  const double readoutZ = dmodule.readoutDirection() * dmodule.halfThickness();
+  const double tanLorentzAngle = std::tan(dmodule.lorentzAngle());
+  auto projected = [&](const Vector3D& position, size_t ib) {
+    return (ib == 0)
+               ? position.x() + (readoutZ - position.z()) * tanLorentzAngle
+               : position.y();
+  };
 
-  // the intersections through the surfaces, start one is the first valid one
-  std::vector<Acts::Intersection> stepIntersections;
-  stepIntersections.reserve(stepSurfaces.size() + 1);
+  // the walk state per binning direction: the next boundary to be crossed,
+  // the direction of the walk, and the step fraction at the crossing
+  struct Walk {
+    const std::vector<float>* boundaries = nullptr;
+    double start = 0.;
+    double delta = 0.;
+    size_t next = 0;
+    int direction = 0;
+    double fraction = std::numeric_limits<double>::infinity();
 
-  // run them - and check for the fast exit
-  for (auto& sSurface : stepSurfaces) {
-    // try it out by intersecting, but do not force the direction
-    auto sIntersection =
-        sSurface->intersect(gctx, startPoint, trackDirection, true);
-    if (bool(sIntersection)) {
-      // now record
-      stepIntersections.push_back(sIntersection.intersection);
-      ACTS_VERBOSE("Boundary Surface intersected with = "
-                   << sIntersection.intersection.position.x() << ", "
-                   << sIntersection.intersection.position.y() << ", "
-                   << sIntersection.intersection.position.z());
+    void update() {
+      // the outer boundaries are the module boundaries, not crossed inside
+      const size_t nBoundaries = boundaries->size();
+      fraction = (direction != 0 and 0 < next and next < nBoundaries - 1)
+                     ? ((*boundaries)[next] - start) / delta
+                     : std::numeric_limits<double>::infinity();
+    }
+  };
+  std::array<Walk, 2> walks;
+  for (size_t ib = 0; ib < std::min(binningData.size(), walks.size()); ++ib) {
+    Walk& walk = walks[ib];
+    walk.boundaries = &binningData[ib].boundaries();
+    walk.start = projected(startPoint, ib);
+    walk.delta = projected(endPoint, ib) - walk.start;
+    const auto& boundaries = *walk.boundaries;
+    if (walk.delta > 0.) {
+      // the first boundary above the start
+      walk.direction = 1;
+      walk.next = std::upper_bound(boundaries.begin(), boundaries.end(),
+                                   walk.start) -
+                  boundaries.begin();
+    } else if (walk.delta < 0.) {
+      // the last boundary below the start, wraps around if there is none
+      walk.direction = -1;
+      walk.next = std::lower_bound(boundaries.begin(), boundaries.end(),
+                                   walk.start) -
+                  boundaries.begin() - 1;
     }
+    walk.update();
   }
-  // Last one is also valid - now sort
-  stepIntersections.push_back(Intersection(endPoint,
-                                           (startPoint - endPoint).norm(),
-                                           Intersection::Status::reachable));
-  std::sort(stepIntersections.begin(), stepIntersections.end());
 
   Vector3D lastPosition = startPoint;
-  // reserve the right amount
-  cSteps.reserve(stepIntersections.size());
-  for (auto& sIntersection : stepIntersections) {
+  while (true) {
+    // the closest crossing of the two directions
+    Walk& walk =
+        (walks[0].fraction <= walks[1].fraction) ? walks[0] : walks[1];
+    if (not(walk.fraction < 1.)) {
+      break;
+    }
+    Vector3D position = startPoint + walk.fraction * (endPoint - startPoint);
+    ACTS_VERBOSE("Cell boundary crossed at = " << position.x() << ", "
+                                               << position.y() << ", "
+                                               << position.z());
     // create the new digitization step
-    cSteps.push_back(
-        dmodule.digitizationStep(lastPosition, sIntersection.position));
-    lastPosition = sIntersection.position;
+    cSteps.push_back(dmodule.digitizationStep(lastPosition, position));
+    lastPosition = position;
+    walk.next += walk.direction;
+    walk.update();
   }
+  // the last step ends at the end point
+  cSteps.push_back(dmodule.digitizationStep(lastPosition, endPoint));
   // return all the steps
   return cSteps;
 }
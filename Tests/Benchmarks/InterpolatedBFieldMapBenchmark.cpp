@@ -0,0 +1,196 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Build a mapper on the same grid whose transforms are type-erased through
+/// std::function, i.e. the mapper type used before the transforms became
+/// template parameters.
+template <typename mapper_t>
+InterpolatedBFieldMapper<typename mapper_t::Grid_t> makeTypeErasedMapper(
+    const mapper_t& mapper) {
+  using Erased = InterpolatedBFieldMapper<typename mapper_t::Grid_t>;
+  return Erased(typename mapper_t::TransformPos(),
+                typename mapper_t::TransformBField(), mapper.getGrid());
+}
+
+/// Read an (x,y,z,Bx,By,Bz) text field map, e.g. the ATLAS field map, with
+/// positions in mm and field values in T.
+InterpolatedBFieldMapperXYZ readFieldMapXYZ(const std::string& fileName) {
+  std::ifstream map_file(fileName, std::ios::in);
+  if (not map_file.good()) {
+    throw std::invalid_argument("Can not open field map file " + fileName);
+  }
+  std::vector<double> xPos, yPos, zPos;
+  std::vector<Vector3D> bField;
+  double x = 0, y = 0, z = 0, bx = 0, by = 0, bz = 0;
+  while (map_file >> x >> y >> z >> bx >> by >> bz) {
+    xPos.push_back(x);
+    yPos.push_back(y);
+    zPos.push_back(z);
+    bField.push_back(Vector3D(bx, by, bz));
+  }
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> sizes) {
+    return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] + bins[2]);
+  };
+  return fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bField,
+                        UnitConstants::mm, UnitConstants::T, false);
+}
+
+/// Propagate the given tracks through the field described by the mapper.
+///
+/// @return the benchmark result and the average number of steps per track
+template <typename mapper_t>
+std::pair<Acts::Test::MicroBenchmarkResult, double> runBenchmark(
+    mapper_t mapper, const std::vector<CurvilinearParameters>& startPars,
+    double maxPath) {
+  using BField_type = InterpolatedBFieldMap<mapper_t>;
+  using Stepper_type = EigenStepper<BField_type>;
+  using Propagator_type = Propagator<Stepper_type>;
+
+  typename BField_type::Config cfg(std::move(mapper));
+  Stepper_type stepper(BField_type(std::move(cfg)));
+  Propagator_type propagator(std::move(stepper));
+
+  GeometryContext tgContext = GeometryContext();
+  MagneticFieldContext mfContext = MagneticFieldContext();
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = maxPath;
+
+  // count the steps outside of the timed loop since it also runs the warm-up
+  size_t num_steps = 0;
+  for (const auto& pars : startPars) {
+    num_steps += propagator.propagate(pars, options).value().steps;
+  }
+
+  size_t num_iters = 0;
+  const auto result = Acts::Test::microBenchmark(
+      [&] {
+        const auto& pars = startPars[num_iters++ % startPars.size()];
+        return propagator.propagate(pars, options).value();
+      },
+      1, startPars.size());
+
+  return {result, static_cast<double>(num_steps) / startPars.size()};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int toys = 1;
+  double ptInGeV = 1;
+  double maxPathInM = 1;
+  std::string mapFile;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(10000),"number of tracks to propagate")
+      ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+      ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
+      ("map",po::value<std::string>(&mapFile)->default_value(""),"optional (x,y,z,Bx,By,Bz) text field map in mm/T, e.g. the ATLAS field map; a sampled solenoid map is used otherwise")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("InterpolatedBFieldMap", Acts::Logging::Level(lvl)));
+
+  // the same set of tracks is propagated through both mapper variants
+  std::minstd_rand rng;
+  std::uniform_real_distribution<> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<> etaDist(-2.5, 2.5);
+  std::vector<CurvilinearParameters> startPars;
+  startPars.reserve(toys);
+  for (unsigned int i = 0; i < toys; ++i) {
+    const double phi = phiDist(rng);
+    const double eta = etaDist(rng);
+    const double pt = ptInGeV * UnitConstants::GeV;
+    Vector3D mom(pt * std::cos(phi), pt * std::sin(phi), pt * std::sinh(eta));
+    startPars.emplace_back(std::nullopt, Vector3D(0, 0, 0), mom, +1, 0.);
+  }
+
+  const double maxPath = maxPathInM * UnitConstants::m;
+  auto report = [&](const std::string& name, const auto& result) {
+    const auto& [stats, steps] = result;
+    ACTS_INFO(name << " execution stats: " << stats);
+    ACTS_INFO(name << " average steps per track = " << steps
+                   << ", time per step = "
+                   << stats.iterTimeAverage().count() / steps << "ns");
+  };
+
+  if (mapFile.empty()) {
+    const double L = 5.8_m;
+    const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+    const size_t nCoils = 1154;
+    const double bMagCenter = 2_T;
+
+    ACTS_INFO("building interpolated solenoid field map");
+    SolenoidBField bSolenoidField({R, L, nCoils, bMagCenter});
+    auto mapper = solenoidFieldMapper({-0.1, 2 * R}, {-L, L}, {150, 200},
+                                      bSolenoidField);
+    ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
+                             << "GeV through the (r,z) solenoid map");
+    report("std::function transforms",
+           runBenchmark(makeTypeErasedMapper(mapper), startPars, maxPath));
+    report("inlined transforms",
+           runBenchmark(std::move(mapper), startPars, maxPath));
+  } else {
+    ACTS_INFO("reading field map " << mapFile);
+    auto mapper = readFieldMapXYZ(mapFile);
+    ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
+                             << "GeV through the (x,y,z) map");
+    report("std::function transforms",
+           runBenchmark(makeTypeErasedMapper(mapper), startPars, maxPath));
+    report("inlined transforms",
+           runBenchmark(std::move(mapper), startPars, maxPath));
+  }
+
+  return 0;
+}
@@ -0,0 +1,262 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Benchmark of the core seed finder alone: the space points are generated
+// in memory and grouped with BinnedSPGroup, which is then iterated serially.
+// The examples framework, i.e. the SeedingAlgorithm with its event store,
+// space point conversion and parallel group loop, is not part of the timing;
+// see ActsBenchmarkSeeding in Examples/Run/Seeding for the end-to-end
+// measurement on the simulated generic detector.
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+struct SpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float m_r;
+  float varianceR;
+  float varianceZ;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float r() const { return m_r; }
+};
+
+using Event = std::vector<SpacePoint>;
+
+// pixel layout of the generic detector
+const std::vector<double> s_barrelRadii = {32_mm, 72_mm, 116_mm, 172_mm};
+const double s_barrelHalfLength = 480_mm;
+const std::vector<double> s_endcapPositions = {
+    600_mm, 700_mm, 820_mm, 960_mm, 1100_mm, 1300_mm, 1500_mm};
+const double s_endcapMinR = 30_mm;
+const double s_endcapMaxR = 175_mm;
+
+/// Intersect helical tracks from the beam line with the pixel layers.
+Event generateEvent(std::mt19937& rng, size_t nParticles, double bField,
+                    double sigmaLoc) {
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<double> ptDist(0.5_GeV, 10_GeV);
+  std::normal_distribution<double> vertexDist(0., 50_mm);
+  std::normal_distribution<double> stdNormal(0., 1.);
+  const float variance = sigmaLoc * sigmaLoc;
+
+  Event event;
+  event.reserve(nParticles * 8);
+  auto addHit = [&](double r, double phi, double z) {
+    // smear in r-phi and z on the barrel and in r-phi and r on the endcaps
+    phi += sigmaLoc * stdNormal(rng) / r;
+    const double x = r * std::cos(phi);
+    const double y = r * std::sin(phi);
+    z += sigmaLoc * stdNormal(rng);
+    event.push_back({float(x), float(y), float(z), float(std::hypot(x, y)),
+                     variance, variance});
+  };
+
+  for (size_t ip = 0; ip < nParticles; ++ip) {
+    const double phi0 = phiDist(rng);
+    const double cotTheta = std::sinh(etaDist(rng));
+    const double z0 = vertexDist(rng);
+    const double charge = (ip % 2 == 0) ? 1 : -1;
+    const double radius = ptDist(rng) / bField;
+    // position at transverse distance r from the beam line
+    auto turningAngle = [&](double r) {
+      return 2 * std::asin(r / (2 * radius));
+    };
+    auto phiAt = [&](double r) {
+      return phi0 - charge * turningAngle(r) / 2;
+    };
+    auto zAt = [&](double r) {
+      return z0 + cotTheta * radius * turningAngle(r);
+    };
+
+    for (double r : s_barrelRadii) {
+      if (2 * radius <= r) {
+        break;
+      }
+      const double z = zAt(r);
+      if (std::abs(z) < s_barrelHalfLength) {
+        addHit(r, phiAt(r), z);
+      }
+    }
+    for (double zDisk : s_endcapPositions) {
+      // arc length in the transverse plane to reach the disk
+      const double s = (std::copysign(zDisk, cotTheta) - z0) / cotTheta;
+      if (s <= 0 or M_PI * radius <= s) {
+        continue;
+      }
+      const double r = 2 * radius * std::sin(s / (2 * radius));
+      if (s_endcapMinR < r and r < s_endcapMaxR) {
+        addHit(r, phiAt(r), std::copysign(zDisk, cotTheta));
+      }
+    }
+  }
+  return event;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int nEvents = 10;
+  unsigned int nParticles = 1000;
+  unsigned int nRuns = 5;
+  double sigmaLocInUm = 10;
+  bool simd = true;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("events",po::value<unsigned int>(&nEvents)->default_value(10),"number of events")
+      ("particles",po::value<unsigned int>(&nParticles)->default_value(1000),"number of particles per event")
+      ("runs",po::value<unsigned int>(&nRuns)->default_value(5),"number of benchmark runs over all events")
+      ("sigma",po::value<double>(&sigmaLocInUm)->default_value(10),"space point resolution in um")
+      ("simd",po::value<bool>(&simd)->default_value(true),"also run the vectorized triplet search")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+    if (nEvents == 0) {
+      std::cerr << "error: at least one event is required" << std::endl;
+      return 1;
+    }
+    // the timing statistics need the spread between runs
+    if (nRuns < 2) {
+      std::cerr << "error: at least two runs are required" << std::endl;
+      return 1;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Seedfinder", Acts::Logging::Level(lvl)));
+
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 200.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2000.;
+  config.zMax = 2000.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+  SeedFilterConfig filterConfig;
+  config.seedFilter = std::make_shared<SeedFilter<SpacePoint>>(filterConfig);
+
+  // the seed finder uses kilotesla for the field strength
+  const double bField = config.bFieldInZ * 1000 * UnitConstants::T;
+  std::mt19937 rng(1234);
+  std::vector<Event> events;
+  size_t nSpacePoints = 0;
+  for (size_t ievent = 0; ievent < nEvents; ++ievent) {
+    events.push_back(generateEvent(rng, nParticles, bField,
+                                   sigmaLocInUm * UnitConstants::um));
+    nSpacePoints += events.back().size();
+  }
+  ACTS_INFO("Seeding " << nEvents << " events with " << nParticles
+                       << " particles and on average "
+                       << nSpacePoints / nEvents
+                       << " space points per event");
+
+  SpacePointGridConfig gridConfig;
+  gridConfig.bFieldInZ = config.bFieldInZ;
+  gridConfig.minPt = config.minPt;
+  gridConfig.rMax = config.rMax;
+  gridConfig.zMax = config.zMax;
+  gridConfig.zMin = config.zMin;
+  gridConfig.deltaRMax = config.deltaRMax;
+  gridConfig.cotThetaMax = config.cotThetaMax;
+  auto binFinder = std::make_shared<BinFinder<SpacePoint>>();
+  auto covTool = [](const SpacePoint& sp, float, float, float) -> Vector2D {
+    return {sp.varianceR, sp.varianceZ};
+  };
+
+  // grouping and seeding of one event; returns the number of seeds
+  auto seedEvent = [&](const auto& finder, const Event& event) {
+    std::vector<const SpacePoint*> spacePoints;
+    spacePoints.reserve(event.size());
+    for (const SpacePoint& sp : event) {
+      spacePoints.push_back(&sp);
+    }
+    BinnedSPGroup<SpacePoint> spGroup(
+        spacePoints.begin(), spacePoints.end(), covTool, binFinder, binFinder,
+        SpacePointGridCreator::createGrid<SpacePoint>(gridConfig), config);
+    size_t nSeeds = 0;
+    for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+      nSeeds += finder
+                    .createSeedsForGroup(group.bottom(), group.middle(),
+                                         group.top())
+                    .size();
+    }
+    return nSeeds;
+  };
+
+  auto runBenchmark = [&](const auto& finder, const std::string& name) {
+    size_t nSeeds = 0;
+    for (const Event& event : events) {
+      nSeeds += seedEvent(finder, event);
+    }
+    const auto result = Acts::Test::microBenchmark(
+        [&](const Event& event) { return seedEvent(finder, event); }, events,
+        nRuns, std::chrono::milliseconds(0));
+    const double timePerEvent =
+        std::chrono::duration<double>(result.iterTimeAverage()).count();
+    ACTS_INFO("[" << name << "] " << result);
+    ACTS_INFO("[" << name << "] " << nSeeds / nEvents
+                  << " seeds per event, " << 1000 * timePerEvent
+                  << " ms per event, " << nSeeds / (nEvents * timePerEvent)
+                  << " seeds/s");
+  };
+
+  Seedfinder<SpacePoint> finder(config);
+  runBenchmark(finder, "default");
+  if (simd) {
+    Seedfinder<SpacePoint, CpuSimd> simdFinder(config);
+    runBenchmark(simdFinder, "simd");
+  }
+  return 0;
+}
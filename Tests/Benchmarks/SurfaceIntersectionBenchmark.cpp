@@ -11,6 +11,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BatchIntersection.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
@@ -22,6 +23,7 @@
 #include "Acts/Utilities/Units.hpp"
 
 #include <cmath>
+#include <random>
 
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
@@ -33,6 +35,7 @@ namespace Test {
 // Some randomness & number crunching
 unsigned int ntests = 10;
 unsigned int nrepts = 2000;
+unsigned int nbatch = 1024;
 const bool boundaryCheck = false;
 const bool testPlane = true;
 const bool testDisc = true;
@@ -126,5 +129,66 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+template <typename surface_t>
+void batchIntersectionTest(const std::string& name, const surface_t& surface,
+                           const RayBlock& rays) {
+  IntersectionBlock intersections;
+  const auto batch = Acts::Test::microBenchmark(
+      [&] {
+        BatchIntersection::intersect(tgContext, surface, rays, boundaryCheck,
+                                     intersections);
+        return intersections.pathLength[0];
+      },
+      1, nrepts);
+  const auto single = Acts::Test::microBenchmark(
+      [&] {
+        double sum = 0.;
+        for (size_t i = 0; i < rays.size(); ++i) {
+          const Vector3D position(rays.x[i], rays.y[i], rays.z[i]);
+          const Vector3D direction(rays.dx[i], rays.dy[i], rays.dz[i]);
+          sum += surface.intersect(tgContext, position, direction,
+                                   boundaryCheck)
+                     .intersection.pathLength;
+        }
+        return sum;
+      },
+      1, nrepts);
+  const double batchTime =
+      std::chrono::duration<double, std::nano>(batch.iterTimeAverage())
+          .count() /
+      rays.size();
+  const double singleTime =
+      std::chrono::duration<double, std::nano>(single.iterTimeAverage())
+          .count() /
+      rays.size();
+  std::cout << "- " << name << ": " << batchTime << " ns per track batched, "
+            << singleTime << " ns per track single, speedup "
+            << singleTime / batchTime << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_batch_surface_intersections) {
+  // a block of tracks from the origin within the tested theta range
+  std::mt19937 rng(23);
+  std::uniform_real_distribution<> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<> thetaDist(-0.3, 0.3);
+  RayBlock rays(nbatch);
+  for (size_t i = 0; i < nbatch; ++i) {
+    const double phi = phiDist(rng);
+    const double theta = thetaDist(rng);
+    rays.set(i, origin,
+             Vector3D(std::cos(phi) * std::sin(theta),
+                      std::sin(phi) * std::sin(theta), std::cos(theta)));
+  }
+
+  std::cout << std::endl
+            << "Benchmarking blocks of " << nbatch << " tracks..." << std::endl;
+  if (testPlane) {
+    batchIntersectionTest("Plane", *aPlane, rays);
+  }
+  if (testCylinder) {
+    batchIntersectionTest("Cylinder", *aCylinder, rays);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,139 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using TrackDensity = GaussianTrackDensity<BoundParameters>;
+
+// Create a test context
+GeometryContext geoContext = GeometryContext();
+
+std::shared_ptr<PerigeeSurface> perigeeSurface =
+    Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+// Tracks from vertices along the beam line, 50 tracks per vertex
+std::vector<BoundParameters> makeTracks(size_t nTracks) {
+  std::mt19937 gen(31);
+  std::normal_distribution<> vertexDist(0., 50_mm);
+  std::normal_distribution<> d0Dist(0., 30_um);
+  std::uniform_real_distribution<> resDist(20_um, 200_um);
+  std::vector<double> vertices(nTracks / 50 + 1);
+  for (auto& z : vertices) {
+    z = vertexDist(gen);
+  }
+  std::vector<BoundParameters> tracks;
+  for (size_t it = 0; it < nTracks; ++it) {
+    const double resD0 = resDist(gen);
+    const double resZ0 = resDist(gen);
+    BoundSymMatrix covMat = BoundSymMatrix::Identity();
+    covMat(eLOC_D0, eLOC_D0) = resD0 * resD0;
+    covMat(eLOC_Z0, eLOC_Z0) = resZ0 * resZ0;
+    std::normal_distribution<> z0Dist(vertices[it % vertices.size()], resZ0);
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), 0., M_PI_2, 1_e / 1_GeV, 0.;
+    tracks.emplace_back(geoContext, covMat, paramVec, perigeeSurface);
+  }
+  return tracks;
+}
+
+// The previous maximum search, summing all tracks at every trial point
+double fullSumMaximum(const std::vector<TrackDensity::TrackEntry>& entries) {
+  auto density = [&](double z) {
+    double value = 0.;
+    double firstDerivative = 0.;
+    double secondDerivative = 0.;
+    for (const auto& entry : entries) {
+      if (entry.lowerBound < z && z < entry.upperBound) {
+        double delta = std::exp(entry.c0 + z * (entry.c1 + z * entry.c2));
+        double qPrime = entry.c1 + 2. * z * entry.c2;
+        double deltaPrime = delta * qPrime;
+        value += delta;
+        firstDerivative += deltaPrime;
+        secondDerivative += 2. * entry.c2 * delta + qPrime * deltaPrime;
+      }
+    }
+    return std::make_tuple(value, firstDerivative, secondDerivative);
+  };
+  double maxPosition = 0.;
+  double maxDensity = 0.;
+  for (const auto& entry : entries) {
+    double trialZ = entry.z;
+    for (int iStep = 0; iStep < 3; ++iStep) {
+      auto [y, dy, ddy] = density(trialZ);
+      if (ddy >= 0. || y <= 0.) {
+        break;
+      }
+      if (y > maxDensity) {
+        maxPosition = trialZ;
+        maxDensity = y;
+      }
+      trialZ += (y * dy) / (dy * dy - y * ddy);
+    }
+  }
+  return maxPosition;
+}
+
+BOOST_DATA_TEST_CASE(benchmark_track_density,
+                     bdata::make({1000u, 5000u, 10000u}), nTracks) {
+  const auto tracks = makeTracks(nTracks);
+  std::vector<const BoundParameters*> trackPtrs;
+  for (const auto& track : tracks) {
+    trackPtrs.push_back(&track);
+  }
+  std::function<BoundParameters(BoundParameters)> extractParameters =
+      [](BoundParameters params) { return params; };
+  TrackDensity trackDensity;
+
+  const size_t nRuns = 3;
+  const auto windowed = Acts::Test::microBenchmark(
+      [&] {
+        TrackDensity::State state(nTracks);
+        return trackDensity.globalMaximum(state, trackPtrs, extractParameters);
+      },
+      1, nRuns, std::chrono::milliseconds(0));
+
+  TrackDensity::State state(nTracks);
+  const double z =
+      trackDensity.globalMaximum(state, trackPtrs, extractParameters);
+  const auto full = Acts::Test::microBenchmark(
+      [&] { return fullSumMaximum(state.trackEntries); }, 1, nRuns,
+      std::chrono::milliseconds(0));
+
+  const double windowedTime =
+      std::chrono::duration<double, std::milli>(windowed.iterTimeAverage())
+          .count();
+  const double fullTime =
+      std::chrono::duration<double, std::milli>(full.iterTimeAverage())
+          .count();
+  std::cout << nTracks << " tracks: " << windowedTime
+            << " ms windowed incl. track caching, " << fullTime
+            << " ms full sum, speedup " << fullTime / windowedTime
+            << ", maximum at " << z << " and "
+            << fullSumMaximum(state.trackEntries) << std::endl;
+}
+
+}  // namespace Test
+}  // namespace Acts
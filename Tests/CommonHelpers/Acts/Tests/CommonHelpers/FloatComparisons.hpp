@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <type_traits>
 
 // The following assertions can be seen as an extension of the BOOST_CHECK_XYZ
 // macros which also support approximate comparisons of containers of floating-
@@ -159,8 +160,13 @@ predicate_result matrixCompare(const Eigen::DenseBase<Derived1>& val,
 // FIXME: The algorithm only supports ordered containers, so the API should
 //        only accept them. Does someone know a clean way to do that in C++?
 //
+// Eigen types may also define a const_iterator (which is unusable for
+// matrices), they are handled by the Eigen frontend below instead.
+//
 template <typename Container,
-          typename Enable = typename Container::const_iterator>
+          typename Enable = typename Container::const_iterator,
+          typename = std::enable_if_t<
+              not std::is_base_of_v<Eigen::DenseBase<Container>, Container>>>
 predicate_result compare(const Container& val, const Container& ref,
                          ScalarComparison&& compareImpl) {
   // Make sure that the two input containers have the same number of items
@@ -16,6 +16,7 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <cstdint>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -806,6 +807,60 @@ BOOST_AUTO_TEST_CASE(trackstateproxy_copy) {
                     &ts2.referenceSurface());  // always copied
 }
 
+BOOST_AUTO_TEST_CASE(multitrajectory_reset_reuse) {
+  using PM = TrackStatePropMask;
+  MultiTrajectory<SourceLink> t;
+  t.reserve(4);
+
+  auto isAligned = [](const auto& matrix) {
+    return (reinterpret_cast<std::uintptr_t>(matrix.data()) % 64) == 0;
+  };
+
+  // fill the trajectory once and remember where the storage lives
+  std::vector<const double*> covAddresses;
+  size_t iprevious = SIZE_MAX;
+  for (size_t i = 0; i < 4; ++i) {
+    iprevious = t.addTrackState(PM::All, iprevious);
+    auto ts = t.getTrackState(iprevious);
+    fillTrackState(ts, PM::All);
+    BOOST_CHECK(isAligned(ts.predictedCovariance()));
+    BOOST_CHECK(isAligned(ts.filteredCovariance()));
+    BOOST_CHECK(isAligned(ts.smoothedCovariance()));
+    BOOST_CHECK(isAligned(ts.jacobian()));
+    BOOST_CHECK(isAligned(ts.calibratedCovariance()));
+    covAddresses.push_back(ts.predictedCovariance().data());
+  }
+  BOOST_CHECK_EQUAL(t.size(), 4u);
+  const size_t capacity = t.capacity();
+  BOOST_CHECK_GE(capacity, 4u);
+
+  t.reset();
+  BOOST_CHECK_EQUAL(t.size(), 0u);
+  BOOST_CHECK_EQUAL(t.capacity(), capacity);
+
+  // reuse the trajectory with fewer states: the states reuse the previously
+  // allocated storage and do not carry over any content from before
+  iprevious = SIZE_MAX;
+  for (size_t i = 0; i < 3; ++i) {
+    iprevious = t.addTrackState(PM::All, iprevious);
+    auto ts = t.getTrackState(iprevious);
+    BOOST_CHECK_EQUAL(ts.predictedCovariance().data(), covAddresses[i]);
+    BOOST_CHECK(ts.predicted().isZero());
+    BOOST_CHECK(ts.predictedCovariance().isZero());
+    BOOST_CHECK(ts.jacobian().isZero());
+    auto [pc, fm] = fillTrackState(ts, PM::All);
+    BOOST_CHECK_EQUAL(pc.predicted->parameters(), ts.predicted());
+    BOOST_CHECK_EQUAL(*pc.predicted->covariance(), ts.predictedCovariance());
+  }
+  BOOST_CHECK_EQUAL(t.size(), 3u);
+  BOOST_CHECK_EQUAL(t.capacity(), capacity);
+
+  // the states of the first fill are gone
+  size_t nStates = 0;
+  t.visitBackwards(iprevious, [&](auto) { ++nStates; });
+  BOOST_CHECK_EQUAL(nStates, 3u);
+}
+
 }  // namespace Test
 
 }  // namespace Acts
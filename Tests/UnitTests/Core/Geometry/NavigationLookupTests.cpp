@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/NavigationLookup.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <stdexcept>
+
+#include "NavigationTestHelpers.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+auto lookup =
+    std::make_shared<const NavigationLookup>(tgContext, *tGeometry,
+                                             NavigationLookup::Config());
+
+std::vector<const Layer*> sensitiveLayers() {
+  return sensitiveLayers(*tGeometry);
+}
+
+const int ntests = 100;
+
+BOOST_AUTO_TEST_SUITE(NavigationLookupTests)
+
+BOOST_AUTO_TEST_CASE(NavigationLookupConstruction) {
+  BOOST_CHECK_EQUAL(lookup->size(), sensitiveLayers().size());
+
+  NavigationLookup::Config noBins;
+  noBins.nPhiBins = 0;
+  BOOST_CHECK_THROW(NavigationLookup(tgContext, *tGeometry, noBins),
+                    std::invalid_argument);
+  NavigationLookup::Config noEta;
+  noEta.etaMin = noEta.etaMax;
+  BOOST_CHECK_THROW(NavigationLookup(tgContext, *tGeometry, noEta),
+                    std::invalid_argument);
+}
+
+// The candidates of straight lines from the origin have to give the same
+// surfaces as the full search of the surface array
+BOOST_DATA_TEST_CASE(
+    NavigationLookupCandidates,
+    bdata::random((bdata::seed = 0,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 1,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-2.5, 2.5))) ^
+        bdata::xrange(ntests),
+    phi, eta, index) {
+  (void)index;
+  const double theta = 2 * std::atan(std::exp(-eta));
+  const Vector3D direction(std::cos(phi) * std::sin(theta),
+                           std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  for (const Layer* layer : sensitiveLayers()) {
+    const Surface& layerSurface = layer->surfaceRepresentation();
+    auto layerIntersection =
+        layerSurface.intersect(tgContext, Vector3D::Zero(), direction, true);
+    if (not layerIntersection) {
+      continue;
+    }
+    const Vector3D& position = layerIntersection.intersection.position;
+    const auto* candidates =
+        lookup->candidates(tgContext, *layer, position, direction);
+    BOOST_CHECK(candidates != nullptr);
+
+    NavigationOptions<Surface> navOpts(forward, true, true, true, false,
+                                       &layerSurface);
+    auto reference =
+        layer->compatibleSurfaces(tgContext, position, direction, navOpts);
+    navOpts.surfaceCandidates = candidates;
+    auto fromLookup =
+        layer->compatibleSurfaces(tgContext, position, direction, navOpts);
+    BOOST_CHECK_EQUAL(reference.size(), fromLookup.size());
+    for (size_t i = 0; i < std::min(reference.size(), fromLookup.size());
+         ++i) {
+      BOOST_CHECK_EQUAL(reference[i].object, fromLookup[i].object);
+    }
+  }
+
+  // the lookup does not apply to tracks far off the line through the origin
+  const Vector3D offPosition = 100_mm * direction;
+  const Vector3D offDirection =
+      Vector3D(-direction.y(), direction.x(), 0.).normalized();
+  for (const Layer* layer : sensitiveLayers()) {
+    BOOST_CHECK(lookup->candidates(tgContext, *layer, offPosition,
+                                   offDirection) == nullptr);
+  }
+}
+
+// Propagation with the lookup has to hit the same sensitive surfaces
+BOOST_DATA_TEST_CASE(
+    NavigationLookupPropagation,
+    bdata::random((bdata::seed = 10,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(0.4_GeV, 10_GeV))) ^
+        bdata::random((bdata::seed = 11,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 12,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(1.0, M_PI - 1.0))) ^
+        bdata::random(
+            (bdata::seed = 13,
+             bdata::distribution = std::uniform_int_distribution<>(0, 1))) ^
+        bdata::xrange(ntests),
+    pT, phi, theta, charge, index) {
+  (void)index;
+  using Stepper = EigenStepper<ConstantBField>;
+
+  ConstantBField bField(0, 0, 2_T);
+  Navigator navigator(tGeometry);
+  Navigator lookupNavigator(tGeometry);
+  lookupNavigator.navigationLookup = lookup;
+  Navigator validatingNavigator(tGeometry);
+  validatingNavigator.navigationLookup = lookup;
+  validatingNavigator.validateSurfaceCandidates = true;
+  Propagator<Stepper, Navigator> propagator(Stepper(bField), navigator);
+  Propagator<Stepper, Navigator> lookupPropagator(Stepper(bField),
+                                                  lookupNavigator);
+  Propagator<Stepper, Navigator> validatingPropagator(Stepper(bField),
+                                                      validatingNavigator);
+
+  const Vector3D momentum(pT * std::cos(phi), pT * std::sin(phi),
+                          pT / std::tan(theta));
+  CurvilinearParameters start(std::nullopt, Vector3D::Zero(), momentum,
+                              -1 + 2 * charge, 0.);
+
+  const auto reference =
+      collectSensitiveSurfaces(propagator, start, tgContext, mfContext);
+  const auto fromLookup =
+      collectSensitiveSurfaces(lookupPropagator, start, tgContext, mfContext);
+  size_t mismatches = 0;
+  const auto validated = collectSensitiveSurfaces(
+      validatingPropagator, start, tgContext, mfContext, &mismatches);
+  BOOST_CHECK_EQUAL_COLLECTIONS(reference.begin(), reference.end(),
+                                fromLookup.begin(), fromLookup.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(reference.begin(), reference.end(),
+                                validated.begin(), validated.end());
+  BOOST_CHECK_EQUAL(mismatches, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,110 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+/// Collect the layers with a surface array of a volume and its sub volumes
+inline void collectLayers(const TrackingVolume& volume,
+                          std::vector<const Layer*>& layers) {
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      collectLayers(*subVolume, layers);
+    }
+  }
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      if (layer->surfaceArray() != nullptr) {
+        layers.push_back(layer.get());
+      }
+    }
+  }
+}
+
+/// The layers with a surface array of a tracking geometry
+inline std::vector<const Layer*> sensitiveLayers(
+    const TrackingGeometry& tGeometry) {
+  std::vector<const Layer*> layers;
+  collectLayers(*tGeometry.highestTrackingVolume(), layers);
+  return layers;
+}
+
+/// A selector for the sensitive surfaces
+struct SensitiveSelector {
+  bool operator()(const Surface& sf) const {
+    return (sf.associatedDetectorElement() != nullptr);
+  }
+};
+
+/// Reports the surface candidate mismatches found by the Navigator
+struct CandidateMismatchRecorder {
+  struct this_result {
+    size_t mismatches = 0;
+  };
+  using result_type = this_result;
+
+  template <typename propagator_state_t, typename stepper_t>
+  void operator()(propagator_state_t& state, const stepper_t& /*stepper*/,
+                  result_type& result) const {
+    result.mismatches = state.navigation.surfaceCandidateMismatches;
+  }
+};
+
+/// The sensitive surfaces hit by a propagation within 25cm
+///
+/// @tparam propagator_t The propagator type
+///
+/// @param propagator The propagator, e.g. with a configured Navigator
+/// @param start The start parameters
+/// @param tgContext The geometry context
+/// @param mfContext The magnetic field context
+/// @param [out] mismatches The number of surface candidate mismatches found
+///        by a validating Navigator, if given
+template <typename propagator_t>
+std::vector<const Surface*> collectSensitiveSurfaces(
+    const propagator_t& propagator, const CurvilinearParameters& start,
+    const GeometryContext& tgContext, const MagneticFieldContext& mfContext,
+    size_t* mismatches = nullptr) {
+  using Collector = SurfaceCollector<SensitiveSelector>;
+  using Recorder = CandidateMismatchRecorder;
+
+  PropagatorOptions<ActionList<Collector, Recorder>> options(tgContext,
+                                                             mfContext);
+  options.maxStepSize = 10 * UnitConstants::cm;
+  options.pathLimit = 25 * UnitConstants::cm;
+
+  std::vector<const Surface*> surfaces;
+  const auto& result = propagator.propagate(start, options).value();
+  for (const auto& hit :
+       result.template get<typename Collector::result_type>().collected) {
+    surfaces.push_back(hit.surface);
+  }
+  if (mismatches != nullptr) {
+    *mismatches =
+        result.template get<typename Recorder::result_type>().mismatches;
+  }
+  return surfaces;
+}
+
+}  // namespace Test
+}  // namespace Acts
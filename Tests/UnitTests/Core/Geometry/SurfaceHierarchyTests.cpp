@@ -0,0 +1,232 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/SurfaceHierarchy.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Ray.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "NavigationTestHelpers.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+auto hierarchies = std::make_shared<const SurfaceHierarchies>(
+    tgContext, *tGeometry, SurfaceHierarchy::Config());
+
+std::vector<const Layer*> sensitiveLayers() {
+  return sensitiveLayers(*tGeometry);
+}
+
+const int ntests = 100;
+
+BOOST_AUTO_TEST_SUITE(SurfaceHierarchyTests)
+
+BOOST_AUTO_TEST_CASE(SurfaceHierarchyConstruction) {
+  const auto layers = sensitiveLayers();
+  BOOST_CHECK_EQUAL(hierarchies->size(), layers.size());
+
+  for (const Layer* layer : layers) {
+    const SurfaceHierarchy* hierarchy = hierarchies->find(*layer);
+    BOOST_CHECK(hierarchy != nullptr);
+    if (hierarchy == nullptr) {
+      continue;
+    }
+    const auto& nodes = hierarchy->nodes();
+    BOOST_CHECK_EQUAL(nodes.front().skip, nodes.size());
+
+    // every surface is in exactly one leaf
+    std::vector<const Surface*> inLeaves;
+    for (size_t iNode = 0; iNode < nodes.size(); ++iNode) {
+      const auto& node = nodes[iNode];
+      BOOST_CHECK_GT(node.skip, iNode);
+      BOOST_CHECK_LE(node.skip, nodes.size());
+      if (node.count > 0) {
+        BOOST_CHECK_EQUAL(node.skip, iNode + 1);
+        BOOST_CHECK_LE(node.count, SurfaceHierarchy::Config().maxLeafSize);
+        inLeaves.insert(inLeaves.end(),
+                        hierarchy->surfaces().begin() + node.first,
+                        hierarchy->surfaces().begin() + node.first +
+                            node.count);
+      } else {
+        // the children fill the subtree
+        const auto& left = nodes[iNode + 1];
+        BOOST_CHECK_LT(left.skip, node.skip);
+        BOOST_CHECK_EQUAL(nodes[left.skip].skip, node.skip);
+      }
+    }
+    auto sorted = layer->surfaceArray()->surfaces();
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(inLeaves.begin(), inLeaves.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(sorted.begin(), sorted.end(),
+                                  inLeaves.begin(), inLeaves.end());
+  }
+
+  SurfaceHierarchy::Config noLeaves;
+  noLeaves.maxLeafSize = 0;
+  BOOST_CHECK_THROW(SurfaceHierarchies(tgContext, *tGeometry, noLeaves),
+                    std::invalid_argument);
+  SurfaceHierarchy::Config oneBin;
+  oneBin.nSahBins = 1;
+  BOOST_CHECK_THROW(SurfaceHierarchies(tgContext, *tGeometry, oneBin),
+                    std::invalid_argument);
+}
+
+// The candidates of a ray have to contain all surfaces it intersects
+BOOST_DATA_TEST_CASE(
+    SurfaceHierarchyCandidates,
+    bdata::random((bdata::seed = 0,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 1,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-2.5, 2.5))) ^
+        bdata::random((bdata::seed = 2,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-20_mm, 20_mm))) ^
+        bdata::xrange(ntests),
+    phi, eta, offset, index) {
+  (void)index;
+  const double theta = 2 * std::atan(std::exp(-eta));
+  const Vector3D direction(std::cos(phi) * std::sin(theta),
+                           std::sin(phi) * std::sin(theta), std::cos(theta));
+  const Vector3D origin(offset, -offset, 2 * offset);
+
+  for (const Layer* layer : sensitiveLayers()) {
+    std::vector<const Surface*> candidates;
+    hierarchies->find(*layer)->candidates(Ray3D(origin, direction),
+                                          candidates);
+    for (const Surface* surface : layer->surfaceArray()->surfaces()) {
+      auto intersection =
+          surface->intersect(tgContext, origin, direction, true);
+      if (intersection and intersection.intersection.pathLength > 0) {
+        BOOST_CHECK(std::find(candidates.begin(), candidates.end(),
+                              surface) != candidates.end());
+      }
+    }
+    // a candidate is only found once and only on its own layer
+    for (const Surface* surface : candidates) {
+      BOOST_CHECK_EQUAL(surface->associatedLayer(), layer);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    BOOST_CHECK(std::adjacent_find(candidates.begin(), candidates.end()) ==
+                candidates.end());
+  }
+}
+
+// Propagation with the hierarchies has to hit the same sensitive surfaces
+BOOST_DATA_TEST_CASE(
+    SurfaceHierarchyPropagation,
+    bdata::random((bdata::seed = 10,
+                   bdata::distribution =
+                       std::uniform_real_distribution<>(0.4_GeV, 10_GeV))) ^
+        bdata::random((bdata::seed = 11,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-M_PI, M_PI))) ^
+        bdata::random((bdata::seed = 12,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(1.0, M_PI - 1.0))) ^
+        bdata::random(
+            (bdata::seed = 13,
+             bdata::distribution = std::uniform_int_distribution<>(0, 1))) ^
+        bdata::xrange(ntests),
+    pT, phi, theta, charge, index) {
+  (void)index;
+  using Stepper = EigenStepper<ConstantBField>;
+
+  ConstantBField bField(0, 0, 2_T);
+  Navigator navigator(tGeometry);
+  Navigator rayNavigator(tGeometry);
+  rayNavigator.surfaceHierarchies = hierarchies;
+  Navigator frustumNavigator(tGeometry);
+  frustumNavigator.surfaceHierarchies = hierarchies;
+  frustumNavigator.hierarchyOpeningAngle = 0.1;
+  Propagator<Stepper, Navigator> propagator(Stepper(bField), navigator);
+  Propagator<Stepper, Navigator> rayPropagator(Stepper(bField), rayNavigator);
+  Propagator<Stepper, Navigator> frustumPropagator(Stepper(bField),
+                                                   frustumNavigator);
+
+  const Vector3D momentum(pT * std::cos(phi), pT * std::sin(phi),
+                          pT / std::tan(theta));
+  CurvilinearParameters start(std::nullopt, Vector3D::Zero(), momentum,
+                              -1 + 2 * charge, 0.);
+
+  const auto reference =
+      collectSensitiveSurfaces(propagator, start, tgContext, mfContext);
+  const auto fromRay =
+      collectSensitiveSurfaces(rayPropagator, start, tgContext, mfContext);
+  const auto fromFrustum =
+      collectSensitiveSurfaces(frustumPropagator, start, tgContext, mfContext);
+  BOOST_CHECK_EQUAL_COLLECTIONS(reference.begin(), reference.end(),
+                                fromRay.begin(), fromRay.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(reference.begin(), reference.end(),
+                                fromFrustum.begin(), fromFrustum.end());
+}
+
+// Candidates missing from broken hierarchies are detected and replaced
+BOOST_AUTO_TEST_CASE(SurfaceHierarchyValidation) {
+  using Stepper = EigenStepper<ConstantBField>;
+
+  // the boxes are shrunk by far more than the module size
+  SurfaceHierarchy::Config shrunk;
+  shrunk.envelope = -10_cm;
+  ConstantBField bField(0, 0, 2_T);
+  Navigator navigator(tGeometry);
+  Navigator validatingNavigator(tGeometry);
+  validatingNavigator.surfaceHierarchies =
+      std::make_shared<const SurfaceHierarchies>(tgContext, *tGeometry,
+                                                 shrunk);
+  validatingNavigator.validateSurfaceCandidates = true;
+  Propagator<Stepper, Navigator> propagator(Stepper(bField), navigator);
+  Propagator<Stepper, Navigator> validatingPropagator(Stepper(bField),
+                                                      validatingNavigator);
+
+  CurvilinearParameters start(std::nullopt, Vector3D::Zero(),
+                              Vector3D(1_GeV, 0.5_GeV, 0.2_GeV), 1, 0.);
+  const auto reference =
+      collectSensitiveSurfaces(propagator, start, tgContext, mfContext);
+  size_t mismatches = 0;
+  const auto validated = collectSensitiveSurfaces(
+      validatingPropagator, start, tgContext, mfContext, &mismatches);
+  BOOST_CHECK(not reference.empty());
+  BOOST_CHECK_EQUAL_COLLECTIONS(reference.begin(), reference.end(),
+                                validated.begin(), validated.end());
+  BOOST_CHECK_GT(mismatches, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -10,6 +10,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -112,6 +113,175 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(not c.isInside((pos << -2, 3, 4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 0, 2, -4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 5, 2, 14.).finished()));
+
+  // gradient of the (bilinear) field w.r.t. r and z chained with the
+  // derivatives of r w.r.t. x and y
+  auto gradient = [](const Vector3D& p) {
+    const double rho = perp(p);
+    const Vector3D dBdr(p.z(), 3, 0);
+    const Vector3D dBdz(rho, 0, -2);
+    ActsMatrixD<3, 3> grad;
+    grad.col(0) = dBdr * p.x() / rho;
+    grad.col(1) = dBdr * p.y() / rho;
+    grad.col(2) = dBdz;
+    return grad;
+  };
+
+  // the lambda position transform has no jacobian method, so this uses the
+  // finite difference fallback for the position derivatives
+  ActsMatrixD<3, 3> derivative;
+  pos << -3, 2.5, 1.7;
+  CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative),
+                  BField::value({{perp(pos), pos.z()}}), 1e-6);
+  CHECK_CLOSE_ABS(derivative, gradient(pos), 1e-6);
+  BField_t::Cache bCache4(mfContext);
+  CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative, bCache4),
+                  BField::value({{perp(pos), pos.z()}}), 1e-6);
+  CHECK_CLOSE_ABS(derivative, gradient(pos), 1e-6);
+  BOOST_CHECK(bCache4.fieldCell->isInside(pos));
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz_gradient) {
+  // (Br,Bz) bilinear in r and z, i.e. the interpolation is exact
+  auto value = [](double r, double z) {
+    return Vector2D(1. + 0.5 * r + 0.1 * r * z, 2. - 0.3 * z + r);
+  };
+
+  using Grid_t = InterpolatedBFieldMapperRZ::Grid_t;
+  Grid_t g(std::make_tuple(detail::EquidistantAxis(0., 4., 4u),
+                           detail::EquidistantAxis(-5., 5., 5u)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) = value(llCorner[0], llCorner[1]);
+    }
+  }
+
+  // analytic jacobians of the transformations and the finite difference
+  // fallback of the generic mapper
+  using BField_t = InterpolatedBFieldMap<InterpolatedBFieldMapperRZ>;
+  using Mapper_t = InterpolatedBFieldMapper<Grid_t>;
+  using GenericBField_t = InterpolatedBFieldMap<Mapper_t>;
+  BField_t b(BField_t::Config(InterpolatedBFieldMapperRZ(
+      RZPositionTransform(), RZFieldTransform(), g)));
+  GenericBField_t gb(GenericBField_t::Config(
+      Mapper_t(RZPositionTransform(), RZFieldTransform(), g)));
+  BField_t::Cache bCache(mfContext);
+
+  // central differences of the field as reference
+  auto reference = [&](const Vector3D& pos) {
+    constexpr double h = 1e-5;
+    ActsMatrixD<3, 3> grad;
+    for (unsigned int j = 0; j < 3; ++j) {
+      const Vector3D step = h * Vector3D::Unit(j);
+      grad.col(j) = (b.getField(pos + step) - b.getField(pos - step)) / (2 * h);
+    }
+    return grad;
+  };
+
+  ActsMatrixD<3, 3> derivative;
+  for (const Vector3D& pos :
+       {Vector3D(1.2, 2.1, 0.7), Vector3D(-2.5, 1.3, -3.1),
+        Vector3D(0.4, -3.3, 2.2), Vector3D(-1.1, -0.9, 4.2)}) {
+    const Vector2D rz = value(perp(pos), pos.z());
+    const Vector3D field(rz.x() * pos.x() / perp(pos),
+                         rz.x() * pos.y() / perp(pos), rz.y());
+    const ActsMatrixD<3, 3> grad = reference(pos);
+    // the rotation into cartesian coordinates contributes off-axis
+    BOOST_CHECK_GT(std::abs(grad(0, 1)), 1e-3);
+
+    CHECK_CLOSE_REL(b.getField(pos), field, 1e-9);
+    CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative), field, 1e-9);
+    CHECK_CLOSE_ABS(derivative, grad, 1e-6);
+    CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative, bCache), field, 1e-9);
+    CHECK_CLOSE_ABS(derivative, grad, 1e-6);
+    CHECK_CLOSE_REL(b.getField(pos, bCache), field, 1e-9);
+    CHECK_CLOSE_REL(gb.getFieldGradient(pos, derivative), field, 1e-9);
+    CHECK_CLOSE_ABS(derivative, grad, 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz_cell) {
+  // (Br,Bz) bilinear in r and z, i.e. the interpolation is exact
+  auto value = [](double r, double z) {
+    return Vector2D(1. + 0.5 * r + 0.1 * r * z, 2. - 0.3 * z + r);
+  };
+
+  using Grid_t = InterpolatedBFieldMapperRZ::Grid_t;
+  Grid_t g(std::make_tuple(detail::EquidistantAxis(0., 4., 4u),
+                           detail::EquidistantAxis(-5., 5., 5u)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) = value(llCorner[0], llCorner[1]);
+    }
+  }
+  InterpolatedBFieldMapperRZ mapper(RZPositionTransform(), RZFieldTransform(),
+                                    std::move(g));
+
+  // cell created at phi = 0 and used at other phi within the same (r,z) bin
+  const auto cell = mapper.getFieldCell(Vector3D(1.2, 0., 0.7));
+  for (const Vector3D& pos :
+       {Vector3D(1.2, 0., 0.7), Vector3D(0., 1.3, 0.6),
+        Vector3D(-1.1, -0.5, 0.2), Vector3D(0.9, -0.9, 0.9)}) {
+    BOOST_CHECK(cell.isInside(pos));
+    const Vector2D rz = value(perp(pos), pos.z());
+    const Vector3D field(rz.x() * pos.x() / perp(pos),
+                         rz.x() * pos.y() / perp(pos), rz.y());
+    // Br points along the radial direction of the given position and not of
+    // the position the cell was created for
+    CHECK_CLOSE_ABS(cell.getField(pos), field, 1e-9);
+    CHECK_CLOSE_ABS(cell.getField(pos), mapper.getField(pos), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_xyz_gradient) {
+  // trilinear field, i.e. interpolation and its gradient should be exact
+  auto value = [](const Vector3D& p) {
+    return Vector3D(p.x() * p.y() * p.z(), 2 * p.x() - p.z(), p.y() * p.z());
+  };
+  auto gradient = [](const Vector3D& p) {
+    ActsMatrixD<3, 3> grad;
+    // clang-format off
+    grad << p.y() * p.z(), p.x() * p.z(), p.x() * p.y(),
+            2,             0,             -1,
+            0,             p.z(),         p.y();
+    // clang-format on
+    return grad;
+  };
+
+  using Grid_t = InterpolatedBFieldMapperXYZ::Grid_t;
+  Grid_t g(std::make_tuple(detail::EquidistantAxis(-4., 4., 4u),
+                           detail::EquidistantAxis(-4., 4., 8u),
+                           detail::EquidistantAxis(-6., 6., 3u)));
+  for (size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        const auto& llCorner = g.lowerLeftBinEdge(indices);
+        g.atLocalBins(indices) =
+            value(Vector3D(llCorner[0], llCorner[1], llCorner[2]));
+      }
+    }
+  }
+
+  using BField_t = InterpolatedBFieldMap<InterpolatedBFieldMapperXYZ>;
+  BField_t b(BField_t::Config(InterpolatedBFieldMapperXYZ(
+      XYZPositionTransform(), XYZFieldTransform(), std::move(g))));
+  BField_t::Cache bCache(mfContext);
+
+  ActsMatrixD<3, 3> derivative;
+  for (const Vector3D& pos : {Vector3D(-3, 2.5, 1.7), Vector3D(0.5, -1.2, -4),
+                              Vector3D(3.9, 3.9, 5.9)}) {
+    CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative, bCache), value(pos),
+                    1e-6);
+    CHECK_CLOSE_ABS(derivative, gradient(pos), 1e-9);
+    CHECK_CLOSE_REL(b.getField(pos, bCache), value(pos), 1e-6);
+    CHECK_CLOSE_REL(b.getFieldGradient(pos, derivative), value(pos), 1e-6);
+    CHECK_CLOSE_ABS(derivative, gradient(pos), 1e-9);
+  }
 }
 }  // namespace Test
 
@@ -68,6 +68,11 @@ BOOST_AUTO_TEST_CASE(TestInterpolatedBFieldMapInterfaceConsistency) {
   // define dummy mapper and field cell, we don't need them to do anything
   struct DummyFieldCell {
     Vector3D getField(const Vector3D&) const { return {0, 0, 0}; }
+    Vector3D getFieldGradient(const Vector3D&,
+                              ActsMatrixD<3, 3>& derivative) const {
+      derivative.setZero();
+      return {0, 0, 0};
+    }
     bool isInside(const Vector3D&) const { return true; }
   };
 
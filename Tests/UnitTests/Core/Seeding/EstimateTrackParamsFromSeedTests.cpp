@@ -0,0 +1,91 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/EstimateTrackParamsFromSeed.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cmath>
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+/// Space point with the full double precision of the helix positions
+struct HelixPoint {
+  Vector3D pos;
+  double x() const { return pos.x(); }
+  double y() const { return pos.y(); }
+  double z() const { return pos.z(); }
+};
+
+/// Position on a helix along the z axis after a transverse path length
+///
+/// The particle starts at the given vertex with the given transverse
+/// direction and bends clockwise for positive charges in a positive field.
+Vector3D helixPosition(const Vector3D& vertex, double phi0, double theta,
+                       double charge, double radius, double s) {
+  const double k = charge / radius;
+  const double phi = phi0 - k * s;
+  return vertex + Vector3D(-(std::sin(phi) - std::sin(phi0)) / k,
+                           (std::cos(phi) - std::cos(phi0)) / k,
+                           s / std::tan(theta));
+}
+
+BOOST_DATA_TEST_CASE(EstimateTrackParamsFromHelix,
+                     bdata::make({-1., 1.}) *
+                         bdata::make({-2.5, 0.3, 1.7}) *
+                         bdata::make({0.4, 1.2, 2.5}) *
+                         bdata::make({0.8_GeV, 5_GeV}),
+                     charge, phi0, theta, pt) {
+  const double bFieldZ = 2_T;
+  const double radius = pt / bFieldZ;
+  const Vector3D vertex(30_mm, -20_mm, 15_mm);
+
+  HelixPoint bottom{vertex};
+  HelixPoint middle{
+      helixPosition(vertex, phi0, theta, charge, radius, 60_mm)};
+  HelixPoint top{helixPosition(vertex, phi0, theta, charge, radius, 150_mm)};
+  Seed<HelixPoint> seed(bottom, middle, top, vertex.z());
+
+  BoundSymMatrix cov = BoundSymMatrix::Identity();
+  cov(eQOP, eQOP) = 0.1 * 0.1;
+  const auto params = estimateTrackParamsFromSeed(seed, bFieldZ, cov);
+
+  const double p = pt / std::sin(theta);
+  const Vector3D momentum(pt * std::cos(phi0), pt * std::sin(phi0),
+                          p * std::cos(theta));
+  BOOST_CHECK_EQUAL(params.charge(), charge);
+  CHECK_CLOSE_ABS(params.position(), vertex, 1e-9_mm);
+  CHECK_CLOSE_REL(params.momentum(), momentum, 1e-6);
+  BOOST_REQUIRE(params.covariance().has_value());
+  CHECK_CLOSE_REL((*params.covariance())(eQOP, eQOP), 0.01 / (p * p), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(EstimateTrackParamsFromStraightLine) {
+  // collinear space points result in a finite, very large momentum
+  HelixPoint bottom{Vector3D(10_mm, 10_mm, 0_mm)};
+  HelixPoint middle{Vector3D(20_mm, 20_mm, 10_mm)};
+  HelixPoint top{Vector3D(40_mm, 40_mm, 30_mm)};
+  Seed<HelixPoint> seed(bottom, middle, top, 0.);
+
+  const auto params =
+      estimateTrackParamsFromSeed(seed, 2_T, BoundSymMatrix::Identity());
+  BOOST_CHECK(std::isfinite(params.momentum().norm()));
+  BOOST_CHECK_GT(params.pT(), 1_TeV);
+  CHECK_CLOSE_REL(params.momentum().normalized(),
+                  Vector3D(1., 1., 1.).normalized(), 1e-6);
+}
+
+}  // namespace Test
+}  // namespace Acts
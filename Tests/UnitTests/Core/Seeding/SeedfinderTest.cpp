@@ -14,6 +14,7 @@
 #include "Acts/Seeding/SeedFilter.hpp"
 #include "Acts/Seeding/Seedfinder.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/detail/TripletCompatibility.hpp"
 
 #include <chrono>
 #include <fstream>
@@ -180,6 +181,43 @@ int main(int argc, char** argv) {
     numSeeds += outVec.size();
   }
   std::cout << "Number of seeds generated: " << numSeeds << std::endl;
+  if (numSeeds == 0) {
+    std::cerr << "No seeds found by the default seed finder" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the vectorized triplet search must find exactly the same seeds. It falls
+  // back to the default loop without a SIMD instruction set, i.e. the
+  // comparison would be meaningless there.
+  if (Acts::detail::simdSupported()) {
+    Acts::Seedfinder<SpacePoint, Acts::CpuSimd> simdFinder(config);
+    std::vector<std::vector<Acts::Seed<SpacePoint>>> simdSeedVector;
+    auto start_simd = std::chrono::system_clock::now();
+    for (groupIt = spGroup.begin(); !(groupIt == endOfGroups); ++groupIt) {
+      simdSeedVector.push_back(simdFinder.createSeedsForGroup(
+          groupIt.bottom(), groupIt.middle(), groupIt.top()));
+    }
+    auto end_simd = std::chrono::system_clock::now();
+    std::chrono::duration<double> elapsed_simd = end_simd - start_simd;
+    std::cout << "time to create seeds (SIMD): " << elapsed_simd.count()
+              << std::endl;
+    bool identical = (simdSeedVector.size() == seedVector.size());
+    for (size_t i = 0; identical and i < seedVector.size(); ++i) {
+      identical = (simdSeedVector[i].size() == seedVector[i].size());
+      for (size_t j = 0; identical and j < seedVector[i].size(); ++j) {
+        identical = (simdSeedVector[i][j].sp() == seedVector[i][j].sp() and
+                     simdSeedVector[i][j].z() == seedVector[i][j].z());
+      }
+    }
+    if (not identical) {
+      std::cerr << "SIMD seeds differ from the default seeds" << std::endl;
+      return EXIT_FAILURE;
+    }
+  } else {
+    std::cout << "SIMD instruction set not enabled or not supported, skip "
+                 "the comparison of the vectorized triplet search"
+              << std::endl;
+  }
   if (!quiet) {
     for (auto& regionVec : seedVector) {
       for (size_t i = 0; i < regionVec.size(); i++) {
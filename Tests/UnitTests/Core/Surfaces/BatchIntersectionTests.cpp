@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BatchIntersection.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <random>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+// Some random transform
+Transform3D transform = Transform3D::Identity() *
+                        Translation3D(0.1_m, -0.2_m, 1_m) *
+                        AngleAxis3D(0.15, Vector3D(1.2, 1.2, 0.12).normalized());
+
+// A block of random tracks around the origin
+RayBlock randomRays(size_t size) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<> offset(-10_cm, 10_cm);
+  std::uniform_real_distribution<> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<> cosTheta(-1., 1.);
+  RayBlock rays(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double ct = cosTheta(rng);
+    const double st = std::sqrt(1 - ct * ct);
+    const double ph = phi(rng);
+    rays.set(i, Vector3D(offset(rng), offset(rng), offset(rng)),
+             Vector3D(std::cos(ph) * st, std::sin(ph) * st, ct));
+  }
+  // a direction parallel to the plane
+  const Vector3D axis = transform.matrix().block<3, 1>(0, 2);
+  rays.set(0, Vector3D::Zero(), Vector3D(axis.y(), -axis.x(), 0.));
+  return rays;
+}
+
+// The batch has to give the intersections of the surface
+template <typename surface_t>
+void checkBatch(const surface_t& surface, const RayBlock& rays,
+                const BoundaryCheck& bcheck) {
+  IntersectionBlock intersections;
+  BatchIntersection::intersect(tgContext, surface, rays, bcheck,
+                               intersections);
+  BOOST_CHECK_EQUAL(intersections.size(), rays.size());
+  size_t nValid = 0;
+  for (size_t i = 0; i < rays.size(); ++i) {
+    const Vector3D position(rays.x[i], rays.y[i], rays.z[i]);
+    const Vector3D direction(rays.dx[i], rays.dy[i], rays.dz[i]);
+    const auto reference =
+        surface.intersect(tgContext, position, direction, bcheck).intersection;
+    const auto intersection = intersections[i];
+    BOOST_CHECK(intersection.status == reference.status);
+    if (reference.status != Intersection::Status::unreachable) {
+      CHECK_CLOSE_ABS(intersection.pathLength, reference.pathLength, 1e-9);
+      CHECK_CLOSE_ABS(intersection.position, reference.position, 1e-9);
+      ++nValid;
+    }
+  }
+  // the test covers valid intersections
+  BOOST_CHECK_GT(nValid, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+BOOST_AUTO_TEST_CASE(BatchIntersectionPlane) {
+  const auto rays = randomRays(1000);
+  auto rectangle = Surface::makeShared<PlaneSurface>(
+      std::make_shared<Transform3D>(transform),
+      std::make_shared<RectangleBounds>(0.5_m, 1_m));
+  auto trapezoid = Surface::makeShared<PlaneSurface>(
+      std::make_shared<Transform3D>(transform),
+      std::make_shared<TrapezoidBounds>(0.3_m, 0.6_m, 1_m));
+  for (const auto* surface : {rectangle.get(), trapezoid.get()}) {
+    checkBatch(*surface, rays, false);
+    checkBatch(*surface, rays, true);
+    checkBatch(*surface, rays, BoundaryCheck(true, false, 0.1_m, 0.));
+    checkBatch(*surface, rays,
+               BoundaryCheck(SymMatrix2D::Identity() * 1_cm, 3.));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchIntersectionPlaneParallel) {
+  // directions within the plane never reach it, independent of the bounds
+  const Transform3D shifted(Translation3D(0.1_m, -0.2_m, 1_m));
+  RayBlock rays(3);
+  rays.set(0, Vector3D::Zero(), Vector3D(1., 0., 0.));
+  rays.set(1, Vector3D(1_cm, 2_cm, 3_cm), Vector3D(0., -1., 0.));
+  rays.set(2, shifted.translation(), Vector3D(1., 1., 0.).normalized());
+  auto rectangle = Surface::makeShared<PlaneSurface>(
+      std::make_shared<Transform3D>(shifted),
+      std::make_shared<RectangleBounds>(0.5_m, 1_m));
+  auto trapezoid = Surface::makeShared<PlaneSurface>(
+      std::make_shared<Transform3D>(shifted),
+      std::make_shared<TrapezoidBounds>(0.3_m, 0.6_m, 1_m));
+  for (const auto* surface : {rectangle.get(), trapezoid.get()}) {
+    for (const auto& bcheck :
+         {BoundaryCheck(false), BoundaryCheck(true),
+          BoundaryCheck(true, false, 0.1_m, 0.)}) {
+      IntersectionBlock intersections;
+      BatchIntersection::intersect(tgContext, *surface, rays, bcheck,
+                                   intersections);
+      for (size_t i = 0; i < rays.size(); ++i) {
+        const Vector3D position(rays.x[i], rays.y[i], rays.z[i]);
+        const Vector3D direction(rays.dx[i], rays.dy[i], rays.dz[i]);
+        const auto reference =
+            surface->intersect(tgContext, position, direction, bcheck)
+                .intersection;
+        BOOST_CHECK(reference.status == Intersection::Status::unreachable);
+        BOOST_CHECK(intersections[i].status == reference.status);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchIntersectionCylinder) {
+  const auto rays = randomRays(1000);
+  auto full = Surface::makeShared<CylinderSurface>(
+      std::make_shared<Transform3D>(transform),
+      std::make_shared<CylinderBounds>(0.5_m, 0.8_m));
+  auto sector = Surface::makeShared<CylinderSurface>(
+      std::make_shared<Transform3D>(transform),
+      std::make_shared<CylinderBounds>(0.5_m, 0.8_m, 0.5 * M_PI));
+  for (const auto* surface : {full.get(), sector.get()}) {
+    checkBatch(*surface, rays, false);
+    checkBatch(*surface, rays, true);
+    checkBatch(*surface, rays, BoundaryCheck(true, true, 0.1, 0.1_m));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchIntersectionSurfaces) {
+  const auto rays = randomRays(100);
+  std::vector<std::shared_ptr<PlaneSurface>> planes;
+  std::vector<const PlaneSurface*> surfaces;
+  for (int ip = 0; ip < 5; ++ip) {
+    planes.push_back(Surface::makeShared<PlaneSurface>(
+        std::make_shared<Transform3D>(transform *
+                                      Translation3D(0., 0., ip * 10_cm)),
+        std::make_shared<RectangleBounds>(0.5_m, 1_m)));
+    surfaces.push_back(planes.back().get());
+  }
+  std::vector<IntersectionBlock> intersections;
+  BatchIntersection::intersect(tgContext, surfaces, rays, true,
+                               intersections);
+  BOOST_CHECK_EQUAL(intersections.size(), surfaces.size());
+  for (size_t is = 0; is < surfaces.size(); ++is) {
+    IntersectionBlock single;
+    BatchIntersection::intersect(tgContext, *surfaces[is], rays, true,
+                                 single);
+    BOOST_CHECK(intersections[is].status == single.status);
+    BOOST_CHECK((intersections[is].pathLength == single.pathLength).all());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -10,6 +10,7 @@
 
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Fitter/GainMatrixSmoother.hpp"
 #include "Acts/Fitter/GainMatrixUpdater.hpp"
@@ -25,6 +26,7 @@
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -272,6 +274,24 @@ BOOST_AUTO_TEST_CASE(comb_kalman_filter_zero_field) {
   // There should be 18 source links in total
   BOOST_CHECK_EQUAL(sourcelinks.size(), 18);
 
+  // Index the source links by surface once for all track finding calls
+  SourceLinkIndex<SourceLink> sourcelinkIndex(sourcelinks);
+  BOOST_CHECK_EQUAL(sourcelinkIndex.size(), 18);
+  // Each of the three tracks leaves one measurement on every of six surfaces
+  BOOST_CHECK_EQUAL(sourcelinkIndex.numSurfaces(), 6);
+  for (const auto& sl : sourcelinks) {
+    auto onSurface = sourcelinkIndex.find(sl.referenceSurface());
+    BOOST_CHECK_EQUAL(onSurface.size(), 3);
+    BOOST_CHECK(std::find(onSurface.begin(), onSurface.end(), sl) !=
+                onSurface.end());
+    for (const auto& other : onSurface) {
+      BOOST_CHECK_EQUAL(&other.referenceSurface(), &sl.referenceSurface());
+    }
+  }
+  auto freeSurface = Surface::makeShared<PlaneSurface>(Vector3D(0., 0., 0.),
+                                                       Vector3D(1., 0., 0.));
+  BOOST_CHECK(sourcelinkIndex.find(*freeSurface).empty());
+
   // The CombinatorialKalmanFilter - we use the eigen stepper for covariance
   // transport Build navigator for the measurement creatoin
   Navigator rNavigator(detector);
@@ -311,6 +331,9 @@ BOOST_AUTO_TEST_CASE(comb_kalman_filter_zero_field) {
       rPropagator,
       getDefaultLogger("CombinatorialKalmanFilter", Logging::VERBOSE));
 
+  // Keep the starting parameters for the batched track finding
+  std::vector<SingleCurvilinearTrackParameters<ChargedPolicy>> startParameters;
+
   // Run the CombinaltorialKamanFitter for track finding from different starting
   // parameter
   for (const auto& [trackID, pos] : startingPos) {
@@ -329,6 +352,7 @@ BOOST_AUTO_TEST_CASE(comb_kalman_filter_zero_field) {
 
     SingleCurvilinearTrackParameters<ChargedPolicy> rStart(cov, rPos, rMom, 1.,
                                                            42.);
+    startParameters.push_back(rStart);
 
     const Surface* rSurface = &rStart.referenceSurface();
 
@@ -336,9 +360,17 @@ BOOST_AUTO_TEST_CASE(comb_kalman_filter_zero_field) {
         tgContext, mfContext, calContext, sourcelinkSelectorConfig, rSurface);
 
     // Found the track(s)
-    auto combKalmanFilterRes = cKF.findTracks(sourcelinks, rStart, ckfOptions);
+    auto combKalmanFilterRes =
+        cKF.findTracks(sourcelinkIndex, rStart, ckfOptions);
     BOOST_CHECK(combKalmanFilterRes.ok());
     auto foundTrack = *combKalmanFilterRes;
+
+    // Indexing the source links per call must give the same result
+    auto combKalmanFilterResNoIndex =
+        cKF.findTracks(sourcelinks, rStart, ckfOptions);
+    BOOST_CHECK(combKalmanFilterResNoIndex.ok());
+    BOOST_CHECK(combKalmanFilterResNoIndex.value().trackTips ==
+                foundTrack.trackTips);
     auto& fittedStates = foundTrack.fittedStates;
     auto& trackTips = foundTrack.trackTips;
 
@@ -359,6 +391,50 @@ BOOST_AUTO_TEST_CASE(comb_kalman_filter_zero_field) {
       BOOST_CHECK_EQUAL(numFakeHit, 0);
     }
   }
+
+  // Run the track finding for all starting parameters in one batch with a
+  // common target surface
+  CombinatorialKalmanFilterOptions<SourceLinkSelector> ckfOptions(
+      tgContext, mfContext, calContext, sourcelinkSelectorConfig,
+      &startParameters.front().referenceSurface());
+  CombinatorialKalmanFilterScratch<SourceLink> scratch;
+  auto batchResults =
+      cKF.findTracks(sourcelinkIndex, startParameters.begin(),
+                     startParameters.end(), ckfOptions, &scratch);
+  BOOST_CHECK_EQUAL(batchResults.size(), startParameters.size());
+  // All branches of the last seed have been processed
+  BOOST_CHECK(scratch.activeTips.empty());
+  auto collectSourceIds = [](const auto& track, size_t tip) {
+    std::vector<size_t> sourceIds;
+    track.fittedStates.visitBackwards(tip, [&](const auto& trackState) {
+      sourceIds.push_back(trackState.uncalibrated().sourceID);
+    });
+    return sourceIds;
+  };
+  for (size_t iseed = 0; iseed < startParameters.size(); ++iseed) {
+    // The reused buffers must not change the result of the single calls
+    auto singleResult =
+        cKF.findTracks(sourcelinkIndex, startParameters[iseed], ckfOptions);
+    BOOST_CHECK(singleResult.ok());
+    BOOST_CHECK(batchResults[iseed].ok());
+    const auto& batchTrack = batchResults[iseed].value();
+    const auto& singleTrack = singleResult.value();
+    BOOST_CHECK_EQUAL(batchTrack.trackTips.size(),
+                      singleTrack.trackTips.size());
+    // Only the states of the found tracks are copied out of the scratch
+    BOOST_CHECK_LE(batchTrack.fittedStates.size(),
+                   singleTrack.fittedStates.size());
+    for (size_t itrack = 0; itrack < batchTrack.trackTips.size(); ++itrack) {
+      size_t batchTip = batchTrack.trackTips[itrack];
+      size_t singleTip = singleTrack.trackTips[itrack];
+      BOOST_CHECK(collectSourceIds(batchTrack, batchTip) ==
+                  collectSourceIds(singleTrack, singleTip));
+      BOOST_CHECK_EQUAL(batchTrack.fittedParameters.count(batchTip),
+                        singleTrack.fittedParameters.count(singleTip));
+    }
+    BOOST_CHECK_EQUAL(batchTrack.fittedParameters.size(),
+                      singleTrack.fittedParameters.size());
+  }
 }
 
 }  // namespace Test
@@ -14,6 +14,10 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
 namespace bdata = boost::unit_test::data;
 
 using Acts::VectorHelpers::perp;
@@ -133,6 +137,15 @@ BOOST_AUTO_TEST_CASE(bfield_creation) {
   CHECK_CLOSE_ABS(value0_xyz, b0_xyz, 1e-9);
   CHECK_CLOSE_ABS(value1_xyz, b1_xyz, 1e-9);
   CHECK_CLOSE_ABS(value2_xyz, b2_xyz, 1e-9);
+
+  // the mappers convert to the type-erased mappers of the same grid type
+  InterpolatedBFieldMapper<Grid<Vector2D, EquidistantAxis, EquidistantAxis>>
+      erased_rz = mapper_rz;
+  InterpolatedBFieldMapper<
+      Grid<Vector3D, EquidistantAxis, EquidistantAxis, EquidistantAxis>>
+      erased_xyz = mapper_xyz;
+  CHECK_CLOSE_ABS(erased_rz.getField(pos2_rz), value2_rz, 1e-9);
+  CHECK_CLOSE_ABS(erased_xyz.getField(pos1_xyz), value1_xyz, 1e-9);
 }
 
 BOOST_AUTO_TEST_CASE(bfield_symmetry) {
@@ -351,5 +364,147 @@ BOOST_DATA_TEST_CASE(
   CHECK_CLOSE_REL(value0_xyz, value3_xyz, 1e-10);
   CHECK_CLOSE_REL(value0_xyz, value4_xyz, 1e-10);
 }
+
+BOOST_AUTO_TEST_CASE(bfield_compact_storage) {
+  // xyz map with a smooth, non-trivial field on a 5x5x5 grid
+  std::vector<double> xPos, yPos, zPos;
+  for (size_t i = 0; i < 5; i++) {
+    xPos.push_back(i * 1.);
+    yPos.push_back(i * 2.);
+    zPos.push_back(i * 3.);
+  }
+  std::vector<Acts::Vector3D> bField_xyz;
+  for (size_t i = 0; i < 125; i++) {
+    bField_xyz.push_back(
+        Acts::Vector3D(std::sin(0.1 * i), 2. - 0.01 * i, std::cos(0.3 * i)));
+  }
+  auto mapper = Acts::fieldMapperXYZ(
+      [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      xPos, yPos, zPos, bField_xyz, 1, 1, false);
+
+  auto mapper_f = Acts::compactFieldMapper<float>(mapper);
+  auto mapper_s = Acts::compactFieldMapper<int16_t>(mapper);
+  static_assert(std::is_same_v<decltype(mapper_f),
+                               Acts::CompactBFieldMapperXYZ<float>>,
+                "Unexpected float mapper type");
+  static_assert(std::is_same_v<decltype(mapper_s),
+                               Acts::CompactBFieldMapperXYZ<int16_t>>,
+                "Unexpected int16 mapper type");
+  static_assert(sizeof(decltype(mapper_f)::StoredType) == 3 * sizeof(float),
+                "Unexpected float storage size");
+  static_assert(sizeof(decltype(mapper_s)::StoredType) == 3 * sizeof(int16_t),
+                "Unexpected int16 storage size");
+
+  // binning is unchanged
+  BOOST_CHECK(mapper_f.getNBins() == mapper.getNBins());
+  BOOST_CHECK(mapper_s.getNBins() == mapper.getNBins());
+  BOOST_CHECK(mapper_f.getMin() == mapper.getMin());
+  BOOST_CHECK(mapper_s.getMax() == mapper.getMax());
+
+  // largest field component is 2, i.e. one fixed-point unit is 2 / 32767
+  CHECK_CLOSE_REL(mapper_s.getStorage().scale, 2. / 32767, 1e-10);
+  const double tol_s = 0.5 * mapper_s.getStorage().scale;
+
+  for (const Acts::Vector3D& pos :
+       {Acts::Vector3D(0., 0., 0.), Acts::Vector3D(1.5, 2.7, 4.1),
+        Acts::Vector3D(3.2, 7.9, 11.5), Acts::Vector3D(0.3, 5., 8.2)}) {
+    const Acts::Vector3D field = mapper.getField(pos);
+    CHECK_CLOSE_ABS(mapper_f.getField(pos), field, 1e-6);
+    CHECK_CLOSE_ABS(mapper_s.getField(pos), field, tol_s);
+    CHECK_CLOSE_ABS(mapper_f.getFieldCell(pos).getField(pos), field, 1e-6);
+    CHECK_CLOSE_ABS(mapper_s.getFieldCell(pos).getField(pos), field, tol_s);
+  }
+
+  // rz maps keep the field transformation
+  std::vector<Acts::Vector2D> bField_rz;
+  for (size_t i = 0; i < 25; i++) {
+    bField_rz.push_back(Acts::Vector2D(0.1 * i, 1. - 0.05 * i));
+  }
+  auto mapper_rz = Acts::fieldMapperRZ(
+      [](std::array<size_t, 2> binsRZ, std::array<size_t, 2> nBinsRZ) {
+        return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+      },
+      xPos, zPos, bField_rz, 1, 1, false);
+  auto mapper_rz_s = Acts::compactFieldMapper<int16_t>(mapper_rz);
+  static_assert(std::is_same_v<decltype(mapper_rz_s),
+                               Acts::CompactBFieldMapperRZ<int16_t>>,
+                "Unexpected int16 rz mapper type");
+  const Acts::Vector3D pos_rz(1., 1.5, 4.);
+  CHECK_CLOSE_ABS(mapper_rz_s.getField(pos_rz), mapper_rz.getField(pos_rz),
+                  0.5 * mapper_rz_s.getStorage().scale);
+}
+
+BOOST_AUTO_TEST_CASE(bfield_compact_builders) {
+  std::vector<double> xPos, yPos, zPos;
+  for (size_t i = 0; i < 4; i++) {
+    xPos.push_back(i * 1.);
+    yPos.push_back(i * 2.);
+    zPos.push_back(i * 3.);
+  }
+  std::vector<Acts::Vector3D> bField_xyz;
+  for (size_t i = 0; i < 64; i++) {
+    bField_xyz.push_back(
+        Acts::Vector3D(std::sin(0.1 * i), -3. + 0.01 * i, std::cos(0.3 * i)));
+  }
+  auto localToGlobalBin_xyz = [](std::array<size_t, 3> binsXYZ,
+                                 std::array<size_t, 3> nBinsXYZ) {
+    return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+            binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+  };
+  const double BFieldUnit = 2.;
+  auto mapper = Acts::fieldMapperXYZ(localToGlobalBin_xyz, xPos, yPos, zPos,
+                                     bField_xyz, 1, BFieldUnit, true);
+
+  // the compact maps are built directly, with the same content as the
+  // converted double map
+  auto mapper_f = Acts::fieldMapperXYZ<float>(
+      localToGlobalBin_xyz, xPos, yPos, zPos, bField_xyz, 1, BFieldUnit, true);
+  auto mapper_s = Acts::fieldMapperXYZ<int16_t>(
+      localToGlobalBin_xyz, xPos, yPos, zPos, bField_xyz, 1, BFieldUnit, true);
+  static_assert(std::is_same_v<decltype(mapper_f),
+                               Acts::CompactBFieldMapperXYZ<float>>,
+                "Unexpected float mapper type");
+  static_assert(std::is_same_v<decltype(mapper_s),
+                               Acts::CompactBFieldMapperXYZ<int16_t>>,
+                "Unexpected int16 mapper type");
+  const auto converted_f = Acts::compactFieldMapper<float>(mapper);
+  const auto converted_s = Acts::compactFieldMapper<int16_t>(mapper);
+
+  // largest field component is 3 in units of 2
+  CHECK_CLOSE_REL(mapper_s.getStorage().scale, 6. / 32767, 1e-10);
+  CHECK_CLOSE_REL(mapper_s.getStorage().scale,
+                  converted_s.getStorage().scale, 1e-10);
+  BOOST_CHECK(mapper_f.getNBins() == mapper.getNBins());
+  BOOST_CHECK(mapper_s.getNBins() == mapper.getNBins());
+  const auto& grid = mapper.getGrid();
+  for (size_t bin = 0; bin < grid.size(); ++bin) {
+    BOOST_CHECK(mapper_f.getGrid().at(bin) == converted_f.getGrid().at(bin));
+    BOOST_CHECK(mapper_s.getGrid().at(bin) == converted_s.getGrid().at(bin));
+  }
+
+  // rz maps
+  std::vector<Acts::Vector2D> bField_rz;
+  for (size_t i = 0; i < 16; i++) {
+    bField_rz.push_back(Acts::Vector2D(0.1 * i, 1. - 0.05 * i));
+  }
+  auto localToGlobalBin_rz = [](std::array<size_t, 2> binsRZ,
+                                std::array<size_t, 2> nBinsRZ) {
+    return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+  };
+  auto mapper_rz = Acts::fieldMapperRZ(localToGlobalBin_rz, xPos, zPos,
+                                       bField_rz, 1, BFieldUnit, false);
+  auto mapper_rz_f = Acts::fieldMapperRZ<float>(
+      localToGlobalBin_rz, xPos, zPos, bField_rz, 1, BFieldUnit, false);
+  static_assert(std::is_same_v<decltype(mapper_rz_f),
+                               Acts::CompactBFieldMapperRZ<float>>,
+                "Unexpected float rz mapper type");
+  for (const Acts::Vector3D& pos :
+       {Acts::Vector3D(1., 1.5, 4.), Acts::Vector3D(-0.5, 2.1, 7.3)}) {
+    CHECK_CLOSE_ABS(mapper_rz_f.getField(pos), mapper_rz.getField(pos), 1e-6);
+  }
+}
 }  // namespace Test
 }  // namespace Acts
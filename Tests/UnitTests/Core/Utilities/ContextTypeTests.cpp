@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/ContextType.hpp"
+
+#include <any>
+#include <utility>
+#include <vector>
+
+namespace {
+struct Payload {
+  unsigned int iov = 0;
+  std::vector<double> store;
+};
+}  // namespace
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(context_type_empty) {
+  ContextType context;
+  BOOST_CHECK(not context.has_value());
+  BOOST_CHECK_EQUAL(context.get<Payload>(), nullptr);
+  BOOST_CHECK_THROW(std::any_cast<Payload>(context), std::bad_any_cast);
+}
+
+BOOST_AUTO_TEST_CASE(context_type_payload) {
+  GeometryContext context = Payload{3u, {1., 2.}};
+  const Payload* payload = context.get<Payload>();
+  BOOST_REQUIRE_NE(payload, nullptr);
+  BOOST_CHECK_EQUAL(payload->iov, 3u);
+  // the fast path points to the payload stored in the std::any
+  BOOST_CHECK_EQUAL(payload,
+                    std::any_cast<Payload>(static_cast<std::any*>(&context)));
+  // the std::any interface keeps working
+  BOOST_CHECK_EQUAL(std::any_cast<Payload>(context).store.size(), 2u);
+  BOOST_CHECK_EQUAL(context.get<int>(), nullptr);
+
+  // re-assignment with a different payload type
+  context = 5;
+  BOOST_CHECK_EQUAL(context.get<Payload>(), nullptr);
+  BOOST_REQUIRE_NE(context.get<int>(), nullptr);
+  BOOST_CHECK_EQUAL(*context.get<int>(), 5);
+
+  context.reset();
+  BOOST_CHECK(not context.has_value());
+  BOOST_CHECK_EQUAL(context.get<int>(), nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(context_type_copy_move) {
+  GeometryContext context = Payload{1u, {1., 2., 3.}};
+
+  // copies resolve their own payload
+  GeometryContext copy = context;
+  BOOST_REQUIRE_NE(copy.get<Payload>(), nullptr);
+  BOOST_CHECK_NE(copy.get<Payload>(), context.get<Payload>());
+  BOOST_CHECK_EQUAL(copy.get<Payload>()->store.size(), 3u);
+  copy = GeometryContext(Payload{2u, {}});
+  BOOST_CHECK_EQUAL(copy.get<Payload>()->iov, 2u);
+  BOOST_CHECK_EQUAL(copy.get<Payload>(),
+                    std::any_cast<Payload>(static_cast<std::any*>(&copy)));
+
+  GeometryContext moved = std::move(context);
+  BOOST_REQUIRE_NE(moved.get<Payload>(), nullptr);
+  BOOST_CHECK_EQUAL(moved.get<Payload>()->iov, 1u);
+  BOOST_CHECK_EQUAL(moved.get<Payload>(),
+                    std::any_cast<Payload>(static_cast<std::any*>(&moved)));
+}
+
+BOOST_AUTO_TEST_CASE(context_type_from_any) {
+  // a plain std::any has no typed fast path, but the payload is still found
+  std::any any = Payload{4u, {}};
+  GeometryContext context = any;
+  BOOST_REQUIRE_NE(context.get<Payload>(), nullptr);
+  BOOST_CHECK_EQUAL(context.get<Payload>()->iov, 4u);
+}
+
+BOOST_AUTO_TEST_CASE(context_type_emplace_swap) {
+  GeometryContext context = 1;
+  Payload& emplaced = context.emplace<Payload>(Payload{6u, {1.}});
+  BOOST_CHECK_EQUAL(context.get<int>(), nullptr);
+  BOOST_CHECK_EQUAL(context.get<Payload>(), &emplaced);
+  BOOST_CHECK_EQUAL(context.get<Payload>(), std::any_cast<Payload>(&context));
+
+  GeometryContext other = 2;
+  context.swap(other);
+  BOOST_REQUIRE_NE(context.get<int>(), nullptr);
+  BOOST_CHECK_EQUAL(*context.get<int>(), 2);
+  BOOST_REQUIRE_NE(other.get<Payload>(), nullptr);
+  BOOST_CHECK_EQUAL(other.get<Payload>()->iov, 6u);
+  BOOST_CHECK_EQUAL(other.get<Payload>(), std::any_cast<Payload>(&other));
+
+  // a context is copied, not stored as the payload of another one
+  GeometryContext copy(other);
+  BOOST_CHECK(copy.type() == typeid(Payload));
+  BOOST_CHECK_EQUAL(std::any_cast<const Payload&>(copy).iov, 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -11,9 +11,14 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
+#include "Acts/Utilities/detail/GridView.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 namespace Acts {
 
@@ -1267,6 +1272,59 @@ BOOST_AUTO_TEST_CASE(closestPoints) {
   // clang-format on
 }
 
+BOOST_AUTO_TEST_CASE(grid_view_roundtrip) {
+  using Point = std::array<double, 2>;
+  using Grid_t = Grid<double, EquidistantAxis, EquidistantAxis>;
+  using GridView_t = GridView<double, EquidistantAxis, EquidistantAxis>;
+
+  // 2x3 bins plus under-/overflow bins
+  Grid_t g(std::make_tuple(EquidistantAxis(0.0, 2.0, 2u),
+                           EquidistantAxis(0.0, 3.0, 3u)));
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    g.at(bin) = 0.5 * bin - 3.;
+  }
+
+  // write the raw values and load them back into an external buffer
+  std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
+  buffer.write(reinterpret_cast<const char*>(g.data()),
+               g.size() * sizeof(double));
+  auto values = std::make_shared<std::vector<double>>(g.size());
+  buffer.read(reinterpret_cast<char*>(values->data()),
+              values->size() * sizeof(double));
+  BOOST_CHECK(buffer.good());
+
+  GridView_t view(g.axesTuple(), values->data(), values);
+  BOOST_CHECK_EQUAL(view.size(), g.size());
+  BOOST_CHECK_EQUAL(view.data(), values->data());
+  BOOST_CHECK(view.numLocalBins() == g.numLocalBins());
+  BOOST_CHECK(view.minPosition() == g.minPosition());
+  BOOST_CHECK(view.maxPosition() == g.maxPosition());
+
+  // all bin contents survive the roundtrip
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    BOOST_CHECK_EQUAL(view.at(bin), g.at(bin));
+    BOOST_CHECK_EQUAL(view.atLocalBins(view.localBinsFromGlobalBin(bin)),
+                      g.at(bin));
+  }
+  BOOST_CHECK_THROW(view.at(g.size()), std::out_of_range);
+
+  // position look-up and interpolation agree with the owning grid
+  for (const auto& pos : {Point({{0.5, 1.5}}), Point({{1.2, 0.1}}),
+                          Point({{0.0, 2.9}}), Point({{1.99, 2.5}})}) {
+    BOOST_CHECK_EQUAL(view.atPosition(pos), g.atPosition(pos));
+    BOOST_CHECK_EQUAL(view.isInside(pos), g.isInside(pos));
+    CHECK_CLOSE_REL(view.interpolate(pos), g.interpolate(pos), 1e-10);
+  }
+
+  // copies share the values and keep them alive
+  GridView_t copy = view;
+  BOOST_CHECK_EQUAL(copy.data(), values->data());
+  BOOST_CHECK_EQUAL(values.use_count(), 3);
+
+  BOOST_CHECK_THROW(GridView_t(g.axesTuple(), nullptr, nullptr),
+                    std::invalid_argument);
+}
+
 }  // namespace Test
 
 }  // namespace Acts
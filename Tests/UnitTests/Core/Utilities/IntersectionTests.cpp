@@ -12,6 +12,7 @@
 #include "Acts/Utilities/Intersection.hpp"
 
 #include <algorithm>
+#include <random>
 
 namespace Acts {
 namespace Test {
@@ -199,5 +200,59 @@ BOOST_AUTO_TEST_CASE(ObjectIntersectionTest) {
   BOOST_CHECK_EQUAL(unionSetCst.size(), 5u);
 }
 
+/// test of the hybrid intersection sorting against std::sort
+BOOST_AUTO_TEST_CASE(SortIntersectionsTest) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> pathDist(-100., 100.);
+  std::bernoulli_distribution unreachableDist(0.1);
+
+  // compare the valid intersections by path length, the unreachable ones
+  // are equivalent to each other and only have to be moved to the back
+  auto checkEqual = [](const std::vector<Intersection>& sorted,
+                       const std::vector<Intersection>& reference) {
+    BOOST_CHECK_EQUAL(sorted.size(), reference.size());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+      BOOST_CHECK(sorted[i].status == reference[i].status);
+      if (reference[i].status != Intersection::Status::unreachable) {
+        BOOST_CHECK_EQUAL(sorted[i].pathLength, reference[i].pathLength);
+      }
+    }
+  };
+
+  // sizes on both sides of the insertion sort threshold of 32
+  for (size_t size : {0u, 1u, 2u, 7u, 31u, 32u, 33u, 100u}) {
+    std::vector<Intersection> input;
+    for (size_t i = 0; i < size; ++i) {
+      auto status = unreachableDist(rng) ? Intersection::Status::unreachable
+                                         : Intersection::Status::reachable;
+      input.emplace_back(Vector3D(0., 0., 0.), pathDist(rng), status);
+    }
+    // random order, nearly ordered and reversed input
+    std::vector<std::vector<Intersection>> inputs = {input};
+    std::vector<Intersection> ordered = input;
+    std::sort(ordered.begin(), ordered.end());
+    if (size > 2) {
+      std::swap(ordered[0], ordered[1]);
+      std::swap(ordered[size - 2], ordered[size - 1]);
+    }
+    inputs.push_back(ordered);
+    inputs.emplace_back(ordered.rbegin(), ordered.rend());
+
+    for (const auto& unsorted : inputs) {
+      for (NavigationDirection navDir : {forward, backward}) {
+        std::vector<Intersection> sorted = unsorted;
+        sortIntersections(sorted.begin(), sorted.end(), navDir);
+        std::vector<Intersection> reference = unsorted;
+        if (navDir == forward) {
+          std::sort(reference.begin(), reference.end());
+        } else {
+          std::sort(reference.begin(), reference.end(), std::greater<>());
+        }
+        checkEqual(sorted, reference);
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
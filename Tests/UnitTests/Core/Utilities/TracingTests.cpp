@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Tracing.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+// Records all markers as "+name" and "-name"
+struct RecordingTracer : public Tracing::Tracer {
+  std::vector<std::string> markers;
+
+  void begin(const char* name) override {
+    markers.push_back(std::string("+") + name);
+  }
+  void end(const char* name) override {
+    markers.push_back(std::string("-") + name);
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(ScopedMarkerTests) {
+  RecordingTracer recorder;
+  BOOST_CHECK(Tracing::tracer() == nullptr);
+  {
+    // no tracer set
+    Tracing::ScopedMarker marker("ignored");
+  }
+  Tracing::setTracer(&recorder);
+  BOOST_CHECK(Tracing::tracer() == &recorder);
+  {
+    Tracing::ScopedMarker outer("outer");
+    {
+      Tracing::ScopedMarker inner("inner");
+    }
+  }
+  Tracing::setTracer(nullptr);
+  {
+    Tracing::ScopedMarker marker("ignored");
+  }
+  const std::vector<std::string> expected = {"+outer", "+inner", "-inner",
+                                             "-outer"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(recorder.markers.begin(),
+                                recorder.markers.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(TraceScopeMacroTests) {
+  RecordingTracer recorder;
+  Tracing::setTracer(&recorder);
+  {
+    ACTS_TRACE_SCOPE("first");
+    ACTS_TRACE_SCOPE("second");
+  }
+  Tracing::setTracer(nullptr);
+#ifdef ACTS_ENABLE_TRACING
+  const std::vector<std::string> expected = {"+first", "+second", "-second",
+                                             "-first"};
+#else
+  // the markers are compiled out
+  const std::vector<std::string> expected = {};
+#endif
+  BOOST_CHECK_EQUAL_COLLECTIONS(recorder.markers.begin(),
+                                recorder.markers.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
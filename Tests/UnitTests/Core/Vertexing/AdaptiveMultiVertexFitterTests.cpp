@@ -184,30 +184,24 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
        iTrack++) {
     // Index of current vertex
     int vtxIdx = (int)(iTrack / nTracksPerVtx);
-    state.vtxInfoMap[&(vtxList[vtxIdx])].trackLinks.push_back(
-        &(allTracks[iTrack]));
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList[vtxIdx])),
-                       TrackAtVertex<BoundParameters>(1., allTracks[iTrack],
-                                                      &(allTracks[iTrack]))));
+    state.addTrackAtVertex(&(vtxList[vtxIdx]),
+                           TrackAtVertex<BoundParameters>(
+                               1., allTracks[iTrack], &(allTracks[iTrack])));
 
     // Use first track also for second vertex to let vtx1 and vtx2
     // share this track
     if (iTrack == 0) {
-      state.vtxInfoMap[&(vtxList.at(1))].trackLinks.push_back(
-          &(allTracks[iTrack]));
-      state.tracksAtVerticesMap.insert(
-          std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList.at(1))),
-                         TrackAtVertex<BoundParameters>(1., allTracks[iTrack],
-                                                        &(allTracks[iTrack]))));
+      state.addTrackAtVertex(&(vtxList.at(1)),
+                             TrackAtVertex<BoundParameters>(
+                                 1., allTracks[iTrack], &(allTracks[iTrack])));
     }
   }
 
   for (auto& vtx : vtxPtrList) {
-    state.addVertexToMultiMap(*vtx);
+    state.addVertexToTracks(*vtx);
     if (debugMode) {
       std::cout << "Vertex, with ptr: " << vtx << std::endl;
-      for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+      for (auto& trk : state.vertexInfo(vtx).trackLinks) {
         std::cout << "\t track ptr: " << trk << std::endl;
       }
     }
@@ -218,9 +212,9 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
               << std::endl;
     for (auto& trk : allTracks) {
       std::cout << "Track with ptr: " << &trk << std::endl;
-      auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-      for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-        std::cout << "\t used by vertex: " << vtxIter->second << std::endl;
+      for (const auto& link : state.trackToVertices[state.trackIndex(&trk)]) {
+        std::cout << "\t used by vertex: " << state.vertices[link.first]
+                  << std::endl;
       }
     }
   }
@@ -237,7 +231,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
     for (auto& vtx : vtxPtrList) {
       c++;
       std::cout << c << ". vertex, with ptr: " << vtx << std::endl;
-      for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+      for (auto& trk : state.vertexInfo(vtx).trackLinks) {
         std::cout << "\t track ptr: " << trk << std::endl;
       }
     }
@@ -248,9 +242,9 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
               << std::endl;
     for (auto& trk : allTracks) {
       std::cout << "Track with ptr: " << &trk << std::endl;
-      auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-      for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-        std::cout << "\t used by vertex: " << vtxIter->second << std::endl;
+      for (const auto& link : state.trackToVertices[state.trackIndex(&trk)]) {
+        std::cout << "\t used by vertex: " << state.vertices[link.first]
+                  << std::endl;
       }
     }
   }
@@ -445,11 +439,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo1.oldPosition = vtxInfo1.linPoint;
   vtxInfo1.seedPosition = vtxInfo1.linPoint;
 
+  state.vertexInfo(&vtx1) = std::move(vtxInfo1);
   for (const auto& trk : params1) {
-    vtxInfo1.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx1),
-                       TrackAtVertex<BoundParameters>(1.5, trk, &trk)));
+    state.addTrackAtVertex(&vtx1,
+                           TrackAtVertex<BoundParameters>(1.5, trk, &trk));
   }
 
   // Prepare second vertex
@@ -472,18 +465,14 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo2.oldPosition = vtxInfo2.linPoint;
   vtxInfo2.seedPosition = vtxInfo2.linPoint;
 
+  state.vertexInfo(&vtx2) = std::move(vtxInfo2);
   for (const auto& trk : params2) {
-    vtxInfo2.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx2),
-                       TrackAtVertex<BoundParameters>(1.5, trk, &trk)));
+    state.addTrackAtVertex(&vtx2,
+                           TrackAtVertex<BoundParameters>(1.5, trk, &trk));
   }
 
-  state.vtxInfoMap[&vtx1] = std::move(vtxInfo1);
-  state.vtxInfoMap[&vtx2] = std::move(vtxInfo2);
-
-  state.addVertexToMultiMap(vtx1);
-  state.addVertexToMultiMap(vtx2);
+  state.addVertexToTracks(vtx1);
+  state.addVertexToTracks(vtx2);
 
   // Fit vertices
   fitter.fit(state, vtxList, linearizer, vertexingOptions);
@@ -0,0 +1,133 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+
+#include <random>
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+using TrackDensity = GaussianTrackDensity<BoundParameters>;
+
+// Create a test context
+GeometryContext geoContext = GeometryContext();
+
+// Create perigee surface
+std::shared_ptr<PerigeeSurface> perigeeSurface =
+    Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+// Random tracks from a number of vertices along the beam line
+std::vector<BoundParameters> randomTracks(size_t nTracks, unsigned int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<> vertexDist(-100_mm, 100_mm);
+  std::normal_distribution<> d0Dist(0., 30_um);
+  std::uniform_real_distribution<> resDist(20_um, 200_um);
+  std::vector<double> vertices(nTracks / 20 + 1);
+  for (auto& z : vertices) {
+    z = vertexDist(gen);
+  }
+  std::vector<BoundParameters> tracks;
+  for (size_t it = 0; it < nTracks; ++it) {
+    const double resD0 = resDist(gen);
+    const double resZ0 = resDist(gen);
+    Covariance covMat = Covariance::Identity();
+    covMat(eLOC_D0, eLOC_D0) = resD0 * resD0;
+    covMat(eLOC_Z0, eLOC_Z0) = resZ0 * resZ0;
+    covMat(eLOC_D0, eLOC_Z0) = covMat(eLOC_Z0, eLOC_D0) =
+        0.1 * resD0 * resZ0;
+    std::normal_distribution<> z0Dist(vertices[it % vertices.size()], resZ0);
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), 0., M_PI_2, 1_e / 1_GeV, 0.;
+    tracks.emplace_back(geoContext, covMat, paramVec, perigeeSurface);
+  }
+  return tracks;
+}
+
+// The density and its derivatives summing all tracks
+std::tuple<double, double, double> fullDensity(
+    const std::vector<TrackDensity::TrackEntry>& entries, double z) {
+  double density = 0.;
+  double firstDerivative = 0.;
+  double secondDerivative = 0.;
+  for (const auto& entry : entries) {
+    if (entry.lowerBound < z && z < entry.upperBound) {
+      double delta = std::exp(entry.c0 + z * (entry.c1 + z * entry.c2));
+      double qPrime = entry.c1 + 2. * z * entry.c2;
+      double deltaPrime = delta * qPrime;
+      density += delta;
+      firstDerivative += deltaPrime;
+      secondDerivative += 2. * entry.c2 * delta + qPrime * deltaPrime;
+    }
+  }
+  return {density, firstDerivative, secondDerivative};
+}
+
+// The maximum search with the full density at every trial point
+std::pair<double, double> fullMaximum(
+    const std::vector<TrackDensity::TrackEntry>& entries) {
+  double maxPosition = 0.;
+  double maxDensity = 0.;
+  double maxSecondDerivative = 0.;
+  for (const auto& entry : entries) {
+    double trialZ = entry.z;
+    for (int iStep = 0; iStep < 3; ++iStep) {
+      auto [density, firstDerivative, secondDerivative] =
+          fullDensity(entries, trialZ);
+      if (secondDerivative >= 0. || density <= 0.) {
+        break;
+      }
+      if (density > maxDensity) {
+        maxPosition = trialZ;
+        maxDensity = density;
+        maxSecondDerivative = secondDerivative;
+      }
+      trialZ +=
+          (density * firstDerivative) /
+          (firstDerivative * firstDerivative - density * secondDerivative);
+    }
+  }
+  return {maxPosition, std::sqrt(-(maxDensity / maxSecondDerivative))};
+}
+
+BOOST_DATA_TEST_CASE(gaussian_track_density_full_sum_test,
+                     bdata::make({1u, 10u, 100u, 1000u}), nTracks) {
+  const auto tracks = randomTracks(nTracks, nTracks);
+  std::vector<const BoundParameters*> trackPtrs;
+  for (const auto& track : tracks) {
+    trackPtrs.push_back(&track);
+  }
+  std::function<BoundParameters(BoundParameters)> extractParameters =
+      [](BoundParameters params) { return params; };
+
+  TrackDensity density;
+  TrackDensity::State state(nTracks);
+  const auto [z, width] =
+      density.globalMaximumWithWidth(state, trackPtrs, extractParameters);
+  BOOST_CHECK_GT(state.trackEntries.size(), 0u);
+  BOOST_CHECK_EQUAL(state.lowerBounds.size(), state.trackEntries.size());
+
+  const auto [fullZ, fullWidth] = fullMaximum(state.trackEntries);
+  CHECK_CLOSE_ABS(z, fullZ, 1_nm);
+  CHECK_CLOSE_REL(width, fullWidth, 1e-9);
+}
+
+}  // namespace Test
+}  // namespace Acts
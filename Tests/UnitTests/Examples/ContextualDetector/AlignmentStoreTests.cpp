@@ -0,0 +1,230 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/ContextualDetector/AlignedDetectorElement.hpp"
+#include "ACTFW/ContextualDetector/AlignmentDecorator.hpp"
+#include "ACTFW/ContextualDetector/AlignmentStore.hpp"
+#include "ACTFW/Framework/AlgorithmContext.hpp"
+#include "ACTFW/Framework/RandomNumbers.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace FW::Contextual;
+
+namespace {
+
+constexpr size_t kNumElements = 16;
+
+/// Transforms that encode the IOV and the alignment index
+AlignmentStore::IovTransforms makeIov(unsigned int iov) {
+  AlignmentStore::IovTransforms iovTransforms;
+  iovTransforms.iov = iov;
+  for (size_t i = 0; i < kNumElements; ++i) {
+    iovTransforms.transforms.emplace_back(Acts::Translation3D(iov, i, 0.));
+  }
+  return iovTransforms;
+}
+
+/// Check that all transforms belong to the IOV they are published for
+bool isConsistent(const AlignmentStore::IovTransforms& iovTransforms) {
+  if (iovTransforms.transforms.size() != kNumElements) {
+    return false;
+  }
+  for (size_t i = 0; i < kNumElements; ++i) {
+    const Acts::Vector3D translation =
+        iovTransforms.transforms[i].translation();
+    if (translation != Acts::Vector3D(iovTransforms.iov, i, 0.)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesAlignmentStore)
+
+BOOST_AUTO_TEST_CASE(RetiredIovsAreDeletedAfterTheLastReference) {
+  AlignmentStore store(2);
+  auto iov0 = store.publish(makeIov(0));
+  auto iov1 = store.publish(makeIov(1));
+  BOOST_CHECK_EQUAL(store.numRetired(), 0u);
+
+  // all slots are in use, the IOV in the home slot is replaced
+  auto iov2 = store.publish(makeIov(2));
+  BOOST_CHECK_EQUAL(store.numRetired(), 1u);
+  BOOST_CHECK_EQUAL(store.find(0), nullptr);
+  BOOST_CHECK_EQUAL(store.find(1), iov1);
+  BOOST_CHECK_EQUAL(store.find(2), iov2);
+  // the replaced IOV stays valid as long as it is referenced
+  BOOST_CHECK_EQUAL(iov0->iov, 0u);
+  BOOST_CHECK(isConsistent(*iov0));
+
+  // releasing the last reference defers the deletion to the next publish
+  iov0.reset();
+  BOOST_CHECK_EQUAL(store.numRetired(), 1u);
+  auto iov3 = store.publish(makeIov(3));
+  // the unreferenced IOV 0 is deleted, the still referenced IOV 1 retired
+  BOOST_CHECK_EQUAL(store.numRetired(), 1u);
+  BOOST_CHECK_EQUAL(store.find(1), nullptr);
+  BOOST_CHECK(isConsistent(*iov1));
+
+  // unused IOVs are replaced before used ones
+  iov1.reset();
+  iov2.reset();
+  auto iov4 = store.publish(makeIov(4));
+  BOOST_CHECK_EQUAL(store.numRetired(), 0u);
+  BOOST_CHECK_EQUAL(store.find(2), nullptr);
+  BOOST_CHECK_EQUAL(store.find(3), iov3);
+  BOOST_CHECK_EQUAL(store.find(4), iov4);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentLookupsWhilePublishing) {
+  constexpr unsigned int kNumIovs = 2000;
+  constexpr size_t kNumReaders = 4;
+  constexpr size_t kNumHeld = 8;
+
+  AlignmentStore store(4);
+  store.publish(makeIov(0));
+  std::atomic<unsigned int> latest{0};
+  std::atomic<bool> done{false};
+  // number of readers that found an IOV at least once
+  std::atomic<size_t> numActive{0};
+
+  std::vector<size_t> numFound(kNumReaders, 0);
+  std::vector<size_t> numInconsistent(kNumReaders, 0);
+  std::vector<std::thread> readers;
+  for (size_t ireader = 0; ireader < kNumReaders; ++ireader) {
+    readers.emplace_back([&, ireader] {
+      // references kept across several publishes before they are dropped
+      std::vector<std::shared_ptr<const AlignmentStore::IovTransforms>> held(
+          kNumHeld);
+      size_t next = 0;
+      while (not done.load()) {
+        const unsigned int current = latest.load();
+        // the current IOV and some that might just be retired
+        const unsigned int iov =
+            current - std::min<unsigned int>(current, ireader);
+        auto found = store.find(iov);
+        if (found == nullptr) {
+          continue;
+        }
+        if (numFound[ireader]++ == 0) {
+          numActive.fetch_add(1);
+        }
+        if (found->iov != iov or not isConsistent(*found)) {
+          ++numInconsistent[ireader];
+        }
+        // a dropped reference must still be intact up to its release
+        auto& slot = held[next++ % kNumHeld];
+        if (slot != nullptr and not isConsistent(*slot)) {
+          ++numInconsistent[ireader];
+        }
+        slot = std::move(found);
+      }
+    });
+  }
+  // keep publishing until every reader had the chance to run
+  unsigned int numIovs = 1;
+  for (; numIovs < kNumIovs or numActive.load() < kNumReaders; ++numIovs) {
+    store.publish(makeIov(numIovs));
+    latest.store(numIovs);
+  }
+  done.store(true);
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  for (size_t ireader = 0; ireader < kNumReaders; ++ireader) {
+    BOOST_CHECK_GT(numFound[ireader], 0u);
+    BOOST_CHECK_EQUAL(numInconsistent[ireader], 0u);
+  }
+  // all references are dropped, the next publish deletes every retired IOV
+  store.publish(makeIov(numIovs));
+  BOOST_CHECK_EQUAL(store.numRetired(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentDecoration) {
+  constexpr unsigned int kIovSize = 3;
+  constexpr size_t kNumEvents = 300;
+  constexpr size_t kNumThreads = 4;
+
+  // one layer of aligned detector elements
+  auto bounds = std::make_shared<const Acts::RectangleBounds>(10., 20.);
+  AlignmentDecorator::Config cfg;
+  cfg.detectorStore.emplace_back();
+  for (size_t i = 0; i < kNumElements; ++i) {
+    auto transform = std::make_shared<const Acts::Transform3D>(
+        Acts::Translation3D(0., 0., 10. * i));
+    cfg.detectorStore.back().push_back(
+        std::make_shared<AlignedDetectorElement>(i, transform, bounds, 1.));
+  }
+  cfg.iovSize = kIovSize;
+  // fewer slots than IOVs in flight to exercise the replacement
+  cfg.flushSize = 2;
+  cfg.randomNumberSvc =
+      std::make_shared<FW::RandomNumbers>(FW::RandomNumbers::Config());
+  cfg.gSigmaX = 0.1;
+  cfg.aSigmaZ = 0.01;
+  AlignmentDecorator decorator(cfg);
+
+  // the element transforms seen by each event
+  std::vector<std::vector<Acts::Transform3D>> seen(kNumEvents);
+  std::vector<size_t> numWrongIov(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  for (size_t ithread = 0; ithread < kNumThreads; ++ithread) {
+    threads.emplace_back([&, ithread] {
+      for (size_t ievent = ithread; ievent < kNumEvents;
+           ievent += kNumThreads) {
+        FW::WhiteBoard eventStore;
+        FW::AlgorithmContext context(0, ievent, eventStore);
+        decorator.decorate(context);
+        const auto* alignContext =
+            context.geoContext.get<AlignedDetectorElement::ContextType>();
+        if (alignContext == nullptr or alignContext->alignment == nullptr or
+            alignContext->alignment->iov != ievent / kIovSize) {
+          ++numWrongIov[ithread];
+          continue;
+        }
+        for (const auto& element : cfg.detectorStore.back()) {
+          seen[ievent].push_back(element->transform(context.geoContext));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t ithread = 0; ithread < kNumThreads; ++ithread) {
+    BOOST_CHECK_EQUAL(numWrongIov[ithread], 0u);
+  }
+  // all events of an IOV see the same transforms, even if the IOV was
+  // replaced and emulated again in between
+  for (size_t ievent = 0; ievent < kNumEvents; ++ievent) {
+    const size_t first = (ievent / kIovSize) * kIovSize;
+    BOOST_REQUIRE_EQUAL(seen[ievent].size(), kNumElements);
+    for (size_t i = 0; i < kNumElements; ++i) {
+      BOOST_CHECK(seen[ievent][i].matrix() == seen[first][i].matrix());
+    }
+  }
+  // the transforms are aligned, i.e. differ from the nominal ones
+  const auto& nominal = cfg.detectorStore.back().front()->nominalTransform(
+      Acts::GeometryContext());
+  BOOST_CHECK(not seen[0][0].isApprox(nominal));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/Framework/AllocationMeter.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace FW;
+
+namespace {
+// Allocate and free a block that the compiler can not elide.
+void allocateTemporary(size_t size) {
+  std::vector<char> block(size, 1);
+  volatile char sink = block.back();
+  (void)sink;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesAllocationMeter)
+
+BOOST_AUTO_TEST_CASE(NestedMeters) {
+  AllocationMeter outer;
+  std::vector<char> kept(1000, 1);
+  AllocationCount inner;
+  {
+    AllocationMeter meter;
+    allocateTemporary(4000);
+    inner = meter.count();
+  }
+  AllocationCount total = outer.count();
+
+  if (not isAllocationCountingEnabled()) {
+    BOOST_CHECK_EQUAL(inner.allocations, 0u);
+    BOOST_CHECK_EQUAL(inner.allocatedBytes, 0u);
+    BOOST_CHECK_EQUAL(total.netBytes, 0);
+    BOOST_CHECK_EQUAL(total.peakBytes, 0);
+    return;
+  }
+  // the temporary block is freed within the inner meter
+  BOOST_CHECK_EQUAL(inner.allocations, 1u);
+  BOOST_CHECK_GE(inner.allocatedBytes, 4000u);
+  BOOST_CHECK_EQUAL(inner.netBytes, 0);
+  BOOST_CHECK_GE(inner.peakBytes, 4000);
+  // the outer meter includes the inner one and the kept block
+  BOOST_CHECK_EQUAL(total.allocations, 2u);
+  BOOST_CHECK_GE(total.netBytes, 1000);
+  BOOST_CHECK_LT(total.netBytes, 4000);
+  BOOST_CHECK_GE(total.peakBytes, 5000);
+}
+
+BOOST_AUTO_TEST_CASE(OtherThreads) {
+  AllocationMeter meter;
+  std::thread thread([] { allocateTemporary(4000); });
+  AllocationCount count = meter.count();
+  thread.join();
+
+  // only the thread object itself is allocated on this thread
+  BOOST_CHECK_LT(count.allocatedBytes, 4000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
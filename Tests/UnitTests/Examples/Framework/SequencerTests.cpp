@@ -0,0 +1,518 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/Framework/BareAlgorithm.hpp"
+#include "ACTFW/Framework/IReader.hpp"
+#include "ACTFW/Framework/IWriter.hpp"
+#include "ACTFW/Framework/Sequencer.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Framework/WriterT.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace FW;
+
+namespace {
+
+/// Start and end of every execution on one sequence shared by all threads.
+class Recorder {
+ public:
+  size_t start() { return m_clock++; }
+  void finish(const std::string& name, size_t event, size_t start) {
+    size_t end = m_clock++;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_spans[{name, event}] = {start, end};
+  }
+
+  size_t start(const std::string& name, size_t event) const {
+    return m_spans.at({name, event}).first;
+  }
+  size_t end(const std::string& name, size_t event) const {
+    return m_spans.at({name, event}).second;
+  }
+  size_t numExecutions() const { return m_spans.size(); }
+
+ private:
+  std::atomic<size_t> m_clock{0};
+  std::mutex m_mutex;
+  std::map<std::pair<std::string, size_t>, std::pair<size_t, size_t>> m_spans;
+};
+
+/// Reads the event number from its inputs and writes it to its outputs.
+class MockAlgorithm final : public BareAlgorithm {
+ public:
+  MockAlgorithm(const std::string& name, std::vector<std::string> inputs,
+                std::vector<std::string> outputs, Recorder& recorder,
+                std::function<void()> work = {})
+      : BareAlgorithm(name, Acts::Logging::WARNING),
+        m_outputs(std::move(outputs)),
+        m_recorder(recorder),
+        m_work(std::move(work)) {
+    for (const auto& input : inputs) {
+      declareInput(input);
+    }
+    for (const auto& output : m_outputs) {
+      declareOutput(output);
+    }
+  }
+
+  ProcessCode execute(const AlgorithmContext& context) const final override {
+    size_t start = m_recorder.start();
+    for (const auto& input : inputs()) {
+      if (context.eventStore.get<size_t>(input) != context.eventNumber) {
+        return ProcessCode::ABORT;
+      }
+    }
+    if (m_work) {
+      m_work();
+    }
+    for (const auto& output : m_outputs) {
+      context.eventStore.add(output, size_t(context.eventNumber));
+    }
+    m_recorder.finish(name(), context.eventNumber, start);
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::string> m_outputs;
+  Recorder& m_recorder;
+  std::function<void()> m_work;
+};
+
+/// Writes the event number with the given type via a handle.
+template <typename T>
+class TypedProducer final : public BareAlgorithm {
+ public:
+  TypedProducer(const std::string& name, const std::string& output,
+                Recorder& recorder)
+      : BareAlgorithm(name, Acts::Logging::WARNING), m_recorder(recorder) {
+    declareOutput(m_output, output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& context) const final override {
+    size_t start = m_recorder.start();
+    m_output(context, T(context.eventNumber));
+    m_recorder.finish(name(), context.eventNumber, start);
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  WriteHandle<T> m_output;
+  Recorder& m_recorder;
+};
+
+/// Reads the event number with the given type via a handle.
+template <typename T>
+class TypedConsumer final : public BareAlgorithm {
+ public:
+  TypedConsumer(const std::string& name, const std::string& input,
+                Recorder& recorder)
+      : BareAlgorithm(name, Acts::Logging::WARNING), m_recorder(recorder) {
+    declareInput(m_input, input);
+  }
+
+  ProcessCode execute(const AlgorithmContext& context) const final override {
+    size_t start = m_recorder.start();
+    if (m_input(context) != T(context.eventNumber)) {
+      return ProcessCode::ABORT;
+    }
+    m_recorder.finish(name(), context.eventNumber, start);
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  ReadHandle<T> m_input;
+  Recorder& m_recorder;
+};
+
+/// Reads the event number as an int and, via a handle, with the given type.
+template <typename T>
+class TypedWriter final : public WriterT<int> {
+ public:
+  TypedWriter(const std::string& name, const std::string& object,
+              const std::string& input, Recorder& recorder)
+      : WriterT<int>(object, name, Acts::Logging::WARNING),
+        m_recorder(recorder) {
+    declareInput(m_input, input);
+  }
+
+ private:
+  ProcessCode writeT(const AlgorithmContext& context,
+                     const int& object) final override {
+    size_t start = m_recorder.start();
+    if (object != int(context.eventNumber) or
+        m_input(context) != T(context.eventNumber)) {
+      return ProcessCode::ABORT;
+    }
+    m_recorder.finish(name(), context.eventNumber, start);
+    return ProcessCode::SUCCESS;
+  }
+
+  ReadHandle<T> m_input;
+  Recorder& m_recorder;
+};
+
+/// Writes the event number to its outputs.
+class MockReader final : public IReader {
+ public:
+  MockReader(std::vector<std::string> outputs,
+             std::function<void(size_t)> onRead = {})
+      : m_outputs(std::move(outputs)), m_onRead(std::move(onRead)) {}
+
+  std::string name() const final override { return "MockReader"; }
+  std::pair<size_t, size_t> availableEvents() const final override {
+    return {0u, SIZE_MAX};
+  }
+  ProcessCode read(const AlgorithmContext& context) final override {
+    if (m_onRead) {
+      m_onRead(context.eventNumber);
+    }
+    for (const auto& output : m_outputs) {
+      context.eventStore.add(output, size_t(context.eventNumber));
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::string> m_outputs;
+  std::function<void(size_t)> m_onRead;
+};
+
+/// Checks that its inputs are available.
+class MockWriter final : public IWriter {
+ public:
+  MockWriter(const std::string& name, std::vector<std::string> inputs,
+             Recorder& recorder, std::function<void(size_t)> onWrite = {})
+      : m_name(name),
+        m_inputs(std::move(inputs)),
+        m_recorder(recorder),
+        m_onWrite(std::move(onWrite)) {}
+
+  std::string name() const final override { return m_name; }
+  std::vector<std::string> inputs() const final override { return m_inputs; }
+  ProcessCode write(const AlgorithmContext& context) final override {
+    size_t start = m_recorder.start();
+    for (const auto& input : m_inputs) {
+      if (context.eventStore.get<size_t>(input) != context.eventNumber) {
+        return ProcessCode::ABORT;
+      }
+    }
+    if (m_onWrite) {
+      m_onWrite(context.eventNumber);
+    }
+    m_recorder.finish(m_name, context.eventNumber, start);
+    return ProcessCode::SUCCESS;
+  }
+  ProcessCode endRun() final override { return ProcessCode::SUCCESS; }
+
+ private:
+  std::string m_name;
+  std::vector<std::string> m_inputs;
+  Recorder& m_recorder;
+  std::function<void(size_t)> m_onWrite;
+};
+
+/// Current and maximum number of concurrent users.
+class ConcurrencyCounter {
+ public:
+  void enter() {
+    size_t current = ++m_current;
+    size_t max = m_max.load();
+    while (max < current and not m_max.compare_exchange_weak(max, current)) {
+    }
+  }
+  void leave() { --m_current; }
+  size_t max() const { return m_max.load(); }
+
+ private:
+  std::atomic<size_t> m_current{0};
+  std::atomic<size_t> m_max{0};
+};
+
+/// Blocks until the given number of threads arrived, or a timeout passed.
+class Rendezvous {
+ public:
+  Rendezvous(size_t numThreads) : m_numThreads(numThreads) {}
+
+  void arrive() {
+    m_arrived.fetch_add(1);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (m_arrived.load() < m_numThreads and
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+  }
+  bool complete() const { return m_numThreads <= m_arrived.load(); }
+
+ private:
+  size_t m_numThreads;
+  std::atomic<size_t> m_arrived{0};
+};
+
+Sequencer::Config makeConfig(size_t events, int numThreads) {
+  Sequencer::Config cfg;
+  cfg.events = events;
+  cfg.numThreads = numThreads;
+  cfg.logLevel = Acts::Logging::WARNING;
+  cfg.outputDir = ensureWritableDirectory("SequencerTests");
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesSequencer)
+
+BOOST_AUTO_TEST_CASE(AlgorithmsRunAfterTheirProducers) {
+  Recorder recorder;
+  Sequencer sequencer(makeConfig(4, 2));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Hits", std::vector<std::string>{},
+      std::vector<std::string>{"order_hits"}, recorder));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Seeds", std::vector<std::string>{"order_hits"},
+      std::vector<std::string>{"order_seeds"}, recorder));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Tracks", std::vector<std::string>{"order_hits", "order_seeds"},
+      std::vector<std::string>{"order_tracks"}, recorder));
+  BOOST_REQUIRE_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(recorder.numExecutions(), 12u);
+  for (size_t event = 0; event < 4; ++event) {
+    BOOST_CHECK_LT(recorder.end("Hits", event), recorder.start("Seeds", event));
+    BOOST_CHECK_LT(recorder.end("Seeds", event),
+                   recorder.start("Tracks", event));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentAlgorithmsRunConcurrently) {
+  Recorder recorder;
+  // both algorithms only finish if the other one runs at the same time
+  Rendezvous rendezvous(2);
+  auto work = [&] { rendezvous.arrive(); };
+  Sequencer sequencer(makeConfig(1, 2));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Particles", std::vector<std::string>{},
+      std::vector<std::string>{"concurrent_particles"}, recorder));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Left", std::vector<std::string>{"concurrent_particles"},
+      std::vector<std::string>{"concurrent_left"}, recorder, work));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Right", std::vector<std::string>{"concurrent_particles"},
+      std::vector<std::string>{"concurrent_right"}, recorder, work));
+  BOOST_REQUIRE_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK(rendezvous.complete());
+  BOOST_CHECK_LT(recorder.start("Left", 0), recorder.end("Right", 0));
+  BOOST_CHECK_LT(recorder.start("Right", 0), recorder.end("Left", 0));
+}
+
+BOOST_AUTO_TEST_CASE(WritersRunAfterTheirProducers) {
+  Recorder recorder;
+  auto slow = [] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); };
+  Sequencer sequencer(makeConfig(3, 2));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Simulation", std::vector<std::string>{},
+      std::vector<std::string>{"writers_hits"}, recorder));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Reconstruction", std::vector<std::string>{"writers_hits"},
+      std::vector<std::string>{"writers_tracks"}, recorder, slow));
+  sequencer.addWriter(std::make_shared<MockWriter>(
+      "HitWriter", std::vector<std::string>{"writers_hits"}, recorder));
+  sequencer.addWriter(std::make_shared<MockWriter>(
+      "TrackWriter", std::vector<std::string>{"writers_tracks"}, recorder));
+  sequencer.addWriter(std::make_shared<MockWriter>(
+      "SummaryWriter", std::vector<std::string>{}, recorder));
+  BOOST_REQUIRE_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(recorder.numExecutions(), 15u);
+  for (size_t event = 0; event < 3; ++event) {
+    BOOST_CHECK_LT(recorder.end("Simulation", event),
+                   recorder.start("HitWriter", event));
+    BOOST_CHECK_LT(recorder.end("Reconstruction", event),
+                   recorder.start("TrackWriter", event));
+    // writers without declared inputs run after all algorithms
+    BOOST_CHECK_LT(recorder.end("Reconstruction", event),
+                   recorder.start("SummaryWriter", event));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MissingProducerIsAnError) {
+  // nothing writes the input
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+        "Fitter", std::vector<std::string>{"missing_tracks"},
+        std::vector<std::string>{"missing_fitted"}, recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 0u);
+  }
+  // only a following algorithm writes the input
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+        "Fitter", std::vector<std::string>{"late_tracks"},
+        std::vector<std::string>{"late_fitted"}, recorder));
+    sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+        "Finder", std::vector<std::string>{},
+        std::vector<std::string>{"late_tracks"}, recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 0u);
+  }
+  // nothing writes the writer input
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addWriter(std::make_shared<MockWriter>(
+        "Writer", std::vector<std::string>{"missing_output"}, recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 0u);
+  }
+  // readers do not declare their outputs and might write the input
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addReader(
+        std::make_shared<MockReader>(std::vector<std::string>{"read_tracks"}));
+    sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+        "Fitter", std::vector<std::string>{"read_tracks"},
+        std::vector<std::string>{"read_fitted"}, recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 2u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HandlesAreResolvedPerSequencer) {
+  // consecutive sequencers can use the same object name with other types
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<int>>(
+        "IntProducer", "typed_value", recorder));
+    sequencer.addAlgorithm(std::make_shared<TypedConsumer<int>>(
+        "IntConsumer", "typed_value", recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 4u);
+  }
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<double>>(
+        "DoubleProducer", "typed_value", recorder));
+    sequencer.addAlgorithm(std::make_shared<TypedConsumer<double>>(
+        "DoubleConsumer", "typed_value", recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 4u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HandleTypeMismatchIsAnError) {
+  // the types are checked before any event is processed
+  Recorder recorder;
+  Sequencer sequencer(makeConfig(2, 1));
+  sequencer.addAlgorithm(std::make_shared<TypedProducer<int>>(
+      "IntProducer", "mismatched_value", recorder));
+  sequencer.addAlgorithm(std::make_shared<TypedConsumer<double>>(
+      "DoubleConsumer", "mismatched_value", recorder));
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+  BOOST_CHECK_EQUAL(recorder.numExecutions(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(WriterHandles) {
+  // the additional writer inputs are read via their handles
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<int>>(
+        "IntProducer", "writer_object", recorder));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<double>>(
+        "DoubleProducer", "writer_input", recorder));
+    sequencer.addWriter(std::make_shared<TypedWriter<double>>(
+        "Writer", "writer_object", "writer_input", recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 6u);
+  }
+  // and their types are checked before any event is processed
+  {
+    Recorder recorder;
+    Sequencer sequencer(makeConfig(2, 1));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<int>>(
+        "IntProducer", "mismatched_object", recorder));
+    sequencer.addAlgorithm(std::make_shared<TypedProducer<double>>(
+        "DoubleProducer", "mismatched_input", recorder));
+    sequencer.addWriter(std::make_shared<TypedWriter<int>>(
+        "Writer", "mismatched_object", "mismatched_input", recorder));
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_FAILURE);
+    BOOST_CHECK_EQUAL(recorder.numExecutions(), 0u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedEventsInFlight) {
+  constexpr size_t kEvents = 16;
+  constexpr size_t kEventsInFlight = 2;
+
+  Recorder recorder;
+  // events between being read and being written
+  ConcurrencyCounter events;
+  // concurrent executions of the only algorithm, i.e. of different events
+  ConcurrencyCounter executions;
+  std::vector<size_t> written;
+  auto work = [&] {
+    executions.enter();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    executions.leave();
+  };
+
+  Sequencer::Config cfg = makeConfig(kEvents, 4);
+  cfg.eventsInFlight = kEventsInFlight;
+  Sequencer sequencer(cfg);
+  sequencer.addReader(std::make_shared<MockReader>(
+      std::vector<std::string>{"pipelined_hits"},
+      [&](size_t /*event*/) { events.enter(); }));
+  sequencer.addAlgorithm(std::make_shared<MockAlgorithm>(
+      "Tracks", std::vector<std::string>{"pipelined_hits"},
+      std::vector<std::string>{"pipelined_tracks"}, recorder, work));
+  sequencer.addWriter(std::make_shared<MockWriter>(
+      "TrackWriter", std::vector<std::string>{"pipelined_tracks"}, recorder,
+      [&](size_t event) { written.push_back(event); }));
+  // the last writer ends the event
+  sequencer.addWriter(std::make_shared<MockWriter>(
+      "HitWriter", std::vector<std::string>{"pipelined_hits"}, recorder,
+      [&](size_t /*event*/) { events.leave(); }));
+  BOOST_REQUIRE_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_LE(events.max(), kEventsInFlight);
+  BOOST_CHECK_LE(executions.max(), kEventsInFlight);
+  // the writers see all events in order, one event after the other
+  BOOST_REQUIRE_EQUAL(written.size(), kEvents);
+  for (size_t event = 0; event < kEvents; ++event) {
+    BOOST_CHECK_EQUAL(written[event], event);
+    BOOST_CHECK_LT(recorder.end("Tracks", event),
+                   recorder.start("TrackWriter", event));
+    if (0 < event) {
+      BOOST_CHECK_LT(recorder.end("HitWriter", event - 1),
+                     recorder.start("TrackWriter", event));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/ProtoTrack.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
+#include "ACTFW/EventData/SimSourceLink.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace FW;
+
+BOOST_AUTO_TEST_SUITE(ExamplesWhiteBoard)
+
+BOOST_AUTO_TEST_CASE(RegistrySlots) {
+  WhiteBoardRegistry registry;
+  size_t first = registry.slot("first");
+  size_t second = registry.slot("second");
+  BOOST_CHECK_NE(first, second);
+  BOOST_CHECK_EQUAL(registry.slot("first"), first);
+  BOOST_CHECK_EQUAL(registry.slot("second"), second);
+  BOOST_CHECK_THROW(registry.slot(""), std::invalid_argument);
+  BOOST_CHECK_EQUAL(registry.find("first"), first);
+  BOOST_CHECK_EQUAL(registry.find("unknown"), SIZE_MAX);
+  BOOST_CHECK_EQUAL(registry.find(""), SIZE_MAX);
+  BOOST_CHECK_EQUAL(registry.size(), 2u);
+
+  // handles are unresolved until they are resolved with a registry
+  ReadHandle<int> read("first");
+  WriteHandle<int> write("first");
+  BOOST_CHECK_EQUAL(read.name(), "first");
+  BOOST_CHECK_EQUAL(read.slot(), SIZE_MAX);
+  read.resolve(registry);
+  write.resolve(registry);
+  BOOST_CHECK_EQUAL(read.slot(), first);
+  BOOST_CHECK_EQUAL(write.slot(), first);
+  // names without a type match any registered type
+  BOOST_CHECK_EQUAL(registry.slot("first"), first);
+  BOOST_CHECK_THROW(ReadHandle<int>(""), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(RegistryTypeMismatch) {
+  WhiteBoardRegistry registry;
+  ReadHandle<int> read("mismatch");
+  read.resolve(registry);
+  WriteHandle<double> writeDouble("mismatch");
+  BOOST_CHECK_THROW(writeDouble.resolve(registry), std::invalid_argument);
+  BOOST_CHECK_THROW(registry.slot("mismatch", &typeid(double)),
+                    std::invalid_argument);
+  // the first registered type is kept
+  WriteHandle<int> writeInt("mismatch");
+  writeInt.resolve(registry);
+  BOOST_CHECK_EQUAL(writeInt.slot(), read.slot());
+
+  // other registries, e.g. of other sequencers, are independent
+  WhiteBoardRegistry other;
+  writeDouble.resolve(other);
+  BOOST_CHECK(other.type(writeDouble.slot()) == &typeid(double));
+  BOOST_CHECK(registry.type(read.slot()) == &typeid(int));
+}
+
+BOOST_AUTO_TEST_CASE(MixedAccess) {
+  WhiteBoardRegistry registry;
+  WriteHandle<int> writeHandle("mixed_handle");
+  ReadHandle<int> readHandle("mixed_handle");
+  ReadHandle<std::string> readName("mixed_name");
+  writeHandle.resolve(registry);
+  readHandle.resolve(registry);
+  readName.resolve(registry);
+  WhiteBoard store(registry);
+
+  // add via the handle and read via the name and vice versa
+  store.add(writeHandle, 42);
+  store.add("mixed_name", std::string("value"));
+  BOOST_CHECK_EQUAL(store.get<int>("mixed_handle"), 42);
+  BOOST_CHECK_EQUAL(store.get(readHandle), 42);
+  BOOST_CHECK_EQUAL(store.get(readName), "value");
+  BOOST_CHECK_EQUAL(store.get<std::string>("mixed_name"), "value");
+
+  // duplicates are rejected regardless of the access
+  BOOST_CHECK_THROW(store.add("mixed_handle", 1), std::invalid_argument);
+  BOOST_CHECK_THROW(store.add(writeHandle, 1), std::invalid_argument);
+  BOOST_CHECK_THROW(store.add("", 1), std::invalid_argument);
+  BOOST_CHECK_THROW(store.add(WriteHandle<int>(), 1), std::invalid_argument);
+
+  // missing objects and wrong types
+  BOOST_CHECK_THROW(store.get<int>("mixed_missing"), std::out_of_range);
+  // reading unknown names does not register them
+  BOOST_CHECK_EQUAL(registry.find("mixed_missing"), SIZE_MAX);
+  BOOST_CHECK_THROW(store.get(ReadHandle<int>()), std::out_of_range);
+  BOOST_CHECK_THROW(store.get<double>("mixed_handle"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(UnresolvedHandles) {
+  // a board used on its own looks up the slots of unresolved handles
+  WhiteBoard store;
+  WriteHandle<int> write("unresolved");
+  ReadHandle<int> read("unresolved");
+  BOOST_CHECK_THROW(store.get(read), std::out_of_range);
+  store.add(write, 7);
+  BOOST_CHECK_EQUAL(store.get(read), 7);
+  BOOST_CHECK_EQUAL(store.get<int>("unresolved"), 7);
+  BOOST_CHECK_THROW(store.get(ReadHandle<double>("unresolved")),
+                    std::out_of_range);
+  BOOST_CHECK_THROW(store.add(WriteHandle<double>("unresolved"), 1.),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(AddTypeMismatch) {
+  WhiteBoardRegistry registry;
+  WriteHandle<int> handle("add_handle");
+  handle.resolve(registry);
+  WhiteBoard store(registry);
+  // objects must have the type registered by the handles
+  BOOST_CHECK_THROW(store.add("add_handle", 1.5), std::invalid_argument);
+  store.add("add_handle", 1);
+  BOOST_CHECK_EQUAL(store.get<int>("add_handle"), 1);
+
+  // objects added by name register their type
+  store.add("add_name", 2.5);
+  BOOST_CHECK(registry.type(registry.find("add_name")) == &typeid(double));
+  ReadHandle<int> readInt("add_name");
+  BOOST_CHECK_THROW(readInt.resolve(registry), std::invalid_argument);
+  WhiteBoard other(registry);
+  BOOST_CHECK_THROW(other.add("add_name", 2), std::invalid_argument);
+  BOOST_CHECK_THROW(store.get<int>("add_name"), std::out_of_range);
+  ReadHandle<double> readDouble("add_name");
+  readDouble.resolve(registry);
+  BOOST_CHECK_EQUAL(store.get(readDouble), 2.5);
+}
+
+BOOST_AUTO_TEST_CASE(NamesRegisteredDuringTheEvent) {
+  // the slots are sized for the names known when the board is created
+  WhiteBoardRegistry registry;
+  registry.slot("early_name");
+  WhiteBoard store(registry);
+  WriteHandle<int> handle("late_handle");
+  handle.resolve(registry);
+  BOOST_CHECK_EQUAL(handle.slot(), 1u);
+  store.add(handle, 3);
+  store.add("late_name", 4);
+  store.add("early_name", 5);
+  ReadHandle<int> read("late_handle");
+  read.resolve(registry);
+  BOOST_CHECK_EQUAL(store.get(read), 3);
+  BOOST_CHECK_EQUAL(store.get<int>("late_name"), 4);
+  BOOST_CHECK_EQUAL(store.get<int>("early_name"), 5);
+  BOOST_CHECK_THROW(store.add(handle, 5), std::invalid_argument);
+  BOOST_CHECK_THROW(store.get<int>("late_missing"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(SeparateEvents) {
+  WhiteBoardRegistry registry;
+  WriteHandle<int> handle("events");
+  handle.resolve(registry);
+  WhiteBoard first(registry);
+  WhiteBoard second(registry);
+  first.add(handle, 1);
+  BOOST_CHECK_THROW(second.get<int>("events"), std::out_of_range);
+  second.add(handle, 2);
+  BOOST_CHECK_EQUAL(first.get<int>("events"), 1);
+  BOOST_CHECK_EQUAL(second.get<int>("events"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  WhiteBoard store;
+  pmr::ProtoTrackContainer tracks(store.memoryResource());
+  tracks.emplace_back(3u, 7u);
+  BOOST_CHECK(tracks.get_allocator().resource() == store.memoryResource());
+  BOOST_CHECK(tracks[0].get_allocator().resource() == store.memoryResource());
+
+  store.add("resource_tracks", std::move(tracks));
+  const auto& stored = store.get<pmr::ProtoTrackContainer>("resource_tracks");
+  BOOST_REQUIRE_EQUAL(stored.size(), 1u);
+  BOOST_CHECK_EQUAL(stored[0].size(), 3u);
+  BOOST_CHECK_EQUAL(stored[0][2], 7u);
+}
+
+BOOST_AUTO_TEST_CASE(EventDataInTheArena) {
+  WhiteBoard store;
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3D(0., 0., 0.), Acts::Vector3D(0., 0., 1.));
+  const auto geoId =
+      Acts::GeometryID().setVolume(1).setLayer(2).setSensitive(3);
+
+  // hits are built as unordered sequence first, like in the simulation
+  pmr::SimHitContainer::sequence_type hitsUnordered(store.memoryResource());
+  hitsUnordered.emplace_back(geoId, ActsFatras::Barcode(),
+                             ActsFatras::Hit::Vector4::Zero(),
+                             ActsFatras::Hit::Vector4::Zero(),
+                             ActsFatras::Hit::Vector4::Zero());
+  pmr::SimHitContainer hits(store.memoryResource());
+  hits.adopt_sequence(std::move(hitsUnordered));
+  BOOST_CHECK(hits.get_allocator().resource() == store.memoryResource());
+
+  pmr::SimSourceLinkContainer sourceLinks(store.memoryResource());
+  sourceLinks.emplace_hint(sourceLinks.end(), *surface, *hits.begin(), 2,
+                           Acts::BoundVector::Zero(),
+                           Acts::BoundMatrix::Zero());
+  BOOST_CHECK(sourceLinks.get_allocator().resource() ==
+              store.memoryResource());
+
+  pmr::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters(
+      store.memoryResource());
+  clusters.emplace_hint(
+      clusters.end(), geoId,
+      Acts::PlanarModuleCluster(surface, Identifier(0u),
+                                Acts::ActsSymMatrixD<3>::Zero(), 0., 0., 0.,
+                                {Acts::DigitizationCell(1u, 2u)}));
+  BOOST_CHECK(clusters.get_allocator().resource() == store.memoryResource());
+
+  // the containers keep the resource when moved into the store
+  store.add("arena_hits", std::move(hits));
+  store.add("arena_source_links", std::move(sourceLinks));
+  store.add("arena_clusters", std::move(clusters));
+  const auto& storedHits = store.get<pmr::SimHitContainer>("arena_hits");
+  const auto& storedSourceLinks =
+      store.get<pmr::SimSourceLinkContainer>("arena_source_links");
+  const auto& storedClusters =
+      store.get<pmr::GeometryIdMultimap<Acts::PlanarModuleCluster>>(
+          "arena_clusters");
+  BOOST_CHECK(storedHits.get_allocator().resource() == store.memoryResource());
+  BOOST_CHECK(storedSourceLinks.get_allocator().resource() ==
+              store.memoryResource());
+  BOOST_CHECK(storedClusters.get_allocator().resource() ==
+              store.memoryResource());
+  BOOST_REQUIRE_EQUAL(selectModule(storedHits, geoId).size(), 1u);
+  BOOST_REQUIRE_EQUAL(selectModule(storedSourceLinks, geoId).size(), 1u);
+  BOOST_REQUIRE_EQUAL(selectModule(storedClusters, geoId).size(), 1u);
+  size_t numModules = 0;
+  for (auto&& [moduleGeoId, moduleClusters] : groupByModule(storedClusters)) {
+    BOOST_CHECK_EQUAL(moduleGeoId, geoId);
+    BOOST_CHECK_EQUAL(moduleClusters.size(), 1u);
+    ++numModules;
+  }
+  BOOST_CHECK_EQUAL(numModules, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "ACTFW/Plugins/BField/ScalableBField.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SharedBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Write a small (r,z) field map in text format with a solenoid-like field.
+void writeFieldMapRZ(const std::string& path) {
+  std::ofstream file(path);
+  // the z bin is the outer index of the global bin
+  for (int iz = -20; iz <= 20; ++iz) {
+    for (int ir = 0; ir <= 20; ++ir) {
+      const double r = 50. * ir;
+      const double z = 100. * iz;
+      const double br = 0.05 * (r / 1000.) * (z / 2000.);
+      const double bz = 2. - 0.2 * (r / 1000.) * (r / 1000.);
+      file << r << " " << z << " " << br << " " << bz << "\n";
+    }
+  }
+}
+
+/// Parse the magnetic field options from the given arguments.
+po::variables_map parseBFieldOptions(std::vector<std::string> args) {
+  po::options_description desc;
+  FW::Options::addBFieldOptions(desc);
+  po::variables_map vm;
+  po::store(po::command_line_parser(args).options(desc).run(), vm);
+  po::notify(vm);
+  return vm;
+}
+
+/// Propagate a track through the field with the stepper used in the jobs.
+template <typename field_t>
+Acts::Vector3D propagateThrough(std::shared_ptr<field_t> field) {
+  using MagneticField = Acts::SharedBField<field_t>;
+  using Stepper = Acts::EigenStepper<MagneticField>;
+  using Propagator = Acts::Propagator<Stepper>;
+
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  Propagator propagator(Stepper(MagneticField(std::move(field))));
+  Acts::PropagatorOptions<> options(geoCtx, magCtx);
+  options.pathLimit = 1_m;
+  options.maxStepSize = 1_cm;
+  Acts::CurvilinearParameters start(std::nullopt, Acts::Vector3D(0., 0., 0.),
+                                    Acts::Vector3D(1_GeV, 0.2_GeV, 0.5_GeV),
+                                    1., 0.);
+  auto result = propagator.propagate(start, options);
+  return result.value().endParameters->position();
+}
+
+/// Read the field map with the given storage and propagate through it.
+template <typename expected_field_t>
+Acts::Vector3D propagateWithStorage(const std::string& path,
+                                    const std::string& storage) {
+  auto vm = parseBFieldOptions(
+      {"--bf-map", path, "--bf-rz", "1", "--bf-storage", storage});
+  BOOST_CHECK_EQUAL(FW::Options::useBFieldMap(vm), storage != "double");
+
+  Acts::Vector3D end(0., 0., 0.);
+  bool visited = false;
+  FW::Options::visitBField(vm, [&](auto& bField) {
+    using field_t = typename std::decay_t<decltype(bField)>::element_type;
+    visited = std::is_same_v<field_t, expected_field_t>;
+    end = propagateThrough(bField);
+  });
+  BOOST_CHECK(visited);
+  return end;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBFieldOptions)
+
+BOOST_AUTO_TEST_CASE(UseBFieldMap) {
+  BOOST_CHECK(not FW::Options::useBFieldMap(parseBFieldOptions({})));
+  BOOST_CHECK(not FW::Options::useBFieldMap(
+      parseBFieldOptions({"--bf-storage", "float"})));
+  BOOST_CHECK(not FW::Options::useBFieldMap(
+      parseBFieldOptions({"--bf-map", "field.txt"})));
+  BOOST_CHECK(FW::Options::useBFieldMap(
+      parseBFieldOptions({"--bf-map", "field.txt", "--bf-storage", "float"})));
+  BOOST_CHECK(FW::Options::useBFieldMap(
+      parseBFieldOptions({"--bf-map", "field.root", "--bf-storage", "int16"})));
+  BOOST_CHECK(FW::Options::useBFieldMap(
+      parseBFieldOptions({"--bf-map", "field.bfm"})));
+}
+
+BOOST_AUTO_TEST_CASE(CompactStorageInTheStepper) {
+  const std::string path = "BFieldOptionsTests_rz.txt";
+  writeFieldMapRZ(path);
+
+  // the compact maps can not be returned in the job field variant
+  auto vm = parseBFieldOptions(
+      {"--bf-map", path, "--bf-rz", "1", "--bf-storage", "float"});
+  BOOST_CHECK_THROW(FW::Options::readBField(vm), std::invalid_argument);
+
+  auto reference =
+      propagateWithStorage<InterpolatedBFieldMap2D>(path, "double");
+  auto compact = propagateWithStorage<CompactBFieldMap2D>(path, "float");
+  auto scaled = propagateWithStorage<ScaledBFieldMap2D>(path, "int16");
+  std::remove(path.c_str());
+
+  // the track is bent by the field, the precision only changes it slightly
+  BOOST_CHECK_GT((reference - Acts::Vector3D(1., 0.2, 0.5).normalized() * 1_m)
+                     .norm(),
+                 1_cm);
+  CHECK_CLOSE_ABS(compact, reference, 1_um);
+  CHECK_CLOSE_ABS(scaled, reference, 10_um);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,266 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/Plugins/BField/BFieldOptions.hpp"
+#include "ACTFW/Plugins/BField/BFieldUtils.hpp"
+#include "ACTFW/Plugins/BField/BinaryBFieldWriter.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using FW::BField::binary::Header;
+
+namespace {
+
+using SourceMap2D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperRZ<double>>;
+using SourceMap3D =
+    Acts::InterpolatedBFieldMap<Acts::CompactBFieldMapperXYZ<double>>;
+
+/// (r,z) map with a solenoid-like field on a 21x41 grid.
+std::shared_ptr<const SourceMap2D> makeSourceMapRZ() {
+  std::vector<double> rPos;
+  std::vector<double> zPos;
+  std::vector<Acts::Vector2D> bField;
+  for (int iz = -20; iz <= 20; ++iz) {
+    for (int ir = 0; ir <= 20; ++ir) {
+      const double r = 50. * ir;
+      const double z = 100. * iz;
+      rPos.push_back(r);
+      zPos.push_back(z);
+      bField.emplace_back(0.05 * (r / 1000.) * (z / 2000.),
+                          2. - 0.2 * (r / 1000.) * (r / 1000.));
+    }
+  }
+  auto mapper = Acts::fieldMapperRZ<double>(
+      [](std::array<size_t, 2> binsRZ, std::array<size_t, 2> nBinsRZ) {
+        return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+      },
+      std::move(rPos), std::move(zPos), std::move(bField));
+  SourceMap2D::Config config(std::move(mapper));
+  return std::make_shared<const SourceMap2D>(std::move(config));
+}
+
+/// (x,y,z) map with a non-uniform field on a 9x11x13 grid.
+std::shared_ptr<const SourceMap3D> makeSourceMapXYZ() {
+  std::vector<double> xPos;
+  std::vector<double> yPos;
+  std::vector<double> zPos;
+  std::vector<Acts::Vector3D> bField;
+  for (int ix = -4; ix <= 4; ++ix) {
+    for (int iy = -5; iy <= 5; ++iy) {
+      for (int iz = -6; iz <= 6; ++iz) {
+        const double x = 100. * ix;
+        const double y = 100. * iy;
+        const double z = 150. * iz;
+        xPos.push_back(x);
+        yPos.push_back(y);
+        zPos.push_back(z);
+        bField.emplace_back(1e-4 * x, -2e-4 * y, 1.5 + 1e-4 * z);
+      }
+    }
+  }
+  auto mapper = Acts::fieldMapperXYZ<double>(
+      [](std::array<size_t, 3> binsXYZ, std::array<size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      std::move(xPos), std::move(yPos), std::move(zPos), std::move(bField));
+  SourceMap3D::Config config(std::move(mapper));
+  return std::make_shared<const SourceMap3D>(std::move(config));
+}
+
+template <typename bfield_t>
+void writeBinary(const std::string& path,
+                 std::shared_ptr<const bfield_t> bField) {
+  typename FW::BinaryBFieldWriter<bfield_t>::Config config;
+  config.fileName = path;
+  config.bField = std::move(bField);
+  FW::BinaryBFieldWriter<bfield_t>::run(config);
+}
+
+/// Compare the stored values and the field look-ups of two field maps.
+template <typename source_t, typename mapped_t>
+void checkSameField(const source_t& source, const mapped_t& mapped,
+                    const std::vector<Acts::Vector3D>& positions) {
+  const auto& sourceMapper = source.getMapper();
+  const auto& mappedMapper = mapped.getMapper();
+  const auto& sourceGrid = sourceMapper.getGrid();
+  const auto& mappedGrid = mappedMapper.getGrid();
+  BOOST_CHECK_EQUAL(mappedGrid.size(), sourceGrid.size());
+  BOOST_CHECK(mappedGrid.numLocalBins() == sourceGrid.numLocalBins());
+  BOOST_CHECK(mappedGrid.minPosition() == sourceGrid.minPosition());
+  BOOST_CHECK(mappedGrid.maxPosition() == sourceGrid.maxPosition());
+  size_t mismatches = 0;
+  for (size_t i = 0; i < sourceGrid.size(); ++i) {
+    if (mappedGrid.at(i) != sourceGrid.at(i)) {
+      ++mismatches;
+    }
+  }
+  BOOST_CHECK_EQUAL(mismatches, 0u);
+
+  for (const auto& pos : positions) {
+    BOOST_CHECK(mapped.isInside(pos));
+    CHECK_CLOSE_ABS(mapped.getField(pos), source.getField(pos), 1e-12_T);
+  }
+}
+
+/// Overwrite the header of a binary field map file.
+void modifyHeader(const std::string& path,
+                  const std::function<void(Header&)>& modify) {
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  Header header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(Header));
+  modify(header);
+  file.seekp(0);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+}
+
+/// Keep only the first bytes of a file.
+void truncateFile(const std::string& path, size_t size) {
+  std::vector<char> content;
+  {
+    std::ifstream file(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  }
+  BOOST_REQUIRE_LT(size, content.size());
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), size);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesBinaryBField)
+
+BOOST_AUTO_TEST_CASE(RoundTripRZ) {
+  const std::string path = "BinaryBFieldTests_rz.bfm";
+  auto source = makeSourceMapRZ();
+  writeBinary(path, source);
+
+  MappedBFieldMap2D::Config config(FW::BField::binary::fieldMapperRZ(path));
+  MappedBFieldMap2D mapped(std::move(config));
+  // the mapping stays valid after the file is removed
+  std::remove(path.c_str());
+
+  checkSameField(*source, mapped,
+                 {Acts::Vector3D(0., 0., 0.), Acts::Vector3D(10., 20., 30.),
+                  Acts::Vector3D(-300., 420., -1234.),
+                  Acts::Vector3D(555., -123., 1789.),
+                  Acts::Vector3D(0., -970., 1990.)});
+}
+
+BOOST_AUTO_TEST_CASE(RoundTripXYZ) {
+  const std::string path = "BinaryBFieldTests_xyz.bfm";
+  auto source = makeSourceMapXYZ();
+  writeBinary(path, source);
+
+  MappedBFieldMap3D::Config config(FW::BField::binary::fieldMapperXYZ(path));
+  MappedBFieldMap3D mapped(std::move(config));
+  std::remove(path.c_str());
+
+  checkSameField(*source, mapped,
+                 {Acts::Vector3D(0., 0., 0.), Acts::Vector3D(10., 20., 30.),
+                  Acts::Vector3D(-310., 420., -823.),
+                  Acts::Vector3D(375., -480., 880.),
+                  Acts::Vector3D(-399., -1., 5.)});
+}
+
+BOOST_AUTO_TEST_CASE(RejectInvalidFiles) {
+  const std::string path = "BinaryBFieldTests_invalid.bfm";
+  auto source = makeSourceMapRZ();
+
+  // missing file
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::ios_base::failure);
+
+  // wrong number of dimensions
+  writeBinary(path, source);
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperXYZ(path),
+                    std::runtime_error);
+
+  // bad magic number
+  modifyHeader(path, [](Header& header) { header.magic[0] = 'X'; });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // unsupported version
+  writeBinary(path, source);
+  modifyHeader(path,
+               [](Header& header) { header.version = Header::s_version + 1; });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // wrong byte order
+  writeBinary(path, source);
+  modifyHeader(path, [](Header& header) { header.byteOrder = 0x04030201; });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // truncated field values
+  writeBinary(path, source);
+  truncateFile(path, Header::s_dataAlignment + 100);
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // empty axes, consistent with the (0+2)^2 stored values, and inverted
+  // or non-finite axis ranges
+  writeBinary(path, source);
+  modifyHeader(path, [](Header& header) {
+    header.nBins = {{0, 0, 0}};
+    header.nValues = 4;
+  });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+  writeBinary(path, source);
+  modifyHeader(path, [](Header& header) { header.max[0] = header.min[0]; });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+  writeBinary(path, source);
+  modifyHeader(path, [](Header& header) {
+    header.min[1] = std::numeric_limits<double>::quiet_NaN();
+  });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+  writeBinary(path, source);
+  modifyHeader(path, [](Header& header) {
+    header.max[1] = std::numeric_limits<double>::infinity();
+  });
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // truncated header
+  writeBinary(path, source);
+  truncateFile(path, sizeof(Header) / 2);
+  BOOST_CHECK_THROW(FW::BField::binary::fieldMapperRZ(path),
+                    std::runtime_error);
+
+  // the unmodified file is accepted
+  writeBinary(path, source);
+  BOOST_CHECK_NO_THROW(FW::BField::binary::fieldMapperRZ(path));
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ACTFW/Seeding/ParallelSeeding.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// reuse the space point and the cuts of the core seeding test
+#include "../../Core/Seeding/ATLASCuts.hpp"
+#include "../../Core/Seeding/SpacePoint.hpp"
+
+namespace {
+
+/// Straight tracks from the beam line through five barrel layers, spread in
+/// phi and eta such that many groups of the binned container have seeds.
+std::vector<SpacePoint> makeSpacePoints() {
+  const std::vector<float> radii = {33., 50., 88., 122., 150.};
+  std::vector<SpacePoint> points;
+  for (int iphi = 0; iphi < 48; ++iphi) {
+    const float phi = -M_PI + (iphi + 0.3) * 2 * M_PI / 48;
+    for (int ieta = -4; ieta <= 4; ++ieta) {
+      const float cotTheta = 0.45 * ieta + 0.1;
+      const float z0 = 10. * ((iphi + ieta) % 5 - 2);
+      for (size_t ilayer = 0; ilayer < radii.size(); ++ilayer) {
+        const float r = radii[ilayer];
+        points.push_back(SpacePoint{r * std::cos(phi), r * std::sin(phi),
+                                    z0 + r * cotTheta, r,
+                                    static_cast<int>(ilayer + 1), 0.06, 0.06});
+      }
+    }
+  }
+  return points;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ExamplesSeeding)
+
+BOOST_AUTO_TEST_CASE(ParallelSeedsMatchSerialSeeds) {
+  std::vector<SpacePoint> points = makeSpacePoints();
+  std::vector<const SpacePoint*> spVec;
+  for (const SpacePoint& sp : points) {
+    spVec.push_back(&sp);
+  }
+
+  Acts::SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.00000;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+
+  auto bottomBinFinder = std::make_shared<Acts::BinFinder<SpacePoint>>();
+  auto topBinFinder = std::make_shared<Acts::BinFinder<SpacePoint>>();
+  Acts::ATLASCuts<SpacePoint> atlasCuts;
+  config.seedFilter = std::make_unique<Acts::SeedFilter<SpacePoint>>(
+      Acts::SeedFilterConfig(), &atlasCuts);
+  Acts::Seedfinder<SpacePoint> finder(config);
+
+  auto ct = [](const SpacePoint& sp, float, float, float) -> Acts::Vector2D {
+    return {sp.varianceR, sp.varianceZ};
+  };
+  Acts::SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = config.bFieldInZ;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+  auto spGroup = Acts::BinnedSPGroup<SpacePoint>(
+      spVec.begin(), spVec.end(), ct, bottomBinFinder, topBinFinder,
+      Acts::SpacePointGridCreator::createGrid<SpacePoint>(gridConf), config);
+
+  // serial reference from the group iterator
+  std::vector<Acts::Seed<SpacePoint>> serial;
+  size_t numGroupsWithSeeds = 0;
+  for (auto groupIt = spGroup.begin(); !(groupIt == spGroup.end());
+       ++groupIt) {
+    auto seeds = finder.createSeedsForGroup(groupIt.bottom(), groupIt.middle(),
+                                            groupIt.top());
+    numGroupsWithSeeds += seeds.empty() ? 0 : 1;
+    // Seed is copy-constructible, but not assignable
+    std::copy(seeds.begin(), seeds.end(), std::back_inserter(serial));
+  }
+  // the comparison is only meaningful if the seeds span several groups
+  BOOST_REQUIRE_GT(numGroupsWithSeeds, 4u);
+
+  for (int numThreads : {1, 2, 4}) {
+    for (size_t groupsPerTask : {1u, 3u}) {
+      BOOST_TEST_CONTEXT("threads " << numThreads << " groups per task "
+                                    << groupsPerTask) {
+        tbb::task_arena arena(numThreads);
+        auto parallel =
+            FW::createSeedsParallel(finder, spGroup, arena, groupsPerTask);
+        BOOST_REQUIRE_EQUAL(parallel.size(), serial.size());
+        for (size_t i = 0; i < serial.size(); ++i) {
+          BOOST_CHECK(parallel[i].sp() == serial[i].sp());
+          BOOST_CHECK_EQUAL(parallel[i].z(), serial[i].z());
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -520,5 +520,114 @@ BOOST_AUTO_TEST_CASE(create_Clusters2) {
   }
   CHECK_CLOSE_REL(data9, (nClustersNoTouch * 2) * 2, 1e-5);
 }
+/// This test tests the clusterization of cells sorted by column and row on a
+/// checkerboard, where all cells share only corners, and on a completely
+/// filled grid, which gives one big cluster
+BOOST_AUTO_TEST_CASE(create_Clusters_sorted) {
+  size_t nCells = 1000;
+  std::vector<Acts::DigitizationCell> checkerboard;
+  std::vector<Acts::DigitizationCell> filled;
+  for (size_t i = 0; i < nCells; ++i) {
+    for (size_t j = 0; j < nCells; ++j) {
+      if ((i + j) % 2 == 0) {
+        // alternate the energy to check the energy cut
+        checkerboard.emplace_back(i, j, 1 + (i % 2));
+      }
+      filled.emplace_back(i, j, 1);
+    }
+  }
+
+  // common corner
+  auto mergedCells1 = Acts::createClusters(checkerboard, true, 0.);
+  BOOST_CHECK_EQUAL(mergedCells1.size(), 1u);
+  BOOST_CHECK_EQUAL(mergedCells1.front().size(), checkerboard.size());
+  // common edge
+  auto mergedCells2 = Acts::createClusters(checkerboard, false, 0.);
+  BOOST_CHECK_EQUAL(mergedCells2.size(), checkerboard.size());
+  // common corner, energy cut keeps every second column
+  auto mergedCells3 = Acts::createClusters(checkerboard, true, 1.5);
+  BOOST_CHECK_EQUAL(mergedCells3.size(), checkerboard.size() / 2);
+
+  // one big cluster, sorted by column and row
+  for (bool commonCorner : {true, false}) {
+    auto mergedCells = Acts::createClusters(filled, commonCorner, 0.);
+    BOOST_CHECK_EQUAL(mergedCells.size(), 1u);
+    BOOST_CHECK_EQUAL(mergedCells.front().size(), filled.size());
+    BOOST_CHECK(std::equal(
+        filled.begin(), filled.end(), mergedCells.front().begin(),
+        [](const auto& lhs, const auto& rhs) {
+          return lhs.channel0 == rhs.channel0 and lhs.channel1 == rhs.channel1;
+        }));
+  }
+}
+
+/// This test tests the clusterization of the cells of many modules at once
+BOOST_AUTO_TEST_CASE(create_Clusters_modules) {
+  // the cells of the grid in create_Clusters1 on the first module, and every
+  // cell without neighbours on the second one
+  //
+  // 1 0 0 0 2 0 0 0 0 2
+  // 0 2 0 1 0 0 0 2 0 2
+  // 0 0 0 0 0 0 0 1 1 2
+  // 2 0 0 0 0 1 0 0 0 0
+  // 1 0 0 1 0 2 0 0 0 2
+  // 0 0 2 0 0 1 0 1 0 1
+  // 0 0 0 1 1 0 0 2 0 1
+  // 0 0 0 0 0 0 0 0 2 0
+  // 1 2 2 0 0 0 0 0 0 0
+  std::vector<std::vector<size_t>> grid = {
+      {1, 0, 0, 0, 2, 0, 0, 0, 0, 2}, {0, 2, 0, 1, 0, 0, 0, 2, 0, 2},
+      {0, 0, 0, 0, 0, 0, 0, 1, 1, 2}, {2, 0, 0, 0, 0, 1, 0, 0, 0, 0},
+      {1, 0, 0, 1, 0, 2, 0, 0, 0, 2}, {0, 0, 2, 0, 0, 1, 0, 1, 0, 1},
+      {0, 0, 0, 1, 1, 0, 0, 2, 0, 1}, {0, 0, 0, 0, 0, 0, 0, 0, 2, 0},
+      {1, 2, 2, 0, 0, 0, 0, 0, 0, 0}};
+  std::vector<Acts::DigitizationCell> cells;
+  std::vector<size_t> moduleOffsets = {0};
+  for (size_t i = 0; i < grid.front().size(); ++i) {
+    for (size_t j = 0; j < grid.size(); ++j) {
+      if (grid[j][i] != 0) {
+        cells.emplace_back(i, j, grid[j][i]);
+      }
+    }
+  }
+  moduleOffsets.push_back(cells.size());
+  for (size_t i = 0; i < 20; i += 2) {
+    for (size_t j = 0; j < 20; j += 2) {
+      cells.emplace_back(i, j, 1);
+    }
+  }
+  moduleOffsets.push_back(cells.size());
+
+  auto clusterSizes = [](const std::vector<std::vector<DigitizationCell>>&
+                             clusters) {
+    std::vector<size_t> sizes;
+    for (const auto& cluster : clusters) {
+      sizes.push_back(cluster.size());
+    }
+    std::sort(sizes.begin(), sizes.end());
+    return sizes;
+  };
+
+  // common corner, common edge and common corner with energy cut
+  std::vector<std::vector<size_t>> expectedSizes = {
+      {2, 2, 2, 3, 6, 6, 7},
+      {1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 6},
+      {1, 1, 1, 1, 1, 1, 1, 2, 2, 3}};
+  std::vector<std::pair<bool, double>> settings = {
+      {true, 0.}, {false, 0.}, {true, 1.5}};
+  for (size_t is = 0; is < settings.size(); ++is) {
+    auto [commonCorner, energyCut] = settings[is];
+    auto moduleClusters =
+        Acts::createClusters(cells, moduleOffsets, commonCorner, energyCut);
+    BOOST_CHECK_EQUAL(moduleClusters.size(), 2u);
+    auto sizes = clusterSizes(moduleClusters[0]);
+    BOOST_CHECK_EQUAL_COLLECTIONS(sizes.begin(), sizes.end(),
+                                  expectedSizes[is].begin(),
+                                  expectedSizes[is].end());
+    BOOST_CHECK_EQUAL(moduleClusters[1].size(),
+                      (energyCut == 0.) ? 100u : 0u);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -17,8 +17,11 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <algorithm>
+
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
 using namespace Acts::UnitLiterals;
@@ -55,6 +58,31 @@ PlanarModuleStepper pmStepper;
 // Create a test context
 GeometryContext tgContext = GeometryContext();
 
+// The steps from intersecting the segmentation surfaces of the module
+std::vector<DigitizationStep> surfaceSteps(const DigitizationModule& dmodule,
+                                           const Vector3D& start,
+                                           const Vector3D& end) {
+  Vector3D direction = (end - start).normalized();
+  std::vector<Intersection> intersections;
+  for (auto& surface : dmodule.stepSurfaces(start, end)) {
+    auto sIntersection = surface->intersect(tgContext, start, direction, true);
+    if (bool(sIntersection)) {
+      intersections.push_back(sIntersection.intersection);
+    }
+  }
+  intersections.push_back(Intersection(end, (end - start).norm(),
+                                       Intersection::Status::reachable));
+  std::sort(intersections.begin(), intersections.end());
+  std::vector<DigitizationStep> steps;
+  Vector3D lastPosition = start;
+  for (auto& intersection : intersections) {
+    steps.push_back(dmodule.digitizationStep(lastPosition,
+                                             intersection.position));
+    lastPosition = intersection.position;
+  }
+  return steps;
+}
+
 /// The following test checks test cases where the entry and exit is
 /// guaranteed to be in on the readout/counter plane
 BOOST_DATA_TEST_CASE(
@@ -96,5 +124,44 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+/// The following test checks that the cell boundaries crossed by the
+/// stepper are the ones of the segmentation surfaces, up to the float
+/// precision of the bin boundaries
+BOOST_DATA_TEST_CASE(
+    segmentation_surfaces_test,
+    bdata::random((bdata::seed = 4,
+                   bdata::distribution = std::uniform_real_distribution<>(
+                       -halfX + sguardX, halfX - sguardX))) ^
+        bdata::random((bdata::seed = 5,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-halfY, halfY))) ^
+        bdata::random((bdata::seed = 6,
+                       bdata::distribution = std::uniform_real_distribution<>(
+                           -halfX + sguardX, halfX - sguardX))) ^
+        bdata::random((bdata::seed = 7,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-halfY, halfY))) ^
+        bdata::xrange(ntests),
+    entryX, entryY, exitX, exitY, index) {
+  (void)index;
+
+  Vector3D entry(entryX, entryY, -hThickness);
+  Vector3D exit(exitX, exitY, hThickness);
+
+  for (auto& dm : testModules) {
+    auto cSteps = pmStepper.cellSteps(tgContext, dm, entry, exit);
+    auto rSteps = surfaceSteps(dm, entry, exit);
+    BOOST_CHECK_EQUAL(cSteps.size(), rSteps.size());
+    for (size_t is = 0; is < std::min(cSteps.size(), rSteps.size()); ++is) {
+      BOOST_CHECK_EQUAL(cSteps[is].stepCell.channel0,
+                        rSteps[is].stepCell.channel0);
+      BOOST_CHECK_EQUAL(cSteps[is].stepCell.channel1,
+                        rSteps[is].stepCell.channel1);
+      CHECK_CLOSE_ABS(cSteps[is].stepLength, rSteps[is].stepLength, 10_nm);
+      CHECK_CLOSE_ABS(cSteps[is].stepExit, rSteps[is].stepExit, 10_nm);
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts